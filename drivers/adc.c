@@ -1,5 +1,6 @@
 #include <platform.h>
 #include <adc.h>
+#include <timer.h>
 
 //ADC power control
 //PCONP
@@ -12,11 +13,21 @@
 //CR
 #define ADC_PDN                  ((uint32_t)((1)<<21)) 
 #define ADC_START                ((uint32_t)((1)<<24)) 
+#define ADC_START_MASK           ((uint32_t)((7)<<24))
+#define ADC_START_MAT0_1         ((uint32_t)((4)<<24)) //Start on an edge of MAT0.1
+#define ADC_EDGE                 ((uint32_t)((1)<<27)) //Falling edge when set
 #define ADC_PORT_SELECT(n)        ((uint32_t)((1)<<n))
 
+//DR
+#define ADC_DONE                 ((uint32_t)(1UL<<31))
+#define ADC_RESULT(dr)           (((dr) >> 4) & 0xFFF)
+
 #define ADC_SAMPLING_FREQUENCY       (400000)                 //400kHz
 #define ADC_VREF                     (3.3)
 
+static uint8_t adc_channel;                               //GET_ADC0_Port(P_ADC), set by adc_init()
+static void (*adc_callback)(int value) = 0;
+
 uint8_t GET_ADC0_Port(Pin pin){
 	
 	uint8_t ADC0_Pin_num;
@@ -45,7 +56,8 @@ void adc_init(void) {
 	temp = (PeripheralClock * 2 + temp) / (2 * temp) - 1;
 	LPC_ADC -> CR |=  (temp<<8);
 	
-	LPC_ADC -> CR |= ADC_PORT_SELECT(GET_ADC0_Port(P_ADC)) | ADC_PDN; // ADC pre-setting
+	adc_channel = GET_ADC0_Port(P_ADC);
+	LPC_ADC -> CR |= ADC_PORT_SELECT(adc_channel) | ADC_PDN; // ADC pre-setting
 
 }
 
@@ -55,12 +67,47 @@ int adc_read(void) {
 	
 	LPC_ADC -> CR |= ADC_START; //Start conversion
 	
-	while( !(LPC_ADC->DR[GET_ADC0_Port(P_ADC)] & (1UL<<31)) );//wait until the conversion completes
+	while( !((data = LPC_ADC->DR[adc_channel]) & ADC_DONE) );//wait until the conversion completes
 	LPC_ADC -> CR &= ~ADC_START;
 	
-	data = ((LPC_ADC->DR[GET_ADC0_Port(P_ADC)] >> 4) ) & 0xFFF;
-	return data;
+	return ADC_RESULT(data);
 
 }
 
+void adc_start_triggered(uint32_t frequency, void (*callback)(int value)) {
+	
+	adc_callback = callback;
+	
+	LPC_ADC -> CR &= ~(ADC_START_MASK | ADC_EDGE);
+	LPC_ADC -> INTEN = ADC_PORT_SELECT(adc_channel); //Interrupt on the completion of our channel only
+	NVIC_SetPriority(ADC_IRQn, 1);
+	NVIC_ClearPendingIRQ(ADC_IRQn);
+	NVIC_EnableIRQ(ADC_IRQn);
+	
+	LPC_ADC -> CR |= ADC_START_MAT0_1;                 //Rising edge
+	timer_start_match_output(frequency);
+	
+}
+
+void adc_stop_triggered(void) {
+	
+	timer_disable();
+	LPC_ADC -> CR &= ~ADC_START_MASK;
+	NVIC_DisableIRQ(ADC_IRQn);
+	LPC_ADC -> INTEN = 0;
+	adc_callback = 0;
+	
+}
+
+//Reading DR clears the DONE flag and the interrupt
+void ADC_IRQHandler(void) {
+	
+	uint32_t data = LPC_ADC->DR[adc_channel];
+	
+	if (adc_callback) {
+		adc_callback(ADC_RESULT(data));
+	}
+	
+}
+
 // *******************************ARM University Program Copyright © ARM Ltd 2014*************************************   
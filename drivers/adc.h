@@ -5,6 +5,7 @@
  */
 #ifndef ADC_H
 #define ADC_H
+#include <stdint.h>
 
 /*! \brief Initializes the analogue to digital converter, and configures
  *         the appropriate GPIO pin.
@@ -16,4 +17,16 @@ void adc_init(void);
  */
 int adc_read(void);
 
+/*! \brief Starts conversions in hardware on every rising edge of MAT0.1,
+ *         set up by timer_start_match_output(), and hands each result
+ *         to the callback from the conversion complete interrupt.
+ *         adc_read() must not be used until adc_stop_triggered().
+ *  \param frequency  Conversions per second.
+ *  \param callback  Called with each result, in interrupt context.
+ */
+void adc_start_triggered(uint32_t frequency, void (*callback)(int value));
+
+/*! \brief Stops the timer triggered conversions. */
+void adc_stop_triggered(void);
+
 #endif // ADC_H
@@ -13,9 +13,14 @@
 #define MATCHVALUE(n)                   (10000*n)
 //Set Match Register n
 #define TIM_MCR_CHANNEL_SET(n)      ((uint32_t)(3<<(n*3)))
+//Reset the counter on Match Register n
+#define TIM_MCR_RESET(n)            ((uint32_t)(2<<(n*3)))
+//Toggle the external match output n
+#define TIM_EMR_TOGGLE(n)           ((uint32_t)(3<<(4+n*2)))
 
 
 static void (*timer_callback)(void) = 0;
+static void (*timer1_callback)(void) = 0;
 
 //Using timer 0
 void timer_init(uint32_t period) {
@@ -67,6 +72,62 @@ void timer_set_callback(void (*callback)(void)) {
 
 }
 
+//MAT0.1 toggles on every match of MR1, which also resets the counter: two matches per period
+void timer_start_match_output(uint32_t frequency) {
+	
+	LPC_SC -> PCONP |= PCTIM0;
+	
+	LPC_TIM0 -> TCR = (1<<1);  //Stop and reset
+	LPC_TIM0 -> CTCR = 0;
+	LPC_TIM0 -> PR = 0;        //Count PCLK
+	LPC_TIM0 -> MR1 = (PeripheralClock + frequency) / (2 * frequency) - 1;
+	LPC_TIM0 -> MCR = TIM_MCR_RESET(1);
+	LPC_TIM0 -> EMR = TIM_EMR_TOGGLE(1);
+	LPC_TIM0 -> IR = 0xFFFFFFFF;
+	LPC_TIM0 -> TCR = 1;       //Release reset and start
+	
+}
+
+//Timer 1: interrupt and reset on MR0, one match per period
+void timer_start_periodic(uint32_t frequency, void (*callback)(void)) {
+	
+	timer1_callback = callback;
+	LPC_SC -> PCONP |= PCTIM1;
+	
+	LPC_TIM1 -> TCR = (1<<1);  //Stop and reset
+	LPC_TIM1 -> CTCR = 0;
+	LPC_TIM1 -> PR = 0;        //Count PCLK
+	LPC_TIM1 -> MR0 = (PeripheralClock + frequency / 2) / frequency - 1;
+	LPC_TIM1 -> MCR = TIM_MCR_CHANNEL_SET(0);
+	LPC_TIM1 -> IR = 0xFFFFFFFF;
+	
+	//Same priority as the ADC conversions, above the switches
+	NVIC_SetPriority(TIMER1_IRQn, 1);
+	NVIC_ClearPendingIRQ(TIMER1_IRQn);
+	NVIC_EnableIRQ(TIMER1_IRQn);
+	
+	LPC_TIM1 -> TCR = 1;       //Release reset and start
+	
+}
+
+void timer_stop_periodic(void) {
+	
+	LPC_TIM1 -> TCR = 0;
+	NVIC_DisableIRQ(TIMER1_IRQn);
+	timer1_callback = 0;
+	
+}
+
+void TIMER1_IRQHandler(void){
+	
+	// Cleared first, so that a match during the callback is not lost
+	LPC_TIM1 -> IR = 0x1;
+	if (timer1_callback) {
+		timer1_callback();
+	}
+	
+}
+
 void TIMER0_IRQHandler(void){
 	
 	if ( ((LPC_TIM0 -> IR) & (0x1)) != 0 )
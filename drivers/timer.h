@@ -24,6 +24,26 @@ void timer_enable(void);
 /*! \brief Disables the timer. */
 void timer_disable(void);
 
+/*! \brief Runs timer 0 so that its match output MAT0.1 has a rising edge
+ *         at the given frequency, without interrupt, to start the ADC
+ *         conversions in hardware.
+ *  \param frequency  Edges per second, PeripheralClock / (2 * frequency)
+ *                    is rounded to a whole number of timer counts.
+ */
+void timer_start_match_output(uint32_t frequency);
+
+/*! \brief Runs timer 1 with an interrupt at the given frequency, for
+ *         periodic work that must not share timer 0 with the ADC
+ *         trigger, such as feeding the DAC.
+ *  \param frequency  Interrupts per second, PeripheralClock / frequency
+ *                    is rounded to a whole number of timer counts.
+ *  \param callback  Called from the interrupt handler.
+ */
+void timer_start_periodic(uint32_t frequency, void (*callback)(void));
+
+/*! \brief Stops timer 1 and its interrupt. */
+void timer_stop_periodic(void);
+
 #endif // TIMER_H
 
 // *******************************ARM University Program Copyright  ARM Ltd 2014*************************************   
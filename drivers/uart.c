@@ -43,7 +43,11 @@
 
 float Fractional_Divider_Array [72][3];
 
+// Transmit FIFO depth
+#define UART_TX_FIFO_SIZE       16
+
 static void (*UART_callback)(uint8_t);
+static int (*UART_tx_callback)(uint8_t *);
 
 void FR_TABLE_Value(float input_array[3], float FR, float Div, float Mul);
 void FR_TABLE_Construct(void);
@@ -165,9 +169,43 @@ void uart_set_rx_callback(void (*callback)(uint8_t)) {
 	__enable_irq();
 }
 
+void uart_set_tx_callback(int (*callback)(uint8_t *c)) {
+	
+	UART_tx_callback = callback;
+	LPC_UART0-> IER  |= UART_IER_THREIE; //Enable THRE
+	
+	NVIC_SetPriority(UART0_IRQn, 3);
+	NVIC_ClearPendingIRQ(UART0_IRQn);
+	NVIC_EnableIRQ(UART0_IRQn);
+	__enable_irq();
+}
+
+//Up to a FIFO of bytes from the transmit callback
+static void uart_fill_tx(void) {
+	
+	uint8_t c;
+	int n;
+	
+	for (n = 0; n < UART_TX_FIFO_SIZE && UART_tx_callback && UART_tx_callback(&c); n++) {
+		LPC_UART0->THR = c;
+	}
+}
+
+void uart_tx_kick(void) {
+	
+	if (LPC_UART0-> LSR & UART_LSR_THRE) {
+		uart_fill_tx();
+	}
+}
+
 void UART0_IRQHandler(void){
 	
 	switch(LPC_UART0->IIR>>1 & 0x7){
+		case 0x1:
+			uart_fill_tx();
+	  break;//Transmit FIFO empty
+		
+
 		case 0x3:
 			while(1)
 		;//error
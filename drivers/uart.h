@@ -40,4 +40,19 @@ void uart_print(char *str);
  */
 void uart_set_rx_callback(void (*callback)(uint8_t c));
 
+/*! \brief Passes a callback function to the API which supplies the bytes
+ *         to transmit from the interrupt handler, up to the 16 bytes of
+ *         the transmit FIFO each time it empties.
+ *  \param callback  Stores the next byte and returns 1, or returns 0 when
+ *                   there is nothing left to send.
+ */
+void uart_set_tx_callback(int (*callback)(uint8_t *c));
+
+/*! \brief Fills the transmit FIFO from the transmit callback if it is
+ *         empty, to start sending after the callback returned 0. Does
+ *         nothing while the FIFO still holds bytes, the interrupt of its
+ *         emptying asks the callback again.
+ */
+void uart_tx_kick(void);
+
 #endif // UART_H
@@ -0,0 +1,1333 @@
+/*! \file bench_dtmf.c
+ * \brief Host benchmark of the DTMF decoding paths
+ *
+ * Generates DTMF digit sequences with dtmf_gen.c, cuts them into frames of G_ARRAY_SIZE samples exactly like the
+ * reader does, and runs every frame through each detector registered in g_detectors[]. For every scenario and detector it
+ * reports the cost (ns/frame as the best of the repeated passes, frames/s, plus the detector's own memory and cost
+ * estimates) and the quality (detection and false positive rates) as JSON, so that results can be stored and compared
+ * between commits.
+ *
+ * Build from the repository root:
+ * \code
+ * cc -std=gnu89 -O2 -Ihost -Isrc -Idrivers -o bench_dtmf host/bench_dtmf.c host/dtmf_gen.c host/cid_gen.c \
+ *    host/resampler_poly.c src/detector*.c src/resampler.c src/digit_state.c src/tone_bank.c src/fsk_cid.c src/sdft.c \
+ *    src/g711.c src/tone_gen.c src/self_test.c src/gtzl.c src/decoder_gtzl.c src/fft.c src/decoder.c src/dtmf_table.c \
+ *    src/complex_g3.c -lm
+ * ./bench_dtmf -o bench_output.txt
+ * ./bench_dtmf --digits 123 --snr 6 --twist -4 --offset 1.5 --tone-ms 50 --gap-ms 50 --rate 44100
+ * \endcode
+ *
+ * Scenarios with an input rate other than G_SAMPLE_RATE are rendered at that rate and go through the resampler of
+ * resampler_poly.c first, fed in blocks of 10 ms like a codec would deliver them. The time spent resampling is
+ * reported per output frame next to the detector time, so the two can be compared.
+ *
+ * Frames are classified against the generated ground truth: a frame covered for at least half of its length by a digit
+ * is a tone frame, a frame that does not touch any digit is a silence frame, anything else is a transition frame and
+ * is only used for the per digit detection.
+ *
+ * The decoded keys are also run through the digit state machine of digit_state.c with its default timings, and the
+ * digits it reports are compared with the generated sequence, which is what the user sees on the display.
+ *
+ * The digit state machine is also checked on its own, on key sequences given frame by frame with the default and with
+ * longer pauses, against the digits they must give.
+ *
+ * The tone bank of tone_bank.c is timed with one more family enabled at each step, which gives the marginal cost of
+ * each family, and checked on a steady tone pair of every family.
+ *
+ * The sliding DFT detector also reports each key change through its callback as soon as it decides it: it is fed in
+ * strides through detector_sdft_stream() as on the board, the delay from the start of each digit to the stride its
+ * key comes in and the key changes that do not start a digit are reported for it.
+ *
+ * The windowed FFTs of FFT_power() are compared with the 512-point rectangular FFT of detector_fft.c on steady keys with
+ * random offsets within 1.5% and random phases: the error of the interpolated tone frequencies against the centre of the
+ * strongest bin for the 512 points, the keys decoded and the time per frame.
+ *
+ * The G.711 input of g711.c is compared with expanding the codes into a frame and decoding it, for every detector on
+ * a few scenarios coded in mu-law and A-law: the time per frame of both, whether the detector has a fused entry, the
+ * detection rate from the codes and the frames where the batch path, or the streaming path fed in packets of 20 ms,
+ * decodes another key than expand-then-decode.
+ *
+ * Caller ID signals rendered by cid_gen.c go through the FSK demodulator of fsk_cid.c frame by frame, which reports its
+ * cost per frame, to compare with the detectors it shares the frames with, and whether the message came out intact.
+ *
+ * The loopback self-test of the board is replayed with the tone generator of tone_gen.c as the source, its samples
+ * rounded to the codes of the DAC: for every detector the digits are scored by self_test.c as on the board, with the
+ * end of the frame a digit is confirmed in as its time, which gives the latency without the wait for the main loop.
+ * For the sliding DFT detector the time is that of the stride its key was decided in, as main.c does.
+ * The generator's own cost per sample, what the DAC interrupt spends, is reported once.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+/* C Library Headers */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "dtmf_table.h"
+#include "complex_g3.h"
+#include "gtzl.h"
+#include "detector.h"
+#include "detector_hybrid.h"
+#include "detector_sdft.h"
+#include "resampler_poly.h"
+#include "digit_state.h"
+#include "tone_bank.h"
+#include "fsk_cid.h"
+#include "sdft.h"
+#include "fft.h"
+#include "decoder.h"
+#include "g711.h"
+#include "tone_gen.h"
+#include "self_test.h"
+#include "dtmf_gen.h"
+#include "cid_gen.h"
+
+#define BENCH_MAX_DIGITS 64
+#define BENCH_DEFAULT_REPEAT 20
+
+/*! \typedef bench_scenario_t
+* \brief A named signal description
+*/
+typedef struct bench_scenario_t
+{
+	const char *name;
+	uint32_t input_rate;	/* Rate the signal is rendered at, resampled to G_SAMPLE_RATE if different */
+	dtmf_gen_params_t params;
+} bench_scenario_t;
+
+static const bench_scenario_t BENCH_SCENARIOS[] = {
+	/* name            rate   digits              amp     snr   twist offset tone  gap  seed */
+	{"clean",         8000,  {"1234567890*#ABCD", 1000.0, 60.0,  0.0,  0.0, 100.0, 100.0, 1}},
+	{"snr_20db",      8000,  {"1234567890*#ABCD", 1000.0, 20.0,  0.0,  0.0, 100.0, 100.0, 2}},
+	{"snr_10db",      8000,  {"1234567890*#ABCD", 1000.0, 10.0,  0.0,  0.0, 100.0, 100.0, 3}},
+	{"snr_3db",       8000,  {"1234567890*#ABCD", 1000.0,  3.0,  0.0,  0.0, 100.0, 100.0, 4}},
+	{"twist_pos_4db", 8000,  {"1234567890*#ABCD", 1000.0, 30.0,  4.0,  0.0, 100.0, 100.0, 5}},
+	{"twist_neg_8db", 8000,  {"1234567890*#ABCD", 1000.0, 30.0, -8.0,  0.0, 100.0, 100.0, 6}},
+	{"offset_1_5pct", 8000,  {"1234567890*#ABCD", 1000.0, 30.0,  0.0,  1.5, 100.0, 100.0, 7}},
+	{"offset_3_5pct", 8000,  {"1234567890*#ABCD", 1000.0, 30.0,  0.0,  3.5, 100.0, 100.0, 8}},
+	{"short_digits",  8000,  {"1234567890*#ABCD", 1000.0, 30.0,  0.0,  0.0,  50.0,  50.0, 9}},
+	{"low_level",     8000,  {"1234567890*#ABCD",  150.0, 30.0,  0.0,  0.0, 100.0, 100.0, 10}},
+	{"silence",       8000,  {"",                 1000.0, 10.0,  0.0,  0.0, 100.0, 5000.0, 11}},
+	{"clean_16k",     16000, {"1234567890*#ABCD", 1000.0, 60.0,  0.0,  0.0, 100.0, 100.0, 12}},
+	{"snr_10db_44k1", 44100, {"1234567890*#ABCD", 1000.0, 10.0,  0.0,  0.0, 100.0, 100.0, 13}},
+	{"snr_10db_48k",  48000, {"1234567890*#ABCD", 1000.0, 10.0,  0.0,  0.0, 100.0, 100.0, 14}}
+};
+
+/* Key changes reported by the callback of detector_sdft during the quality pass */
+typedef struct bench_onset_t
+{
+	char key;
+	uint32_t sample;
+} bench_onset_t;
+
+#define BENCH_MAX_ONSETS 256
+
+static bench_onset_t bench_onsets[BENCH_MAX_ONSETS];
+static int bench_onset_count;
+
+/* Samples stored when the stride being fed would run, counted from the init() of the detector */
+static uint32_t bench_stream_time;
+
+/* Feeds a frame to detector_sdft a stride at a time, as the stride task of main.c does while the reader fills it */
+static void bench_sdft_stream(const complex_g3_t *frame, uint32_t start)
+{
+	int stored;
+
+	for (stored = SDFT_DECISION_STRIDE; stored <= G_ARRAY_SIZE; stored += SDFT_DECISION_STRIDE)
+	{
+		bench_stream_time = start + (uint32_t)stored;
+		detector_sdft_stream(frame, stored);
+	}
+}
+
+/* Last key decided and not scored yet and the time it was decided at, kept like barge_in() of main.c does */
+static char bench_barge_in_onset = SDFT_NO_KEY;
+static uint32_t bench_barge_in_time;
+
+static void bench_sdft_barge_in(void *context, char key, uint32_t sample)
+{
+	(void)context;
+	(void)sample;
+	if (key != SDFT_NO_KEY)
+	{
+		bench_barge_in_onset = key;
+		bench_barge_in_time = bench_stream_time;
+	}
+}
+
+/* Takes the time of the stride the key change came in, not the sample of the decision */
+static void bench_sdft_onset(void *context, char key, uint32_t sample)
+{
+	(void)context;
+	(void)sample;
+	if (key != SDFT_NO_KEY && bench_onset_count < BENCH_MAX_ONSETS)
+	{
+		bench_onsets[bench_onset_count].key = key;
+		bench_onsets[bench_onset_count].sample = bench_stream_time;
+		bench_onset_count++;
+	}
+}
+
+/* Writes the delay from the start of each digit to the first onset of its key, and the onsets that start no digit */
+static void bench_sdft_latency(FILE *out, const dtmf_gen_truth_t *truth, int digits)
+{
+	int used[BENCH_MAX_ONSETS];
+	double total = 0.0, worst = 0.0, latency;
+	int found = 0, false_onsets = 0;
+	int d, o;
+
+	memset(used, 0, sizeof(used));
+	for (d = 0; d < digits; d++)
+	{
+		for (o = 0; o < bench_onset_count; o++)
+		{
+			/* The window holds the digit for SDFT_WINDOW samples after its end */
+			if (bench_onsets[o].key == truth[d].key && bench_onsets[o].sample >= truth[d].start
+				&& bench_onsets[o].sample < truth[d].end + SDFT_WINDOW)
+			{
+				latency = 1000.0 * (bench_onsets[o].sample - truth[d].start) / G_SAMPLE_RATE;
+				total += latency;
+				worst = latency > worst ? latency : worst;
+				found++;
+				used[o] = 1;
+				break;
+			}
+		}
+	}
+	for (o = 0; o < bench_onset_count; o++)
+	{
+		false_onsets += !used[o];
+	}
+	fprintf(out, ", \"onset_latency_ms\": %.2f, \"max_onset_latency_ms\": %.2f, \"false_onsets\": %d",
+		found ? total / found : 0.0, worst, false_onsets);
+}
+
+static char bench_key(struct_tone_frequencies tones)
+{
+	if (tones.low < 0 || tones.high < 0)
+	{
+		return DTMF_GEN_SILENCE;
+	}
+	return dtmf_key_table[tones.low][tones.high];
+}
+
+/* Runs one frame through a detector and returns the decoded key or DTMF_GEN_SILENCE */
+static char bench_detect(const detector_t *detector, complex_g3_t *frame)
+{
+	detector->process_frame(frame);
+	return bench_key(detector->get_tones());
+}
+
+static double bench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* The whole signal is converted to reader frames up front, so the timing pass only measures the decoding path */
+static complex_g3_t *bench_load_frames(const double *samples, unsigned long frames)
+{
+	complex_g3_t *buffer = (complex_g3_t *)malloc((frames + 1) * G_ARRAY_SIZE * sizeof(complex_g3_t));
+	unsigned long i;
+
+	if (buffer == NULL)
+	{
+		fprintf(stderr, "bench_dtmf: out of memory\n");
+		exit(1);
+	}
+	for (i = 0; i < frames * G_ARRAY_SIZE; i++)
+	{
+		buffer[i].re = samples[i];
+		buffer[i].im = 0.0;
+	}
+	return buffer;
+}
+
+/* Converts the rendered signal to G_SAMPLE_RATE in blocks of 10 ms, moves the ground truth to the output time base and
+* returns the best time of the repeated conversions, in ns. The input buffer is replaced by the output one.
+*/
+static double bench_resample(const resampler_filter_t *filter, double **samples, unsigned long *length,
+	dtmf_gen_truth_t *truth, int digits, int repeat)
+{
+	int block = (int)(filter->input_rate / 100);
+	double *output = (double *)malloc(((*length / block + 1) * resampler_max_output(filter, block) + 1) * sizeof(double));
+	double ratio = (double)G_SAMPLE_RATE / (double)filter->input_rate;
+	double best = -1.0;
+	unsigned long produced = 0;
+	resampler_t resampler;
+	int r, d;
+
+	if (output == NULL)
+	{
+		fprintf(stderr, "bench_dtmf: out of memory\n");
+		exit(1);
+	}
+
+	for (r = 0; r < repeat; r++)
+	{
+		double t0 = bench_now_ns();
+		double elapsed;
+		unsigned long i;
+
+		resampler_init(&resampler, filter);
+		produced = 0;
+		for (i = 0; i < *length; i += block)
+		{
+			int count = (*length - i < (unsigned long)block) ? (int)(*length - i) : block;
+
+			produced += resampler_process(&resampler, &(*samples)[i], count, &output[produced]);
+		}
+		elapsed = bench_now_ns() - t0;
+		if (best < 0.0 || elapsed < best)
+		{
+			best = elapsed;
+		}
+	}
+
+	/* The filter delays the signal by its group delay */
+	for (d = 0; d < digits; d++)
+	{
+		truth[d].start = (unsigned long)((truth[d].start + filter->delay) * ratio + 0.5);
+		truth[d].end = (unsigned long)((truth[d].end + filter->delay) * ratio + 0.5);
+	}
+
+	free(*samples);
+	*samples = output;
+	*length = produced;
+	return best;
+}
+
+static void bench_run(FILE *out, const bench_scenario_t *scenario, const detector_t *detector, int repeat, int first)
+{
+	const dtmf_gen_params_t *p = &scenario->params;
+	dtmf_gen_truth_t truth[BENCH_MAX_DIGITS];
+	int digit_hit[BENCH_MAX_DIGITS];
+	unsigned long length = dtmf_gen_length(p, scenario->input_rate);
+	unsigned long frames;
+	unsigned long tone_frames = 0, tone_hits = 0, wrong_frames = 0;
+	unsigned long silence_frames = 0, silence_hits = 0;
+	int digits, digits_hit = 0;
+	char reported[BENCH_MAX_DIGITS + 1];
+	int reported_count = 0;
+	digit_state_config_t timing;
+	digit_state_t digit_state;
+	digit_event_t events[DIGIT_STATE_MAX_EVENTS];
+	int event_count, e;
+	double *samples;
+	complex_g3_t *frame_buffer;
+	double best = -1.0, ns_per_frame, resample_ns = 0.0;
+	unsigned long resample_mults = 0;
+	unsigned long f;
+	int r, d;
+
+	samples = (double *)malloc((length + 1) * sizeof(double));
+	if (samples == NULL)
+	{
+		fprintf(stderr, "bench_dtmf: out of memory\n");
+		exit(1);
+	}
+
+	dtmf_gen_render(p, scenario->input_rate, samples, length, truth, BENCH_MAX_DIGITS);
+	digits = (int)strlen(p->digits);
+	if (digits > BENCH_MAX_DIGITS)
+	{
+		digits = BENCH_MAX_DIGITS;
+	}
+	if (scenario->input_rate != G_SAMPLE_RATE)
+	{
+		const resampler_filter_t *filter = resampler_find(scenario->input_rate);
+
+		if (filter == NULL)
+		{
+			fprintf(stderr, "bench_dtmf: no resampler for %lu Hz\n", (unsigned long)scenario->input_rate);
+			exit(1);
+		}
+		resample_ns = bench_resample(filter, &samples, &length, truth, digits, repeat);
+		resample_mults = (unsigned long)filter->taps * G_ARRAY_SIZE;
+	}
+	frames = length / G_ARRAY_SIZE;
+	memset(digit_hit, 0, sizeof(digit_hit));
+	frame_buffer = bench_load_frames(samples, frames);
+	if (detector == &detector_sdft)
+	{
+		bench_onset_count = 0;
+		detector_sdft_set_callback(bench_sdft_onset, NULL);
+	}
+	detector->init();
+	digit_state_default_config(&timing);
+	digit_state_init(&digit_state, &timing);
+
+	/* Quality pass */
+	for (f = 0; f < frames; f++)
+	{
+		unsigned long start = f * G_ARRAY_SIZE;
+		int partial;
+		char expected = dtmf_gen_truth_at(truth, digits, start, G_ARRAY_SIZE, &partial);
+		char decoded;
+
+		if (detector == &detector_sdft)
+		{
+			bench_sdft_stream(&frame_buffer[start], (uint32_t)start);
+		}
+		decoded = bench_detect(detector, &frame_buffer[start]);
+		event_count = digit_state_update(&digit_state, decoded, events);
+		for (e = 0; e < event_count; e++)
+		{
+			if (events[e].type == DIGIT_EVENT_PRESS && reported_count < BENCH_MAX_DIGITS)
+			{
+				reported[reported_count++] = events[e].key;
+			}
+		}
+
+		if (expected != DTMF_GEN_SILENCE)
+		{
+			tone_frames++;
+			if (decoded == expected)
+			{
+				tone_hits++;
+			}
+			else if (decoded != DTMF_GEN_SILENCE)
+			{
+				wrong_frames++;
+			}
+		}
+		else if (!partial)
+		{
+			silence_frames++;
+			if (decoded != DTMF_GEN_SILENCE)
+			{
+				silence_hits++;
+			}
+		}
+
+		for (d = 0; d < digits; d++)
+		{
+			if (truth[d].start < start + G_ARRAY_SIZE && truth[d].end > start && decoded == truth[d].key)
+			{
+				digit_hit[d] = 1;
+			}
+		}
+	}
+	for (d = 0; d < digits; d++)
+	{
+		digits_hit += digit_hit[d];
+	}
+	reported[reported_count] = '\0';
+	if (detector == &detector_sdft)
+	{
+		detector_sdft_set_callback(NULL, NULL);
+	}
+
+	/* Timing pass, the best of the repetitions is kept to filter out scheduler noise */
+	for (r = 0; r < repeat; r++)
+	{
+		double t0 = bench_now_ns();
+		double elapsed;
+
+		for (f = 0; f < frames; f++)
+		{
+			bench_detect(detector, &frame_buffer[f * G_ARRAY_SIZE]);
+		}
+		elapsed = bench_now_ns() - t0;
+		if (best < 0.0 || elapsed < best)
+		{
+			best = elapsed;
+		}
+	}
+	ns_per_frame = (frames > 0 && best > 0.0) ? best / (double)frames : 0.0;
+
+	fprintf(out, "%s    {\"scenario\": \"%s\", \"detector\": \"%s\", \"detector_id\": %d,\n",
+		first ? "" : ",\n", scenario->name, detector->name, detector->id);
+	fprintf(out, "     \"signal\": {\"input_rate\": %lu, \"digits\": \"%s\", \"amplitude\": %.3f, \"snr_db\": %.3f, \"twist_db\": %.3f, "
+		"\"freq_offset_pct\": %.3f, \"tone_ms\": %.3f, \"gap_ms\": %.3f, \"seed\": %lu},\n",
+		(unsigned long)scenario->input_rate, p->digits, p->amplitude, p->snr_db, p->twist_db, p->freq_offset_pct, p->tone_ms, p->gap_ms, p->seed);
+	fprintf(out, "     \"frames\": %lu, \"tone_frames\": %lu, \"silence_frames\": %lu, \"digits\": %d,\n",
+		frames, tone_frames, silence_frames, digits);
+	fprintf(out, "     \"ns_per_frame\": %.1f, \"frames_per_s\": %.1f, \"resample_ns_per_frame\": %.1f, "
+		"\"resample_mults_per_frame\": %lu, \"memory_bytes\": %lu, \"mults_per_frame\": %lu,\n",
+		ns_per_frame, ns_per_frame > 0.0 ? 1e9 / ns_per_frame : 0.0, frames > 0 ? resample_ns / (double)frames : 0.0,
+		resample_mults,
+		(unsigned long)detector->memory_footprint(), (unsigned long)detector->cost_estimate());
+	fprintf(out, "     \"detection_rate\": %.4f, \"digit_detection_rate\": %.4f, \"false_positive_rate\": %.4f, "
+		"\"wrong_key_rate\": %.4f,\n",
+		tone_frames ? (double)tone_hits / tone_frames : 0.0,
+		digits ? (double)digits_hit / digits : 0.0,
+		silence_frames ? (double)silence_hits / silence_frames : 0.0,
+		tone_frames ? (double)wrong_frames / tone_frames : 0.0);
+	fprintf(out, "     \"reported_digits\": \"%s\", \"sequence_ok\": %d",
+		reported, strncmp(reported, p->digits, BENCH_MAX_DIGITS) == 0 && (int)strlen(p->digits) == reported_count);
+	if (detector == &detector_hybrid)
+	{
+		uint32_t hybrid_frames, hybrid_escalated;
+
+		detector_hybrid_stats(&hybrid_frames, &hybrid_escalated);
+		fprintf(out, ", \"escalation_rate\": %.4f", hybrid_frames ? (double)hybrid_escalated / hybrid_frames : 0.0);
+	}
+	if (detector == &detector_sdft)
+	{
+		bench_sdft_latency(out, truth, digits);
+	}
+	fprintf(out, "}");
+
+	free(frame_buffer);
+	free(samples);
+}
+
+/* Names of the tone bank families, in tone_family_t order */
+static const char *const BENCH_FAMILIES[TONE_FAMILY_AMT] = {"dtmf", "call_progress", "fax", "mf"};
+
+/* A tone bank check: a steady pair of tones and what the bank must report for it */
+typedef struct bench_bank_check_t
+{
+	const char *name;
+	double f1, f2;	/* Tones in Hz, f2 = 0 for a single tone */
+	tone_family_t family;
+	int expected;	/* call_progress_t, fax_tone_t, MF digit or DTMF key */
+} bench_bank_check_t;
+
+static const bench_bank_check_t BENCH_BANK_CHECKS[] = {
+	{"dial",     350.0,  440.0, TONE_FAMILY_CALL_PROGRESS, CALL_PROGRESS_DIAL},
+	{"ringback", 440.0,  480.0, TONE_FAMILY_CALL_PROGRESS, CALL_PROGRESS_RINGBACK},
+	{"busy",     480.0,  620.0, TONE_FAMILY_CALL_PROGRESS, CALL_PROGRESS_BUSY},
+	{"fax_cng",  1100.0, 0.0,   TONE_FAMILY_FAX,           FAX_TONE_CNG},
+	{"fax_ced",  2100.0, 0.0,   TONE_FAMILY_FAX,           FAX_TONE_CED},
+	{"mf_5",     900.0,  1300.0, TONE_FAMILY_MF,           '5'},
+	{"mf_kp",    1100.0, 1700.0, TONE_FAMILY_MF,           'K'},
+	{"dtmf_5",   770.0,  1336.0, TONE_FAMILY_DTMF,         '5'}
+};
+
+/* Renders one frame of a steady pair of tones */
+static void bench_render_pair(complex_g3_t *frame, double f1, double f2, double amplitude)
+{
+	int i;
+
+	for (i = 0; i < G_ARRAY_SIZE; i++)
+	{
+		double t = (double)i / G_SAMPLE_RATE;
+
+		frame[i].re = amplitude * sin(2.0 * G_PI * f1 * t) + (f2 > 0.0 ? amplitude * sin(2.0 * G_PI * f2 * t) : 0.0);
+		frame[i].im = 0.0;
+	}
+}
+
+/* Returns what the bank reports for the family of a check */
+static int bench_bank_outcome(const tone_bank_t *bank, tone_family_t family)
+{
+	switch (family)
+	{
+	case TONE_FAMILY_CALL_PROGRESS:
+		return bank->result.call_progress;
+	case TONE_FAMILY_FAX:
+		return bank->result.fax;
+	case TONE_FAMILY_MF:
+		return bank->result.mf;
+	default:
+		return bench_key(bank->result.dtmf);
+	}
+}
+
+/* Cost of the tone bank with one more family enabled at each step on the frames of the first scenario, so the
+* marginal cost of each family can be read, then a detection check of every family */
+static void bench_tone_bank(FILE *out, int repeat)
+{
+	const dtmf_gen_params_t *p = &BENCH_SCENARIOS[0].params;
+	unsigned long length = dtmf_gen_length(p, G_SAMPLE_RATE);
+	unsigned long frames = length / G_ARRAY_SIZE;
+	dtmf_gen_truth_t truth[BENCH_MAX_DIGITS];
+	complex_g3_t check_frame[G_ARRAY_SIZE];
+	complex_g3_t *frame_buffer;
+	double *samples;
+	double previous = 0.0;
+	tone_bank_t bank;
+	unsigned f;
+	int family, r, c, ok;
+
+	samples = (double *)malloc((length + 1) * sizeof(double));
+	if (samples == NULL)
+	{
+		fprintf(stderr, "bench_dtmf: out of memory\n");
+		exit(1);
+	}
+	dtmf_gen_render(p, G_SAMPLE_RATE, samples, length, truth, BENCH_MAX_DIGITS);
+	frame_buffer = bench_load_frames(samples, frames);
+
+	fprintf(out, "  \"tone_bank\": {\n    \"costs\": [\n");
+	for (family = 0; family < TONE_FAMILY_AMT; family++)
+	{
+		double best = -1.0, ns_per_frame;
+
+		tone_bank_init(&bank, (1u << (family + 1)) - 1);
+		for (r = 0; r < repeat; r++)
+		{
+			double t0 = bench_now_ns();
+			double elapsed;
+
+			for (f = 0; f < frames; f++)
+			{
+				tone_bank_process(&bank, &frame_buffer[f * G_ARRAY_SIZE]);
+			}
+			elapsed = bench_now_ns() - t0;
+			if (best < 0.0 || elapsed < best)
+			{
+				best = elapsed;
+			}
+		}
+		ns_per_frame = (frames > 0 && best > 0.0) ? best / (double)frames : 0.0;
+		fprintf(out, "%s      {\"added_family\": \"%s\", \"bins\": %d, \"mults_per_frame\": %lu, \"ns_per_frame\": %.1f, "
+			"\"marginal_ns_per_frame\": %.1f}",
+			family ? ",\n" : "", BENCH_FAMILIES[family], bank.bin_count, (unsigned long)tone_bank_mults(&bank),
+			ns_per_frame, ns_per_frame - previous);
+		previous = ns_per_frame;
+	}
+
+	fprintf(out, "\n    ],\n    \"checks\": {");
+	tone_bank_init(&bank, TONE_BANK_ALL_FAMILIES);
+	for (c = 0; c < (int)(sizeof(BENCH_BANK_CHECKS) / sizeof(BENCH_BANK_CHECKS[0])); c++)
+	{
+		const bench_bank_check_t *check = &BENCH_BANK_CHECKS[c];
+
+		bench_render_pair(check_frame, check->f1, check->f2, p->amplitude);
+		tone_bank_process(&bank, check_frame);
+		ok = bench_bank_outcome(&bank, check->family) == check->expected;
+		fprintf(out, "%s\"%s\": %d", c ? ", " : "", check->name, ok);
+	}
+	fprintf(out, "}\n  },\n");
+
+	free(frame_buffer);
+	free(samples);
+}
+
+/* A digit state machine check: keys frame by frame, '.' for none, and the events they must give, '+' for a press and
+* '-' for a release followed by the key */
+typedef struct bench_digit_check_t
+{
+	const char *name;
+	uint32_t min_on, min_off, hysteresis;
+	const char *keys;
+	const char *expected;
+} bench_digit_check_t;
+
+static const bench_digit_check_t BENCH_DIGIT_CHECKS[] = {
+	{"defaults",           DIGIT_STATE_MIN_ON_FRAMES, DIGIT_STATE_MIN_OFF_FRAMES, DIGIT_STATE_HYSTERESIS_FRAMES,
+		"11.11..11", "+1-1+1-1"},
+	{"next_key",           DIGIT_STATE_MIN_ON_FRAMES, DIGIT_STATE_MIN_OFF_FRAMES, DIGIT_STATE_HYSTERESIS_FRAMES,
+		"11222", "+1-1+2-2"},
+	/* A key back before the end of a long pause is held back, not dropped */
+	{"min_off_same_key",   2, 3, 1, "11..1111111111", "+1-1+1-1"},
+	{"min_off_other_key",  2, 4, 1, "11.22222", "+1-1+2-2"},
+	{"min_off_short_key",  2, 4, 1, "11..2.33", "+1-1+3-3"}
+};
+
+/* Runs the keys of a check through the digit state machine and compares its events, a silent frame at the end
+* releasing the last digit */
+static int bench_digit_check(const bench_digit_check_t *check)
+{
+	digit_state_config_t timing;
+	digit_state_t state;
+	digit_event_t events[DIGIT_STATE_MAX_EVENTS];
+	char got[64];
+	size_t used = 0;
+	int count, e, i, frames = (int)strlen(check->keys) + (int)check->hysteresis + 1;
+
+	digit_state_default_config(&timing);
+	timing.min_on = check->min_on;
+	timing.min_off = check->min_off;
+	timing.hysteresis = check->hysteresis;
+	digit_state_init(&state, &timing);
+	for (i = 0; i < frames; i++)
+	{
+		char key = (i < (int)strlen(check->keys) && check->keys[i] != '.') ? check->keys[i] : DIGIT_STATE_NO_KEY;
+
+		count = digit_state_update(&state, key, events);
+		for (e = 0; e < count && used + 2 < sizeof(got); e++)
+		{
+			got[used++] = events[e].type == DIGIT_EVENT_PRESS ? '+' : '-';
+			got[used++] = events[e].key;
+		}
+	}
+	got[used] = '\0';
+	return strcmp(got, check->expected) == 0;
+}
+
+static void bench_digit_state(FILE *out)
+{
+	int c;
+
+	fprintf(out, "  \"digit_state\": {\"checks\": {");
+	for (c = 0; c < (int)(sizeof(BENCH_DIGIT_CHECKS) / sizeof(BENCH_DIGIT_CHECKS[0])); c++)
+	{
+		fprintf(out, "%s\"%s\": %d", c ? ", " : "", BENCH_DIGIT_CHECKS[c].name, bench_digit_check(&BENCH_DIGIT_CHECKS[c]));
+	}
+	fprintf(out, "}},\n");
+}
+
+/*! \typedef bench_fft_config_t
+* \brief An FFT size and window compared by bench_fft_accuracy()
+*/
+typedef struct bench_fft_config_t
+{
+	const char *name;
+	int n;
+	fft_window_t window;
+} bench_fft_config_t;
+
+/* The first one is the path of detector_fft.c, which is read at the centre of its strongest bin */
+static const bench_fft_config_t BENCH_FFT_CONFIGS[] = {
+	{"512_rectangular", 512, FFT_WINDOW_RECTANGULAR},
+	{"256_hann",        256, FFT_WINDOW_HANN},
+	{"256_blackman",    256, FFT_WINDOW_BLACKMAN},
+	{"128_hann",        128, FFT_WINDOW_HANN},
+	{"128_blackman",    128, FFT_WINDOW_BLACKMAN}
+};
+
+#define BENCH_FFT_TRIALS 256
+#define BENCH_FFT_MAX_OFFSET 0.015
+
+/* Uniform value in [0, 1) from a linear congruential generator, so the trials are the same on every host */
+static double bench_uniform(unsigned long *state)
+{
+	*state = (*state * 1103515245UL + 12345UL) & 0x7fffffffUL;
+	return (double)*state / 2147483648.0;
+}
+
+/* Frequency of the strongest bin between low and high, the resolution of decode_dtmf() */
+static double bench_bin_frequency(const double *power, int n, double low, double high)
+{
+	int i, best = -1;
+
+	for (i = 1; i < n / 2; i++)
+	{
+		double frequency = (double)G_SAMPLE_RATE * i / n;
+
+		if (frequency >= low && frequency <= high && (best < 0 || power[i] > power[best]))
+		{
+			best = i;
+		}
+	}
+	return best < 0 ? -1.0 : (double)G_SAMPLE_RATE * best / n;
+}
+
+/* Frequency error and cost of each FFT size and window on steady keys */
+static void bench_fft_accuracy(FILE *out, int repeat)
+{
+	complex_g3_t *frames;
+	double tone[BENCH_FFT_TRIALS][2];
+	int keys[BENCH_FFT_TRIALS];
+	unsigned long state = 42;
+	int c, t, i, g, r;
+
+	frames = (complex_g3_t *)malloc((size_t)BENCH_FFT_TRIALS * G_ARRAY_SIZE * sizeof(complex_g3_t));
+	if (frames == NULL)
+	{
+		fprintf(stderr, "bench_dtmf: out of memory\n");
+		exit(1);
+	}
+	for (t = 0; t < BENCH_FFT_TRIALS; t++)
+	{
+		double phase[2];
+
+		keys[t] = t % 16;
+		for (g = 0; g < 2; g++)
+		{
+			tone[t][g] = (double)(g ? dtmf_high_freqs[keys[t] & 3] : dtmf_low_freqs[keys[t] >> 2]) * (1.0 + BENCH_FFT_MAX_OFFSET * (2.0 * bench_uniform(&state) - 1.0));
+			phase[g] = 2.0 * G_PI * bench_uniform(&state);
+		}
+		for (i = 0; i < G_ARRAY_SIZE; i++)
+		{
+			complex_g3_t *x = &frames[t * G_ARRAY_SIZE + i];
+
+			x->re = 1000.0 * (sin(2.0 * G_PI * tone[t][0] * i / G_SAMPLE_RATE + phase[0])
+				+ sin(2.0 * G_PI * tone[t][1] * i / G_SAMPLE_RATE + phase[1]));
+			x->im = 0.0;
+		}
+	}
+
+	fprintf(out, "  \"fft_accuracy\": [\n");
+	for (c = 0; c < (int)(sizeof(BENCH_FFT_CONFIGS) / sizeof(BENCH_FFT_CONFIGS[0])); c++)
+	{
+		const bench_fft_config_t *config = &BENCH_FFT_CONFIGS[c];
+		double gain = FFT_window_gain(config->window);
+		double squares = 0.0, worst = 0.0, best = -1.0;
+		int keys_ok = 0;
+
+		for (t = 0; t < BENCH_FFT_TRIALS; t++)
+		{
+			const double *power = FFT_power(&frames[t * G_ARRAY_SIZE], G_ARRAY_SIZE, config->n, config->window);
+			struct_tone_frequencies tones = decode_dtmf_power(power, G_SAMPLE_RATE, config->n, gain);
+
+			for (g = 0; g < 2; g++)
+			{
+				double low = (double)(g ? dtmf_high_freqs[0] : dtmf_low_freqs[0]) * (1.0 - BENCH_FFT_MAX_OFFSET) - 20.0;
+				double high = (double)(g ? dtmf_high_freqs[3] : dtmf_low_freqs[3]) * (1.0 + BENCH_FFT_MAX_OFFSET) + 20.0;
+				double estimate = c == 0 ? bench_bin_frequency(power, config->n, low, high)
+					: decode_peak_frequency(power, G_SAMPLE_RATE, config->n, low, high, NULL);
+				double error = fabs(estimate - tone[t][g]);
+
+				squares += error * error;
+				worst = error > worst ? error : worst;
+			}
+			if (c == 0)
+			{
+				tones = decode_dtmf(FFT_simple(&frames[t * G_ARRAY_SIZE], G_ARRAY_SIZE));
+			}
+			keys_ok += tones.low == keys[t] >> 2 && tones.high == (keys[t] & 3);
+		}
+
+		/* The 512 points are timed on the detector_fft.c path, FFT_simple() and decode_dtmf() */
+		for (r = 0; r < repeat; r++)
+		{
+			double t0 = bench_now_ns();
+			double elapsed;
+
+			for (t = 0; t < BENCH_FFT_TRIALS; t++)
+			{
+				if (c == 0)
+				{
+					decode_dtmf(FFT_simple(&frames[t * G_ARRAY_SIZE], G_ARRAY_SIZE));
+				}
+				else
+				{
+					decode_dtmf_power(FFT_power(&frames[t * G_ARRAY_SIZE], G_ARRAY_SIZE, config->n, config->window),
+						G_SAMPLE_RATE, config->n, gain);
+				}
+			}
+			elapsed = bench_now_ns() - t0;
+			if (best < 0.0 || elapsed < best)
+			{
+				best = elapsed;
+			}
+		}
+
+		fprintf(out, "%s    {\"fft\": \"%s\", \"points\": %d, \"bin_hz\": %.2f, \"rms_error_hz\": %.2f, \"max_error_hz\": %.2f, "
+			"\"key_rate\": %.4f, \"ns_per_frame\": %.1f}",
+			c ? ",\n" : "", config->name, config->n, (double)G_SAMPLE_RATE / config->n,
+			sqrt(squares / (2 * BENCH_FFT_TRIALS)), worst, (double)keys_ok / BENCH_FFT_TRIALS, best / BENCH_FFT_TRIALS);
+	}
+	fprintf(out, "\n  ],\n");
+	free(frames);
+}
+
+/* Scenarios of BENCH_SCENARIOS[] coded in G.711, the rate must be G_SAMPLE_RATE */
+static const char *const BENCH_G711_SCENARIOS[] = {"clean", "snr_10db", "low_level"};
+
+/* Codes per packet of the streaming path, 20 ms as in most RTP streams */
+#define BENCH_G711_PACKET 160
+
+static char bench_g711_stream_keys[BENCH_MAX_DIGITS * 64];
+static unsigned long bench_g711_stream_count;
+
+static void bench_g711_stream_key(void *context, struct_tone_frequencies tones)
+{
+	(void)context;
+	if (bench_g711_stream_count < sizeof(bench_g711_stream_keys))
+	{
+		bench_g711_stream_keys[bench_g711_stream_count] = bench_key(tones);
+	}
+	bench_g711_stream_count++;
+}
+
+/* Codes each sample to the code of the law whose expansion is nearest, as a codec would */
+static unsigned char *bench_g711_encode(const float *table, const double *samples, unsigned long length)
+{
+	unsigned char *codes = (unsigned char *)malloc(length + 1);
+	unsigned long i;
+	int c, best;
+
+	if (codes == NULL)
+	{
+		fprintf(stderr, "bench_dtmf: out of memory\n");
+		exit(1);
+	}
+	for (i = 0; i < length; i++)
+	{
+		best = 0;
+		for (c = 1; c < 256; c++)
+		{
+			if (fabs(table[c] - samples[i]) < fabs(table[best] - samples[i]))
+			{
+				best = c;
+			}
+		}
+		codes[i] = (unsigned char)best;
+	}
+	return codes;
+}
+
+/* Times the fused G.711 path of every detector against expand-then-decode and checks they agree */
+static void bench_g711(FILE *out, int repeat)
+{
+	static const char *const LAW_NAMES[] = {"ulaw", "alaw"};
+	dtmf_gen_truth_t truth[BENCH_MAX_DIGITS];
+	complex_g3_t frame[G_ARRAY_SIZE];
+	g711_stream_t stream;
+	const bench_scenario_t *scenario;
+	const float *table;
+	unsigned char *codes;
+	char *keys;
+	double *samples;
+	unsigned long length, frames, f, tone_frames, tone_hits, mismatches, stream_mismatches;
+	int s, i, law, j, r, digits, partial, first = 1;
+
+	fprintf(out, "  \"g711\": [\n");
+	for (s = 0; s < (int)(sizeof(BENCH_G711_SCENARIOS) / sizeof(BENCH_G711_SCENARIOS[0])); s++)
+	{
+		scenario = NULL;
+		for (i = 0; i < (int)(sizeof(BENCH_SCENARIOS) / sizeof(BENCH_SCENARIOS[0])); i++)
+		{
+			if (strcmp(BENCH_SCENARIOS[i].name, BENCH_G711_SCENARIOS[s]) == 0)
+			{
+				scenario = &BENCH_SCENARIOS[i];
+			}
+		}
+		if (scenario == NULL || scenario->input_rate != G_SAMPLE_RATE)
+		{
+			continue;
+		}
+		length = dtmf_gen_length(&scenario->params, G_SAMPLE_RATE);
+		frames = length / G_ARRAY_SIZE;
+		samples = (double *)malloc((length + 1) * sizeof(double));
+		keys = (char *)malloc(frames + 1);
+		if (samples == NULL || keys == NULL)
+		{
+			fprintf(stderr, "bench_dtmf: out of memory\n");
+			exit(1);
+		}
+		dtmf_gen_render(&scenario->params, G_SAMPLE_RATE, samples, length, truth, BENCH_MAX_DIGITS);
+		digits = (int)strlen(scenario->params.digits);
+		if (digits > BENCH_MAX_DIGITS)
+		{
+			digits = BENCH_MAX_DIGITS;
+		}
+
+		for (law = G711_ULAW; law <= G711_ALAW; law++)
+		{
+			table = g711_table((g711_law_t)law);
+			codes = bench_g711_encode(table, samples, length);
+
+			for (j = 0; j < g_detector_count; j++)
+			{
+				const detector_t *detector = g_detectors[j];
+				double expand_best = -1.0, fused_best = -1.0, t0, elapsed;
+
+				/* Reference keys, expanded into a frame then decoded */
+				detector->init();
+				for (f = 0; f < frames; f++)
+				{
+					g711_expand(table, &codes[f * G_ARRAY_SIZE], G_ARRAY_SIZE, frame);
+					keys[f] = bench_detect(detector, frame);
+				}
+
+				/* Batch path */
+				detector->init();
+				tone_frames = tone_hits = mismatches = 0;
+				for (f = 0; f < frames; f++)
+				{
+					char expected = dtmf_gen_truth_at(truth, digits, f * G_ARRAY_SIZE, G_ARRAY_SIZE, &partial);
+					char decoded = bench_key(g711_detect(detector, table, &codes[f * G_ARRAY_SIZE], frame));
+
+					mismatches += decoded != keys[f];
+					if (expected != DTMF_GEN_SILENCE)
+					{
+						tone_frames++;
+						tone_hits += decoded == expected;
+					}
+				}
+
+				/* Streaming path, in packets that do not line up with the frames */
+				g711_stream_init(&stream, detector, (g711_law_t)law, frame);
+				g711_stream_set_callback(&stream, bench_g711_stream_key, NULL);
+				bench_g711_stream_count = 0;
+				for (f = 0; f < length; f += BENCH_G711_PACKET)
+				{
+					g711_stream_push(&stream, &codes[f], (int)(length - f < BENCH_G711_PACKET ? length - f : BENCH_G711_PACKET));
+				}
+				stream_mismatches = bench_g711_stream_count != frames;
+				for (f = 0; f < frames && f < bench_g711_stream_count && f < sizeof(bench_g711_stream_keys); f++)
+				{
+					stream_mismatches += bench_g711_stream_keys[f] != keys[f];
+				}
+
+				for (r = 0; r < repeat; r++)
+				{
+					t0 = bench_now_ns();
+					for (f = 0; f < frames; f++)
+					{
+						g711_expand(table, &codes[f * G_ARRAY_SIZE], G_ARRAY_SIZE, frame);
+						detector->process_frame(frame);
+					}
+					elapsed = bench_now_ns() - t0;
+					if (expand_best < 0.0 || elapsed < expand_best)
+					{
+						expand_best = elapsed;
+					}
+
+					t0 = bench_now_ns();
+					for (f = 0; f < frames; f++)
+					{
+						g711_detect(detector, table, &codes[f * G_ARRAY_SIZE], frame);
+					}
+					elapsed = bench_now_ns() - t0;
+					if (fused_best < 0.0 || elapsed < fused_best)
+					{
+						fused_best = elapsed;
+					}
+				}
+
+				fprintf(out, "%s    {\"scenario\": \"%s\", \"law\": \"%s\", \"detector\": \"%s\", \"fused\": %d, \"frames\": %lu, "
+					"\"expand_ns_per_frame\": %.1f, \"fused_ns_per_frame\": %.1f, \"detection_rate\": %.4f, "
+					"\"mismatches\": %lu, \"stream_mismatches\": %lu}",
+					first ? "" : ",\n", scenario->name, LAW_NAMES[law], detector->name, detector->process_g711 != NULL,
+					frames, frames > 0 ? expand_best / (double)frames : 0.0, frames > 0 ? fused_best / (double)frames : 0.0,
+					tone_frames ? (double)tone_hits / tone_frames : 0.0, mismatches, stream_mismatches);
+				first = 0;
+			}
+			free(codes);
+		}
+		free(keys);
+		free(samples);
+	}
+	fprintf(out, "\n  ],\n");
+}
+
+/*! \typedef bench_cid_scenario_t
+* \brief A named caller ID signal and the message it carries
+*/
+typedef struct bench_cid_scenario_t
+{
+	const char *name;
+	int mdmf;	/* 1 for an MDMF message, 0 for SDMF */
+	const char *number;	/* Number, or "O" / "P" */
+	const char *caller;	/* Name for MDMF, NULL to leave it out */
+	cid_gen_params_t params;
+} bench_cid_scenario_t;
+
+#define BENCH_CID_DATE_TIME "10191432"
+
+static const bench_cid_scenario_t BENCH_CID_SCENARIOS[] = {
+	/* name                   mdmf number        name            v23 amp     snr   freq  baud  seiz mark lead  seed */
+	{"bell202_sdmf",          0, "5551234567",   NULL,           {0, 1000.0, 60.0,  0.0,  0.0, 300, 180, 300.0, 21}},
+	{"bell202_mdmf",          1, "5551234567",   "GIUNTA GIOELE", {0, 1000.0, 60.0,  0.0,  0.0, 300, 180, 300.0, 22}},
+	{"bell202_mdmf_private",  1, "P",            "P",            {0, 1000.0, 60.0,  0.0,  0.0, 300, 180, 300.0, 23}},
+	{"bell202_mdmf_snr_15db", 1, "5551234567",   "GIUNTA GIOELE", {0, 1000.0, 15.0,  0.0,  0.0, 300, 180, 300.0, 24}},
+	{"bell202_mdmf_snr_10db", 1, "5551234567",   "GIUNTA GIOELE", {0, 1000.0, 10.0,  0.0,  0.0, 300, 180, 300.0, 29}},
+	{"bell202_mdmf_offset",   1, "5551234567",   "GIUNTA GIOELE", {0, 1000.0, 30.0,  1.5,  1.0, 300, 180, 300.0, 25}},
+	{"bell202_low_level",     1, "5551234567",   "GIUNTA GIOELE", {0,  150.0, 30.0,  0.0,  0.0, 300, 180, 300.0, 26}},
+	{"v23_mdmf",              1, "01632960123",  "GIUNTA GIOELE", {1, 1000.0, 60.0,  0.0,  0.0,  96,  55, 300.0, 27}},
+	{"v23_mdmf_snr_15db",     1, "01632960123",  "GIUNTA GIOELE", {1, 1000.0, 15.0,  0.0, -1.0,  96,  55, 300.0, 28}}
+};
+
+/* Returns 1 if the decoded message carries the fields of the scenario */
+static int bench_cid_fields_ok(const bench_cid_scenario_t *scenario, const fsk_cid_message_t *message)
+{
+	int private_number = strcmp(scenario->number, "O") == 0 || strcmp(scenario->number, "P") == 0;
+
+	if (message->type != (scenario->mdmf ? FSK_CID_MDMF : FSK_CID_SDMF) || strcmp(message->date_time, BENCH_CID_DATE_TIME) != 0)
+	{
+		return 0;
+	}
+	if (private_number ? message->number_absent != scenario->number[0] : strcmp(message->number, scenario->number) != 0)
+	{
+		return 0;
+	}
+	if (scenario->caller == NULL)
+	{
+		return message->name[0] == '\0' && message->name_absent == 0;
+	}
+	if (strcmp(scenario->caller, "O") == 0 || strcmp(scenario->caller, "P") == 0)
+	{
+		return message->name_absent == scenario->caller[0];
+	}
+	return strcmp(message->name, scenario->caller) == 0;
+}
+
+/* Runs every caller ID scenario through the FSK demodulator, one reader frame at a time */
+static void bench_caller_id(FILE *out, int repeat)
+{
+	unsigned char message[CID_GEN_MAX_MESSAGE];
+	complex_g3_t *frame_buffer;
+	double *samples;
+	fsk_cid_t cid;
+	unsigned long length, frames, f;
+	int i, r, size, decoded, fields_ok;
+
+	fprintf(out, "  \"caller_id\": [\n");
+	for (i = 0; i < (int)(sizeof(BENCH_CID_SCENARIOS) / sizeof(BENCH_CID_SCENARIOS[0])); i++)
+	{
+		const bench_cid_scenario_t *scenario = &BENCH_CID_SCENARIOS[i];
+		double best = -1.0;
+
+		size = scenario->mdmf ? cid_gen_mdmf(message, BENCH_CID_DATE_TIME, scenario->number, scenario->caller)
+			: cid_gen_sdmf(message, BENCH_CID_DATE_TIME, scenario->number);
+		length = cid_gen_length(&scenario->params, size, G_SAMPLE_RATE);
+		frames = length / G_ARRAY_SIZE;
+		samples = (double *)malloc((length + 1) * sizeof(double));
+		if (samples == NULL)
+		{
+			fprintf(stderr, "bench_dtmf: out of memory\n");
+			exit(1);
+		}
+		cid_gen_render(&scenario->params, message, size, G_SAMPLE_RATE, samples, length);
+		frame_buffer = bench_load_frames(samples, frames);
+
+		decoded = 0;
+		fields_ok = 0;
+		for (r = 0; r < repeat; r++)
+		{
+			double t0, elapsed;
+
+			fsk_cid_init(&cid, scenario->params.v23 ? FSK_CID_V23 : FSK_CID_BELL202, FSK_CID_DEFAULT_LEVEL);
+			decoded = 0;
+			t0 = bench_now_ns();
+			for (f = 0; f < frames; f++)
+			{
+				if (fsk_cid_process(&cid, &frame_buffer[f * G_ARRAY_SIZE], G_ARRAY_SIZE))
+				{
+					decoded++;
+					fields_ok = bench_cid_fields_ok(scenario, &cid.message);
+				}
+			}
+			elapsed = bench_now_ns() - t0;
+			if (best < 0.0 || elapsed < best)
+			{
+				best = elapsed;
+			}
+		}
+
+		fprintf(out, "%s    {\"scenario\": \"%s\", \"frames\": %lu, \"ns_per_frame\": %.1f, \"decoded\": %d, "
+			"\"fields_ok\": %d, \"checksum_errors\": %lu, \"framing_errors\": %lu}",
+			i ? ",\n" : "", scenario->name, frames, (frames > 0 && best > 0.0) ? best / (double)frames : 0.0,
+			decoded, fields_ok, (unsigned long)cid.checksum_errors, (unsigned long)cid.framing_errors);
+
+		free(frame_buffer);
+		free(samples);
+	}
+	fprintf(out, "\n  ],\n");
+}
+
+/*! \typedef bench_loopback_scenario_t
+* \brief A sequence played by the tone generator
+*/
+typedef struct bench_loopback_scenario_t
+{
+	const char *name;
+	uint16_t tone_ms;
+	uint16_t gap_ms;
+	int16_t level;	/* Peak of each tone, out of TONE_GEN_FULL_SCALE */
+} bench_loopback_scenario_t;
+
+static const bench_loopback_scenario_t BENCH_LOOPBACK_SCENARIOS[] = {
+	{"default", TONE_GEN_DEFAULT_TONE_MS, TONE_GEN_DEFAULT_GAP_MS, TONE_GEN_DEFAULT_LEVEL},
+	{"short_digits", 50, 50, TONE_GEN_DEFAULT_LEVEL},
+	{"low_level", TONE_GEN_DEFAULT_TONE_MS, TONE_GEN_DEFAULT_GAP_MS, TONE_GEN_DEFAULT_LEVEL / 4}
+};
+
+/* Next sample of the generator as the reader would get it back: rounded to the DAC codes of self_test_lpc.c, the DAC
+* wired to the ADC with the same reference, and scaled by the nominal calibration */
+static double bench_loopback_sample(tone_gen_t *gen)
+{
+	int32_t code = tone_gen_next(gen) >> (16 - DAC_BITS);
+
+	return code * (double)(1 << (ADC_BITS - DAC_BITS)) * (G_MAX_AMPLITUDE / ADC_MASK);
+}
+
+/* Plays the self-test sequence through every detector and scores it like the board does */
+static void bench_loopback(FILE *out, int repeat)
+{
+	complex_g3_t frame[G_ARRAY_SIZE];
+	tone_gen_config_t config;
+	tone_gen_t gen;
+	self_test_t test;
+	digit_state_config_t timing;
+	digit_state_t digit_state;
+	digit_event_t events[DIGIT_STATE_MAX_EVENTS];
+	uint32_t queued;
+	double best = -1.0, t0, elapsed;
+	unsigned long samples;
+	int s, j, i, r, e, event_count, flush, first = 1;
+
+	/* Cost of the generator alone, 16 frames of the sequence per pass */
+	tone_gen_default_config(&config, SELF_TEST_DIGITS);
+	config.loop = 1;
+	for (r = 0; r < repeat; r++)
+	{
+		tone_gen_init(&gen, &config);
+		t0 = bench_now_ns();
+		for (i = 0; i < 16; i++)
+		{
+			tone_gen_render(&gen, frame, G_ARRAY_SIZE);
+		}
+		elapsed = bench_now_ns() - t0;
+		if (best < 0.0 || elapsed < best)
+		{
+			best = elapsed;
+		}
+	}
+	fprintf(out, "  \"loopback\": {\n    \"generator_ns_per_sample\": %.2f,\n    \"results\": [\n", best / (16 * G_ARRAY_SIZE));
+
+	digit_state_default_config(&timing);
+	for (s = 0; s < (int)(sizeof(BENCH_LOOPBACK_SCENARIOS) / sizeof(BENCH_LOOPBACK_SCENARIOS[0])); s++)
+	{
+		const bench_loopback_scenario_t *scenario = &BENCH_LOOPBACK_SCENARIOS[s];
+
+		tone_gen_default_config(&config, SELF_TEST_DIGITS);
+		config.tone_ms = scenario->tone_ms;
+		config.gap_ms = scenario->gap_ms;
+		config.level_low = scenario->level;
+		config.level_high = scenario->level;
+
+		for (j = 0; j < g_detector_count; j++)
+		{
+			const detector_t *detector = g_detectors[j];
+
+			bench_barge_in_onset = SDFT_NO_KEY;
+			detector_sdft_set_callback(detector == &detector_sdft ? bench_sdft_barge_in : NULL, NULL);
+			detector->init();
+			digit_state_init(&digit_state, &timing);
+			tone_gen_init(&gen, &config);
+			self_test_init(&test, SELF_TEST_DEFAULT_TIMEOUT);
+			queued = 0;
+			samples = 0;
+			/* Silent frames after the sequence, until the last digit is matched or timed out */
+			flush = SELF_TEST_DEFAULT_TIMEOUT / G_ARRAY_SIZE + 2;
+			while (flush > 0)
+			{
+				for (i = 0; i < G_ARRAY_SIZE; i++)
+				{
+					frame[i].re = bench_loopback_sample(&gen);
+					frame[i].im = 0.0;
+					if (gen.digits != queued)
+					{
+						queued = gen.digits;
+						self_test_played(&test, gen.key, gen.digit_start);
+					}
+				}
+				if (detector == &detector_sdft)
+				{
+					bench_sdft_stream(frame, (uint32_t)samples);
+				}
+				samples += G_ARRAY_SIZE;
+				event_count = digit_state_update(&digit_state, bench_detect(detector, frame), events);
+				for (e = 0; e < event_count; e++)
+				{
+					if (events[e].type == DIGIT_EVENT_PRESS)
+					{
+						self_test_detected(&test, events[e].key,
+							bench_barge_in_onset == events[e].key ? bench_barge_in_time : digit_state.now);
+						bench_barge_in_onset = SDFT_NO_KEY;
+					}
+				}
+				self_test_expire(&test, digit_state.now);
+				if (gen.done)
+				{
+					flush--;
+				}
+			}
+
+			fprintf(out, "%s      {\"scenario\": \"%s\", \"detector\": \"%s\", \"samples\": %lu, \"played\": %lu, "
+				"\"detected\": %lu, \"missed\": %lu, \"unexpected\": %lu, \"latency_min_ms\": %.1f, "
+				"\"latency_mean_ms\": %.1f, \"latency_max_ms\": %.1f}",
+				first ? "" : ",\n", scenario->name, detector->name, samples, (unsigned long)gen.digits,
+				(unsigned long)test.detected, (unsigned long)test.missed, (unsigned long)test.unexpected,
+				test.latency_min * 1000.0 / G_SAMPLE_RATE,
+				test.detected ? test.latency_sum * 1000.0 / G_SAMPLE_RATE / test.detected : 0.0,
+				test.latency_max * 1000.0 / G_SAMPLE_RATE);
+			first = 0;
+		}
+	}
+	detector_sdft_set_callback(NULL, NULL);
+	fprintf(out, "\n    ]\n  }\n");
+}
+
+static void bench_usage(const char *argv0)
+{
+	fprintf(stderr,
+		"usage: %s [-o file] [-r repeat] [--digits S] [--amplitude A] [--snr dB] [--twist dB]\n"
+		"          [--offset pct] [--tone-ms ms] [--gap-ms ms] [--seed n] [--rate Hz]\n"
+		"Without signal options the built-in scenario table is run.\n", argv0);
+}
+
+int main(int argc, char *argv[])
+{
+	bench_scenario_t custom = {"custom", G_SAMPLE_RATE, {"1234567890*#ABCD", 1000.0, 30.0, 0.0, 0.0, 100.0, 100.0, 1}};
+	const bench_scenario_t *scenarios = BENCH_SCENARIOS;
+	int n_scenarios = sizeof(BENCH_SCENARIOS) / sizeof(BENCH_SCENARIOS[0]);
+	int repeat = BENCH_DEFAULT_REPEAT;
+	FILE *out = stdout;
+	int first = 1;
+	int i, j;
+
+	for (i = 1; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if (value == NULL)
+		{
+			bench_usage(argv[0]);
+			return 2;
+		}
+		if (strcmp(arg, "-o") == 0)
+		{
+			out = fopen(value, "w");
+			if (out == NULL)
+			{
+				perror(value);
+				return 1;
+			}
+		}
+		else if (strcmp(arg, "-r") == 0) repeat = atoi(value);
+		else if (strcmp(arg, "--digits") == 0) custom.params.digits = value;
+		else if (strcmp(arg, "--amplitude") == 0) custom.params.amplitude = atof(value);
+		else if (strcmp(arg, "--snr") == 0) custom.params.snr_db = atof(value);
+		else if (strcmp(arg, "--twist") == 0) custom.params.twist_db = atof(value);
+		else if (strcmp(arg, "--offset") == 0) custom.params.freq_offset_pct = atof(value);
+		else if (strcmp(arg, "--tone-ms") == 0) custom.params.tone_ms = atof(value);
+		else if (strcmp(arg, "--gap-ms") == 0) custom.params.gap_ms = atof(value);
+		else if (strcmp(arg, "--seed") == 0) custom.params.seed = strtoul(value, NULL, 10);
+		else if (strcmp(arg, "--rate") == 0) custom.input_rate = strtoul(value, NULL, 10);
+		else
+		{
+			bench_usage(argv[0]);
+			return 2;
+		}
+
+		if (strcmp(arg, "-o") != 0 && strcmp(arg, "-r") != 0)
+		{
+			scenarios = &custom;
+			n_scenarios = 1;
+		}
+		i++;
+	}
+
+	fprintf(out, "{\n  \"benchmark\": \"dtmf\",\n  \"sample_rate\": %d,\n  \"frame_size\": %d,\n  \"repeat\": %d,\n  \"results\": [\n",
+		G_SAMPLE_RATE, G_ARRAY_SIZE, repeat);
+	for (i = 0; i < n_scenarios; i++)
+	{
+		for (j = 0; j < g_detector_count; j++)
+		{
+			bench_run(out, &scenarios[i], g_detectors[j], repeat, first);
+			first = 0;
+		}
+	}
+	fprintf(out, "\n  ],\n");
+	bench_digit_state(out);
+	bench_tone_bank(out, repeat);
+	bench_fft_accuracy(out, repeat);
+	bench_g711(out, repeat);
+	bench_caller_id(out, repeat);
+	bench_loopback(out, repeat);
+	fprintf(out, "}\n");
+
+	if (out != stdout)
+	{
+		fclose(out);
+	}
+	return 0;
+}
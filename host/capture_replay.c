@@ -0,0 +1,412 @@
+/*! \file capture_replay.c
+ * \brief Replays a raw ADC capture of the board through the decoding pipeline of the firmware
+ *
+ * Reads the records streamed by capture_lpc.c (see capture.h), as saved from the serial port, and rebuilds the
+ * samples the detectors saw on the board: each code goes through auto_calibrate_sample() with the DC estimate and the
+ * scale of the markers, like store_sample() does. The frames then go through the same steps as decoder_operations():
+ * auto_calibrate_block(), the caller ID demodulator, the detector and the digit state machine.
+ *
+ * Only the frames the board decoded are decoded, in the same order, which the decisions carried by the markers tell:
+ * a frame the main loop skipped because the next one was already complete is skipped here too. The decision a marker
+ * carries is compared with the tones found here for the same frame; with IEEE 754 doubles on both sides and no fused
+ * multiply-add (-ffp-contract=off) they are the same, any mismatch is reported. The detector is the one of the
+ * decisions, re-initialised when the board re-initialised it, unless --detector picks another to see what it would
+ * have found.
+ *
+ * Records lost between the board and the file, found from the gaps in the frame numbers, restart the DC estimate from
+ * the next marker; frames the board could not send are counted by the board itself. Bytes that are not a record are
+ * skipped until the next valid marker.
+ *
+ * The output is one JSON object per line: a "digit" line when a digit is confirmed, a "mismatch" line for a decision
+ * that differs, with --frames a "frame" line for every frame decoded or skipped, and a "summary" line at the end.
+ *
+ * Record from the board, then build and run from the repository root:
+ * \code
+ * stty -F /dev/ttyUSB0 230400 raw -echo && cat /dev/ttyUSB0 > field.cap
+ * cc -std=gnu89 -O2 -ffp-contract=off -Ihost -Isrc -Idrivers -o capture_replay host/capture_replay.c src/capture.c \
+ *    src/auto_calibrate.c src/fsk_cid.c src/digit_state.c src/detector*.c src/resampler.c src/tone_bank.c src/sdft.c \
+ *    src/gtzl.c src/decoder_gtzl.c src/fft.c src/decoder.c src/dtmf_table.c src/complex_g3.c -lm
+ * ./capture_replay field.cap
+ * ./capture_replay --frames --detector GTZL -o replay.jsonl field.cap
+ * \endcode
+ */
+
+/* C Library Headers */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "dtmf_table.h"
+#include "complex_g3.h"
+#include "auto_calibrate.h"
+#include "detector.h"
+#include "digit_state.h"
+#include "fsk_cid.h"
+#include "capture.h"
+
+/* Frames kept until a decision tells whether the board decoded them, a power of two */
+#define REPLAY_QUEUE 16
+
+/*! \typedef replay_frame_t
+* \brief A frame rebuilt from a record, waiting for the decision about it
+*/
+typedef struct replay_frame_t
+{
+	uint16_t number;	/* Frame number of the record */
+	complex_g3_t samples[G_ARRAY_SIZE];
+} replay_frame_t;
+
+/*! \typedef replay_t
+* \brief State of the replay
+*/
+typedef struct replay_t
+{
+	FILE *out;
+	int frames_lines;	/* --frames */
+	const detector_t *forced;	/* --detector, NULL to follow the board */
+	const detector_t *detector;	/* Detector in use, NULL until the first decision */
+	uint8_t detector_id, inits;	/* Of the board, when the detector was last initialised */
+	digit_state_t digit_state;
+	fsk_cid_t caller_id;
+	replay_frame_t *queue;	/* REPLAY_QUEUE frames */
+	uint32_t queue_head, queue_tail;
+	int have_record;	/* A record has been read */
+	uint16_t next_frame;	/* Number expected for the next record */
+	int have_decision;	/* A decision has been seen */
+	capture_decision_t last;	/* Last decision seen */
+	/* Counters */
+	unsigned long records, garbage_bytes, resyncs, lost, dc_mismatches;
+	unsigned long decoded, skipped, unresolved, compared, mismatches, digits, caller_ids;
+	uint16_t dropped;	/* From the last marker */
+} replay_t;
+
+static char replay_key(struct_tone_frequencies tones)
+{
+	if (tones.low < 0 || tones.high < 0)
+	{
+		return DIGIT_STATE_NO_KEY;
+	}
+	return dtmf_key_table[tones.low][tones.high];
+}
+
+/* Runs one frame through the steps of decoder_operations(), and checks the tones against the board when it decided it */
+static void replay_decode(replay_t *replay, replay_frame_t *frame, const capture_decision_t *decision)
+{
+	digit_event_t events[DIGIT_STATE_MAX_EVENTS];
+	struct_tone_frequencies tones;
+	int count, e;
+
+	auto_calibrate_block(frame->samples, G_ARRAY_SIZE);
+	if (fsk_cid_process(&replay->caller_id, frame->samples, G_ARRAY_SIZE))
+	{
+		replay->caller_ids++;
+		fprintf(replay->out, "{\"type\": \"caller_id\", \"frame\": %u, \"number\": \"%s\", \"name\": \"%s\"}\n",
+			frame->number, replay->caller_id.message.number, replay->caller_id.message.name);
+	}
+	replay->detector->process_frame(frame->samples);
+	tones = replay->detector->get_tones();
+	count = digit_state_update(&replay->digit_state, replay_key(tones), events);
+	for (e = 0; e < count; e++)
+	{
+		if (events[e].type == DIGIT_EVENT_PRESS)
+		{
+			replay->digits++;
+			fprintf(replay->out, "{\"type\": \"digit\", \"key\": \"%c\", \"frame\": %u, \"start_sample\": %lu}\n",
+				events[e].key, frame->number, (unsigned long)events[e].start);
+		}
+	}
+	replay->decoded++;
+
+	if (decision != NULL)
+	{
+		replay->compared++;
+		if (tones.low != decision->low || tones.high != decision->high)
+		{
+			replay->mismatches++;
+			fprintf(replay->out, "{\"type\": \"mismatch\", \"frame\": %u, \"board\": [%d, %d], \"host\": [%d, %d]}\n",
+				frame->number, decision->low, decision->high, tones.low, tones.high);
+		}
+	}
+	if (replay->frames_lines)
+	{
+		fprintf(replay->out, "{\"type\": \"frame\", \"frame\": %u, \"decoded\": 1, \"low\": %d, \"high\": %d}\n",
+			frame->number, tones.low, tones.high);
+	}
+}
+
+static void replay_skip(replay_t *replay, const replay_frame_t *frame)
+{
+	replay->skipped++;
+	if (replay->frames_lines)
+	{
+		fprintf(replay->out, "{\"type\": \"frame\", \"frame\": %u, \"decoded\": 0}\n", frame->number);
+	}
+}
+
+/* Follows the detector of the board, initialised again when the board did */
+static int replay_select(replay_t *replay, const capture_decision_t *decision)
+{
+	const detector_t *detector = replay->forced;
+
+	if (replay->detector != NULL && decision->detector == replay->detector_id && decision->inits == replay->inits)
+	{
+		return 1;
+	}
+	if (detector == NULL)
+	{
+		detector = detector_find(decision->detector);
+		if (detector == NULL)
+		{
+			fprintf(stderr, "capture_replay: unknown detector %u in the capture\n", decision->detector);
+			return 0;
+		}
+	}
+	if (replay->detector != detector || decision->inits != replay->inits)
+	{
+		detector->init();
+	}
+	replay->detector = detector;
+	replay->detector_id = decision->detector;
+	replay->inits = decision->inits;
+	return 1;
+}
+
+/* Decodes or skips the queued frames up to the one of a new decision. Between two decisions the board advanced by
+* frames frames and decoded processed of them: the frames it skipped are the first ones, since a slow main loop always
+* takes the newest frame. Only the frame of the decision can be compared, the others' decisions were overwritten. */
+static void replay_decision(replay_t *replay, const capture_decision_t *decision)
+{
+	uint16_t frames, processed, behind;
+	replay_frame_t *frame;
+
+	if (decision->frame == 0xFFFF || (replay->have_decision && decision->frame == replay->last.frame))
+	{
+		return;
+	}
+	if (!replay_select(replay, decision))
+	{
+		exit(1);
+	}
+	processed = (uint16_t)(decision->processed - (replay->have_decision ? replay->last.processed : 0));
+	while (replay->queue_tail != replay->queue_head)
+	{
+		frame = &replay->queue[replay->queue_tail % REPLAY_QUEUE];
+		/* Frames after the decision stay queued for the next one */
+		behind = (uint16_t)(decision->frame - frame->number);
+		if (behind >= 0x8000)
+		{
+			break;
+		}
+		frames = (uint16_t)(behind + 1);
+		if (behind == 0)
+		{
+			replay_decode(replay, frame, decision);
+		}
+		else if (frames <= processed)
+		{
+			replay_decode(replay, frame, NULL);
+		}
+		else
+		{
+			replay_skip(replay, frame);
+		}
+		replay->queue_tail++;
+	}
+	replay->last = *decision;
+	replay->have_decision = 1;
+}
+
+/* Rebuilds the samples of a record as store_sample() does and queues them */
+static void replay_record(replay_t *replay, const capture_marker_t *marker, const uint8_t *packed)
+{
+	int codes[G_ARRAY_SIZE];
+	replay_frame_t *frame;
+	int i;
+
+	replay->records++;
+	replay->dropped = marker->dropped;
+	if (!replay->have_record || marker->frame != replay->next_frame)
+	{
+		if (replay->have_record)
+		{
+			replay->lost += (uint16_t)(marker->frame - replay->next_frame);
+		}
+		g_calibration.dc_acc = marker->dc_acc;
+	}
+	else if (g_calibration.dc_acc != marker->dc_acc)
+	{
+		/* The codes in between were not the ones the board had */
+		replay->dc_mismatches++;
+		g_calibration.dc_acc = marker->dc_acc;
+	}
+	g_calibration.scale = marker->scale;
+	replay->have_record = 1;
+	replay->next_frame = (uint16_t)(marker->frame + 1);
+
+	/* The decision was taken before this frame started, about a frame already queued */
+	replay_decision(replay, &marker->decision);
+
+	if (replay->queue_head - replay->queue_tail == REPLAY_QUEUE)
+	{
+		/* The board stopped deciding: the oldest frame will never be known */
+		replay->queue_tail++;
+		replay->unresolved++;
+	}
+	frame = &replay->queue[replay->queue_head % REPLAY_QUEUE];
+	frame->number = marker->frame;
+	capture_unpack(packed, G_ARRAY_SIZE, codes);
+	for (i = 0; i < G_ARRAY_SIZE; i++)
+	{
+		frame->samples[i].re = (double)((double)auto_calibrate_sample(codes[i]) * g_calibration.scale);
+		frame->samples[i].im = (double)0.0;
+	}
+	replay->queue_head++;
+}
+
+static void replay_usage(const char *argv0)
+{
+	fprintf(stderr,
+		"usage: %s [-o file] [--frames] [--detector name] capture.bin\n"
+		"Replays a raw ADC capture of the board through the decoding pipeline, one JSON object per line.\n", argv0);
+}
+
+int main(int argc, char *argv[])
+{
+	replay_t replay;
+	capture_marker_t marker;
+	const char *path = NULL;
+	uint8_t *data;
+	FILE *in;
+	long length, position;
+	int i, in_sync = 1;
+
+	memset(&replay, 0, sizeof(replay));
+	replay.out = stdout;
+
+	for (i = 1; i < argc; i++)
+	{
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if (argv[i][0] != '-')
+		{
+			path = argv[i];
+			continue;
+		}
+		if (strcmp(argv[i], "--frames") == 0)
+		{
+			replay.frames_lines = 1;
+			continue;
+		}
+		if (value == NULL)
+		{
+			replay_usage(argv[0]);
+			return 2;
+		}
+		if (strcmp(argv[i], "-o") == 0)
+		{
+			replay.out = fopen(value, "w");
+			if (replay.out == NULL)
+			{
+				perror(value);
+				return 1;
+			}
+		}
+		else if (strcmp(argv[i], "--detector") == 0)
+		{
+			int j;
+
+			for (j = 0; j < g_detector_count && strcmp(g_detectors[j]->name, value) != 0; j++)
+			{
+			}
+			if (j == g_detector_count)
+			{
+				fprintf(stderr, "capture_replay: no detector %s\n", value);
+				return 2;
+			}
+			replay.forced = g_detectors[j];
+		}
+		else
+		{
+			replay_usage(argv[0]);
+			return 2;
+		}
+		i++;
+	}
+	if (path == NULL)
+	{
+		replay_usage(argv[0]);
+		return 2;
+	}
+
+	in = fopen(path, "rb");
+	if (in == NULL)
+	{
+		perror(path);
+		return 1;
+	}
+	fseek(in, 0, SEEK_END);
+	length = ftell(in);
+	fseek(in, 0, SEEK_SET);
+	data = (uint8_t *)malloc(length > 0 ? (size_t)length : 1);
+	replay.queue = (replay_frame_t *)malloc(REPLAY_QUEUE * sizeof(replay_frame_t));
+	if (data == NULL || replay.queue == NULL)
+	{
+		fprintf(stderr, "capture_replay: out of memory\n");
+		return 1;
+	}
+	if (length > 0 && fread(data, 1, (size_t)length, in) != (size_t)length)
+	{
+		perror(path);
+		return 1;
+	}
+	fclose(in);
+
+	/* As after a reset of the board, the calibration then comes from the markers */
+	auto_calibrate_init(0);
+	{
+		digit_state_config_t timing;
+
+		digit_state_default_config(&timing);
+		digit_state_init(&replay.digit_state, &timing);
+	}
+	fsk_cid_init(&replay.caller_id, FSK_CID_BELL202, FSK_CID_DEFAULT_LEVEL);
+
+	position = 0;
+	while (position + CAPTURE_RECORD_SIZE <= length)
+	{
+		if (!capture_marker_decode(data + position, &marker))
+		{
+			/* Not a record: look for the next marker a byte further */
+			if (in_sync)
+			{
+				replay.resyncs++;
+				in_sync = 0;
+			}
+			replay.garbage_bytes++;
+			position++;
+			continue;
+		}
+		in_sync = 1;
+		replay_record(&replay, &marker, data + position + CAPTURE_MARKER_SIZE);
+		position += CAPTURE_RECORD_SIZE;
+	}
+	/* A record cut by the end of the file is not garbage, the capture was just stopped */
+	replay.unresolved += replay.queue_head - replay.queue_tail;
+
+	fprintf(replay.out, "{\"type\": \"summary\", \"records\": %lu, \"decoded\": %lu, \"skipped\": %lu, "
+		"\"unresolved\": %lu, \"lost\": %lu, \"dropped\": %u, \"resyncs\": %lu, \"garbage_bytes\": %lu, "
+		"\"dc_mismatches\": %lu, \"compared\": %lu, \"mismatches\": %lu, \"digits\": %lu, \"caller_ids\": %lu, "
+		"\"tail_bytes\": %ld}\n",
+		replay.records, replay.decoded, replay.skipped, replay.unresolved, replay.lost, replay.dropped,
+		replay.resyncs, replay.garbage_bytes, replay.dc_mismatches, replay.compared, replay.mismatches,
+		replay.digits, replay.caller_ids, length - position);
+	if (replay.out != stdout)
+	{
+		fclose(replay.out);
+	}
+	free(replay.queue);
+	free(data);
+	return replay.mismatches != 0 ? 3 : 0;
+}
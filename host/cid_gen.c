@@ -0,0 +1,179 @@
+/*! \file cid_gen.c
+ * \brief Functions for cid_gen.h
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "cid_gen.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define CID_GEN_BAUD 1200.0
+
+/* Same generator as dtmf_gen.c, kept private so that the two signals do not share a sequence */
+static unsigned long gen_state;
+
+static double gen_uniform(void)
+{
+	gen_state = (gen_state * 16807UL) % 2147483647UL;
+	return ((double)gen_state + 0.5) / 2147483647.0;
+}
+
+static double gen_gaussian(void)
+{
+	double u1 = gen_uniform();
+	double u2 = gen_uniform();
+
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static unsigned long gen_ms_to_samples(double ms, double sample_rate)
+{
+	return (unsigned long)(ms * sample_rate / 1000.0 + 0.5);
+}
+
+/* Appends the checksum that makes all the bytes add up to 0 modulo 256 and returns the full length */
+static int gen_checksum(unsigned char *message, int length)
+{
+	unsigned char sum = 0;
+	int i;
+
+	for (i = 0; i < length; i++)
+	{
+		sum = (unsigned char)(sum + message[i]);
+	}
+	message[length] = (unsigned char)(0x100 - sum);
+	return length + 1;
+}
+
+/* Appends an MDMF parameter and returns the new length */
+static int gen_param(unsigned char *message, int length, unsigned char type, const char *text)
+{
+	int size = (int)strlen(text);
+
+	message[length++] = type;
+	message[length++] = (unsigned char)size;
+	memcpy(message + length, text, (size_t)size);
+	return length + size;
+}
+
+static int gen_absent(const char *text)
+{
+	return strcmp(text, "O") == 0 || strcmp(text, "P") == 0;
+}
+
+int cid_gen_sdmf(unsigned char *message, const char *date_time, const char *number)
+{
+	int length = 2;
+
+	memcpy(message + length, date_time, 8);
+	length += 8;
+	memcpy(message + length, number, strlen(number));
+	length += (int)strlen(number);
+	message[0] = 0x04;
+	message[1] = (unsigned char)(length - 2);
+	return gen_checksum(message, length);
+}
+
+int cid_gen_mdmf(unsigned char *message, const char *date_time, const char *number, const char *name)
+{
+	int length = 2;
+
+	length = gen_param(message, length, 0x01, date_time);
+	length = gen_param(message, length, gen_absent(number) ? 0x04 : 0x02, number);
+	if (name != NULL)
+	{
+		length = gen_param(message, length, gen_absent(name) ? 0x08 : 0x07, name);
+	}
+	message[0] = 0x80;
+	message[1] = (unsigned char)(length - 2);
+	return gen_checksum(message, length);
+}
+
+static unsigned long gen_bits(const cid_gen_params_t *params, int length)
+{
+	return (unsigned long)params->seizure_bits + (unsigned long)params->mark_bits + 10UL * (unsigned long)length;
+}
+
+unsigned long cid_gen_length(const cid_gen_params_t *params, int length, double sample_rate)
+{
+	double baud = CID_GEN_BAUD * (1.0 + params->baud_offset_pct / 100.0);
+
+	return 2 * gen_ms_to_samples(params->lead_ms, sample_rate)
+		+ (unsigned long)ceil((double)gen_bits(params, length) * sample_rate / baud);
+}
+
+/* Bit number n of the transmission: seizure starting with a space, mark, then start, data LSB first and stop bits */
+static int gen_bit(const cid_gen_params_t *params, const unsigned char *message, unsigned long n)
+{
+	unsigned long frame;
+
+	if (n < (unsigned long)params->seizure_bits)
+	{
+		return (int)(n & 1);
+	}
+	n -= (unsigned long)params->seizure_bits;
+	if (n < (unsigned long)params->mark_bits)
+	{
+		return 1;
+	}
+	n -= (unsigned long)params->mark_bits;
+	frame = n % 10;
+	if (frame == 0)
+	{
+		return 0;
+	}
+	if (frame == 9)
+	{
+		return 1;
+	}
+	return (message[n / 10] >> (frame - 1)) & 1;
+}
+
+unsigned long cid_gen_render(const cid_gen_params_t *params, const unsigned char *message, int length, double sample_rate, double *samples, unsigned long max_samples)
+{
+	unsigned long lead = gen_ms_to_samples(params->lead_ms, sample_rate);
+	unsigned long total = cid_gen_length(params, length, sample_rate);
+	unsigned long bits = gen_bits(params, length);
+	double scale = 1.0 + params->freq_offset_pct / 100.0;
+	double mark = (params->v23 ? 1300.0 : 1200.0) * scale;
+	double space = (params->v23 ? 2100.0 : 2200.0) * scale;
+	double baud = CID_GEN_BAUD * (1.0 + params->baud_offset_pct / 100.0);
+	/* A sinusoid of amplitude A has a power of A^2 / 2 */
+	double noise_sigma = params->amplitude / sqrt(2.0 * pow(10.0, params->snr_db / 10.0));
+	double phase = 0.0;
+	unsigned long i, n;
+
+	gen_state = (params->seed % 2147483646UL) + 1;
+
+	if (total > max_samples)
+	{
+		total = max_samples;
+	}
+
+	for (i = 0; i < total; i++)
+	{
+		samples[i] = noise_sigma * gen_gaussian();
+		if (i < lead)
+		{
+			continue;
+		}
+		n = (unsigned long)((double)(i - lead) * baud / sample_rate);
+		if (n >= bits)
+		{
+			continue;
+		}
+		/* Phase continuous: only the rate of the phase changes with the bit */
+		samples[i] += params->amplitude * sin(phase);
+		phase += 2.0 * M_PI * (gen_bit(params, message, n) ? mark : space) / sample_rate;
+		if (phase > 2.0 * M_PI)
+		{
+			phase -= 2.0 * M_PI;
+		}
+	}
+
+	return total;
+}
@@ -0,0 +1,69 @@
+/*! \file cid_gen.h
+ * \brief Synthetic FSK caller ID signal generator for the host benchmarks
+ *
+ * Builds SDMF and MDMF caller ID messages and renders them the way an exchange sends them between the first and the
+ * second ring: channel seizure (alternating bits), mark preamble, then the message bytes framed with a start and a
+ * stop bit, with phase continuous FSK. The samples are scaled like the reader output, as those of dtmf_gen.h.
+ */
+
+#ifndef CID_GEN_H_
+#define CID_GEN_H_
+
+/*! \def CID_GEN_MAX_MESSAGE
+* \brief Longest message built by cid_gen_sdmf() and cid_gen_mdmf()
+*/
+#define CID_GEN_MAX_MESSAGE 258
+
+/*! \typedef cid_gen_params_t
+* \brief Description of a generated caller ID signal
+*/
+typedef struct cid_gen_params_t
+{
+	int v23;	/*!< 1 for V.23 tones (1300/2100 Hz), 0 for Bell 202 (1200/2200 Hz) */
+	double amplitude;	/*!< Peak amplitude of the FSK signal */
+	double snr_db;	/*!< Ratio between the signal power and the white noise power, in dB */
+	double freq_offset_pct;	/*!< Deviation applied to both tones, in percent */
+	double baud_offset_pct;	/*!< Deviation of the bit rate from 1200 baud, in percent */
+	int seizure_bits;	/*!< Bits of channel seizure, 300 for Bell 202, 0 to leave it out */
+	int mark_bits;	/*!< Bits of mark before the message, 180 for Bell 202 */
+	double lead_ms;	/*!< Silence before the seizure and after the message */
+	unsigned long seed;	/*!< Seed of the noise generator */
+} cid_gen_params_t;
+
+/*! \fn int cid_gen_sdmf(unsigned char *message, const char *date_time, const char *number)
+* \param message Output, CID_GEN_MAX_MESSAGE bytes
+* \param date_time MMDDHHMM
+* \param number Calling number, or "O" / "P" when it is not available
+* \returns Length of the message, checksum included
+*/
+int cid_gen_sdmf(unsigned char *message, const char *date_time, const char *number);
+
+/*! \fn int cid_gen_mdmf(unsigned char *message, const char *date_time, const char *number, const char *name)
+* \param message Output, CID_GEN_MAX_MESSAGE bytes
+* \param date_time MMDDHHMM
+* \param number Calling number, or "O" / "P" for a reason of absence parameter
+* \param name Calling name, or "O" / "P" for a reason of absence parameter, NULL to leave it out
+* \returns Length of the message, checksum included
+*/
+int cid_gen_mdmf(unsigned char *message, const char *date_time, const char *number, const char *name);
+
+/*! \fn unsigned long cid_gen_length(const cid_gen_params_t *params, int length, double sample_rate)
+* \param params Signal description
+* \param length Length of the message
+* \param sample_rate Sample rate in Hz
+* \returns Number of samples cid_gen_render() will produce
+*/
+unsigned long cid_gen_length(const cid_gen_params_t *params, int length, double sample_rate);
+
+/*! \fn unsigned long cid_gen_render(const cid_gen_params_t *params, const unsigned char *message, int length, double sample_rate, double *samples, unsigned long max_samples)
+* \param params Signal description
+* \param message Message bytes
+* \param length Length of the message
+* \param sample_rate Sample rate in Hz
+* \param samples Output buffer
+* \param max_samples Capacity of \p samples
+* \returns Number of samples written
+*/
+unsigned long cid_gen_render(const cid_gen_params_t *params, const unsigned char *message, int length, double sample_rate, double *samples, unsigned long max_samples);
+
+#endif
@@ -0,0 +1,141 @@
+/*! \file dtmf_gen.c
+ * \brief Functions for dtmf_gen.h
+ */
+
+#include <math.h>
+#include <stddef.h>
+
+#include "dtmf_gen.h"
+#include "dtmf_table.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Park-Miller minimal standard generator, so the noise does not depend on the C library rand() */
+static unsigned long gen_state;
+
+static double gen_uniform(void)
+{
+	gen_state = (gen_state * 16807UL) % 2147483647UL;
+	return ((double)gen_state + 0.5) / 2147483647.0;
+}
+
+/* Box-Muller transform, one normal deviate per call is enough here */
+static double gen_gaussian(void)
+{
+	double u1 = gen_uniform();
+	double u2 = gen_uniform();
+
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static unsigned long gen_ms_to_samples(double ms, double sample_rate)
+{
+	return (unsigned long)(ms * sample_rate / 1000.0 + 0.5);
+}
+
+unsigned long dtmf_gen_length(const dtmf_gen_params_t *params, double sample_rate)
+{
+	unsigned long digits = 0;
+	const char *c;
+
+	for (c = params->digits; *c; c++)
+	{
+		digits++;
+	}
+
+	return digits * (gen_ms_to_samples(params->tone_ms, sample_rate) + gen_ms_to_samples(params->gap_ms, sample_rate))
+		+ gen_ms_to_samples(params->gap_ms, sample_rate);
+}
+
+unsigned long dtmf_gen_render(const dtmf_gen_params_t *params, double sample_rate, double *samples, unsigned long max_samples, dtmf_gen_truth_t *truth, int max_truth)
+{
+	unsigned long tone_len = gen_ms_to_samples(params->tone_ms, sample_rate);
+	unsigned long gap_len = gen_ms_to_samples(params->gap_ms, sample_rate);
+	unsigned long total = dtmf_gen_length(params, sample_rate);
+	double amp_lo = params->amplitude;
+	double amp_hi = params->amplitude * pow(10.0, params->twist_db / 20.0);
+	double noise_sigma;
+	double scale = 1.0 + params->freq_offset_pct / 100.0;
+	unsigned long pos = 0;
+	unsigned long i;
+	int n_truth = 0;
+	const char *c;
+
+	/* Noise power is referred to the power of the tone pair, sum of two sinusoids: (A_lo^2 + A_hi^2) / 2 */
+	noise_sigma = sqrt(((amp_lo * amp_lo) + (amp_hi * amp_hi)) / 2.0 / pow(10.0, params->snr_db / 10.0));
+
+	gen_state = (params->seed % 2147483646UL) + 1;
+
+	if (total > max_samples)
+	{
+		total = max_samples;
+	}
+
+	for (i = 0; i < total; i++)
+	{
+		samples[i] = noise_sigma * gen_gaussian();
+	}
+
+	pos = gap_len;
+	for (c = params->digits; *c && pos < total; c++)
+	{
+		int index = dtmf_key_index(*c);
+
+		if (index >= 0)
+		{
+			double w_lo = 2.0 * M_PI * (double)dtmf_low_freqs[index / DTMF_GROUP_TONES] * scale / sample_rate;
+			double w_hi = 2.0 * M_PI * (double)dtmf_high_freqs[index % DTMF_GROUP_TONES] * scale / sample_rate;
+
+			for (i = 0; i < tone_len && pos + i < total; i++)
+			{
+				samples[pos + i] += (amp_lo * sin(w_lo * i)) + (amp_hi * sin(w_hi * i));
+			}
+
+			if (truth != NULL && n_truth < max_truth)
+			{
+				truth[n_truth].key = *c;
+				truth[n_truth].start = pos;
+				truth[n_truth].end = pos + tone_len;
+				n_truth++;
+			}
+		}
+		pos += tone_len + gap_len;
+	}
+
+	return total;
+}
+
+char dtmf_gen_truth_at(const dtmf_gen_truth_t *truth, int count, unsigned long start, unsigned long length, int *partial)
+{
+	unsigned long end = start + length;
+	unsigned long covered = 0;
+	int overlaps = 0;
+	char key = DTMF_GEN_SILENCE;
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		unsigned long lo = (truth[i].start > start) ? truth[i].start : start;
+		unsigned long hi = (truth[i].end < end) ? truth[i].end : end;
+
+		if (hi > lo)
+		{
+			overlaps++;
+			if (hi - lo > covered)
+			{
+				covered = hi - lo;
+				key = truth[i].key;
+			}
+		}
+	}
+
+	*partial = (overlaps > 1) || (overlaps == 1 && covered < length);
+
+	if (2 * covered < length)
+	{
+		return DTMF_GEN_SILENCE;
+	}
+	return key;
+}
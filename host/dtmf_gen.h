@@ -0,0 +1,74 @@
+/*! \file dtmf_gen.h
+ * \brief Synthetic DTMF signal generator for the host benchmarks
+ *
+ * Renders a digit sequence into an array of samples scaled like the reader output (centred on zero, in the same units
+ * as \p vadc in reader.c), so that the buffers can be handed to the decoders exactly as the board would.
+ * A private pseudo random generator is used for the noise, which makes every run reproducible for a given seed
+ * regardless of the C library.
+ */
+
+#ifndef DTMF_GEN_H_
+#define DTMF_GEN_H_
+
+/*! \def DTMF_GEN_SILENCE
+* \brief Key reported for samples that do not belong to any digit
+*/
+#define DTMF_GEN_SILENCE 'N'
+
+/*! \typedef dtmf_gen_params_t
+* \brief Description of a generated signal
+*/
+typedef struct dtmf_gen_params_t
+{
+	const char *digits;	/*!< Digits to render, any of 0-9, *, #, A-D */
+	double amplitude;	/*!< Peak amplitude of the low group tone */
+	double snr_db;	/*!< Ratio between the tone pair power and the white noise power, in dB */
+	double twist_db;	/*!< Level of the high group tone relative to the low group tone, in dB */
+	double freq_offset_pct;	/*!< Deviation applied to both tones, in percent of the nominal frequency */
+	double tone_ms;	/*!< Duration of each digit */
+	double gap_ms;	/*!< Silence before each digit and after the last one */
+	unsigned long seed;	/*!< Seed of the noise generator */
+} dtmf_gen_params_t;
+
+/*! \typedef dtmf_gen_truth_t
+* \brief Position of a rendered digit, in samples
+*/
+typedef struct dtmf_gen_truth_t
+{
+	char key;	/*!< Rendered key */
+	unsigned long start;	/*!< First sample of the digit */
+	unsigned long end;	/*!< One past the last sample of the digit */
+} dtmf_gen_truth_t;
+
+/*! \fn unsigned long dtmf_gen_length(const dtmf_gen_params_t *params, double sample_rate)
+* \param params Signal description
+* \param sample_rate Sample rate in Hz
+* \returns Number of samples dtmf_gen_render() will produce
+*/
+unsigned long dtmf_gen_length(const dtmf_gen_params_t *params, double sample_rate);
+
+/*! \fn unsigned long dtmf_gen_render(const dtmf_gen_params_t *params, double sample_rate, double *samples, unsigned long max_samples, dtmf_gen_truth_t *truth, int max_truth)
+* \param params Signal description
+* \param sample_rate Sample rate in Hz
+* \param samples Output buffer
+* \param max_samples Capacity of \p samples
+* \param truth Output array with one entry per rendered digit, may be NULL
+* \param max_truth Capacity of \p truth
+* \returns Number of samples written
+* \brief Renders the digit sequence with noise, twist and frequency offset applied
+*
+* Unknown characters in the digit string are rendered as silence of the same duration as a digit.
+*/
+unsigned long dtmf_gen_render(const dtmf_gen_params_t *params, double sample_rate, double *samples, unsigned long max_samples, dtmf_gen_truth_t *truth, int max_truth);
+
+/*! \fn char dtmf_gen_truth_at(const dtmf_gen_truth_t *truth, int count, unsigned long start, unsigned long length, int *partial)
+* \param truth Array filled by dtmf_gen_render()
+* \param count Number of valid entries in \p truth
+* \param start First sample of the window
+* \param length Length of the window
+* \param partial Set to 1 if the window only partly overlaps a digit or overlaps more than one
+* \returns The key covering at least half of the window, or DTMF_GEN_SILENCE
+*/
+char dtmf_gen_truth_at(const dtmf_gen_truth_t *truth, int count, unsigned long start, unsigned long length, int *partial);
+
+#endif
@@ -0,0 +1,64 @@
+/*! \file eeprom_file.c
+ * \brief Functions for eeprom_file.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "eeprom_file.h"
+
+static const char *image_path = "eeprom.bin";
+
+void eeprom_file_set_path(const char *path)
+{
+	image_path = path;
+}
+
+static void file_read(uint16_t page, uint8_t *data, uint32_t count)
+{
+	FILE *f = fopen(image_path, "rb");
+	size_t got = 0;
+
+	if (f != NULL)
+	{
+		if (fseek(f, (long)page * EEPROM_G3_PAGE_SIZE, SEEK_SET) == 0)
+		{
+			got = fread(data, 1, count, f);
+		}
+		fclose(f);
+	}
+	/* Anything not in the image reads as an erased page */
+	memset(data + got, 0, count - got);
+}
+
+static void file_write(uint16_t page, const uint8_t *data, uint32_t count)
+{
+	uint8_t image[EEPROM_G3_PAGE_SIZE];
+	FILE *f = fopen(image_path, "r+b");
+
+	if (f == NULL)
+	{
+		f = fopen(image_path, "w+b");
+		if (f == NULL)
+		{
+			perror(image_path);
+			return;
+		}
+	}
+
+	/* Programming a page rewrites all of it, like the erase/program cycle of the EEPROM */
+	memset(image, 0, sizeof(image));
+	memcpy(image, data, count < EEPROM_G3_PAGE_SIZE ? count : EEPROM_G3_PAGE_SIZE);
+
+	/* Pages skipped over are padded so the image keeps the page geometry */
+	fseek(f, 0, SEEK_END);
+	while (ftell(f) < (long)page * EEPROM_G3_PAGE_SIZE)
+	{
+		fputc(0, f);
+	}
+	fseek(f, (long)page * EEPROM_G3_PAGE_SIZE, SEEK_SET);
+	fwrite(image, 1, sizeof(image), f);
+	fclose(f);
+}
+
+const eeprom_g3_backend_t eeprom_file_backend = {file_read, file_write};
@@ -0,0 +1,21 @@
+/*! \file eeprom_file.h
+ * \brief Backend of eeprom_g3.h storing the EEPROM pages in a file, for the host build
+ */
+
+#ifndef EEPROM_FILE_H_
+#define EEPROM_FILE_H_
+
+#include "eeprom_g3.h"
+
+/*! \var eeprom_file_backend
+* \brief Backend reading and writing the pages of the file set with eeprom_file_set_path()
+*/
+extern const eeprom_g3_backend_t eeprom_file_backend;
+
+/*! \fn void eeprom_file_set_path(const char *path)
+* \param path Image file, created on the first write; pages past its end read as erased
+* \brief Selects the file that stands in for the EEPROM
+*/
+void eeprom_file_set_path(const char *path);
+
+#endif
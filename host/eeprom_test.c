@@ -0,0 +1,305 @@
+/*! \file eeprom_test.c
+ * \brief Host test of the configuration record of eeprom_g3.c, through the file backend of eeprom_file.c
+ *
+ * Each check starts from an erased image and drives write_eeprom_g3() and read_eeprom_g3() as the firmware does,
+ * re-selecting the backend with eeprom_g3_init() where the board would reboot:
+ *
+ * - round_trip: a record reads back field for field, and writing it again programs nothing.
+ * - crc_rejection: a record with a flipped byte is ignored in favour of the previous one, and an image with no valid
+ *   record gives the defaults.
+ * - sequence_wrap: the newest record still wins when the sequence number wraps from 0xFFFFFFFF to 0.
+ * - wear_levelling: successive writes go round the EEPROM_G3_PAGES pages of the ring, each page programmed in turn.
+ * - legacy: the single algorithm byte of the previous format is kept, anything else gives the defaults.
+ *
+ * The output is one JSON object per check and a "summary" line; the exit status is 1 if a check failed.
+ *
+ * Build and run from the repository root:
+ * \code
+ * cc -std=gnu89 -O2 -Ihost -Isrc -Idrivers -o eeprom_test host/eeprom_test.c host/eeprom_file.c src/eeprom_g3.c \
+ *    src/config_g3.c src/auto_calibrate.c src/decoder.c src/decoder_gtzl.c src/dtmf_table.c src/complex_g3.c -lm
+ * ./eeprom_test
+ * ./eeprom_test /tmp/eeprom_test.bin
+ * \endcode
+ */
+
+/* C Library Headers */
+#include <stdio.h>
+#include <string.h>
+
+/* Our Headers */
+#include "eeprom_file.h"
+#include "eeprom_g3.h"
+#include "config_g3.h"
+
+/* Offsets of the record of eeprom_g3.c, rewritten by the checks that forge a page */
+#define TEST_SEQUENCE_OFFSET 4
+#define TEST_CRC_OFFSET 33
+
+static const char *image_path = "eeprom_test.bin";
+static uint32_t page_writes[EEPROM_G3_FIRST_PAGE + EEPROM_G3_PAGES];
+static uint32_t stray_writes;
+
+static void counting_read(uint16_t page, uint8_t *data, uint32_t count)
+{
+	eeprom_file_backend.read(page, data, count);
+}
+
+/* Counts the page program operations, the wear that the ring spreads */
+static void counting_write(uint16_t page, const uint8_t *data, uint32_t count)
+{
+	if ((unsigned)(page - EEPROM_G3_FIRST_PAGE) < EEPROM_G3_PAGES)
+	{
+		page_writes[page]++;
+	}
+	else
+	{
+		stray_writes++;
+	}
+	eeprom_file_backend.write(page, data, count);
+}
+
+static const eeprom_g3_backend_t counting_backend = {counting_read, counting_write};
+
+/* Erased image and a cold boot of eeprom_g3.c */
+static void test_erase(void)
+{
+	remove(image_path);
+	memset(page_writes, 0, sizeof(page_writes));
+	stray_writes = 0;
+	eeprom_g3_init(&counting_backend);
+}
+
+/* A record that differs from the defaults in every field, n making successive ones differ */
+static void test_config(config_g3_t *config, int n)
+{
+	config_g3_defaults(config, 3);
+	config->dc_offset = (uint16_t)(2000 + n);
+	config->scale = 0.5f + (float)n / 64;
+	config->gtzl_threshold = 1234.5f + (float)n;
+	config->fft_threshold_low = 11.25f;
+	config->fft_threshold_high = 12.75f;
+	config->fft_freq_tolerance = 17;
+}
+
+static int configs_equal(const config_g3_t *a, const config_g3_t *b)
+{
+	return a->algorithm == b->algorithm && a->dc_offset == b->dc_offset && a->scale == b->scale
+		&& a->gtzl_threshold == b->gtzl_threshold && a->fft_threshold_low == b->fft_threshold_low
+		&& a->fft_threshold_high == b->fft_threshold_high && a->fft_freq_tolerance == b->fft_freq_tolerance
+		&& a->sample_rate == b->sample_rate && a->frame_size == b->frame_size;
+}
+
+/* Same CRC-16/CCITT as eeprom_g3.c, so that a forged page passes its check */
+static uint16_t test_crc16(const uint8_t *data, uint32_t count)
+{
+	uint16_t crc = 0xFFFF;
+	uint32_t i;
+	int bit;
+
+	for (i = 0; i < count; i++)
+	{
+		crc ^= (uint16_t)data[i] << 8;
+		for (bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+		}
+	}
+	return crc;
+}
+
+/* Rewrites the sequence number of the record of a page and its CRC */
+static void test_set_sequence(uint16_t page, uint32_t sequence)
+{
+	uint8_t record[EEPROM_G3_PAGE_SIZE];
+	uint16_t crc;
+
+	eeprom_file_backend.read(page, record, sizeof(record));
+	record[TEST_SEQUENCE_OFFSET] = (uint8_t)(sequence & 0xFF);
+	record[TEST_SEQUENCE_OFFSET + 1] = (uint8_t)((sequence >> 8) & 0xFF);
+	record[TEST_SEQUENCE_OFFSET + 2] = (uint8_t)((sequence >> 16) & 0xFF);
+	record[TEST_SEQUENCE_OFFSET + 3] = (uint8_t)(sequence >> 24);
+	crc = test_crc16(record, TEST_CRC_OFFSET);
+	record[TEST_CRC_OFFSET] = (uint8_t)(crc & 0xFF);
+	record[TEST_CRC_OFFSET + 1] = (uint8_t)(crc >> 8);
+	eeprom_file_backend.write(page, record, sizeof(record));
+}
+
+static void test_flip_byte(uint16_t page, uint32_t offset)
+{
+	uint8_t record[EEPROM_G3_PAGE_SIZE];
+
+	eeprom_file_backend.read(page, record, sizeof(record));
+	record[offset] ^= 0x40;
+	eeprom_file_backend.write(page, record, sizeof(record));
+}
+
+/* Reboots: the ring position is forgotten and found again by read_eeprom_g3() */
+static int test_reboot_read(config_g3_t *config)
+{
+	eeprom_g3_init(&counting_backend);
+	return read_eeprom_g3(config);
+}
+
+static int test_round_trip(void)
+{
+	config_g3_t written, read;
+
+	test_erase();
+	test_config(&written, 1);
+	if (write_eeprom_g3(&written) != 1 || test_reboot_read(&read) != 1 || !configs_equal(&written, &read))
+	{
+		return 0;
+	}
+	/* Unchanged record after the boot: no program cycle */
+	return write_eeprom_g3(&read) == 0 && page_writes[EEPROM_G3_FIRST_PAGE] == 1 && stray_writes == 0;
+}
+
+static int test_crc_rejection(void)
+{
+	config_g3_t first, second, read, defaults;
+
+	test_erase();
+	test_config(&first, 1);
+	test_config(&second, 2);
+	write_eeprom_g3(&first);
+	write_eeprom_g3(&second);
+
+	/* A flipped payload byte of the newest record: the previous one wins */
+	test_flip_byte(EEPROM_G3_FIRST_PAGE + 1, 12);
+	if (test_reboot_read(&read) != 1 || !configs_equal(&first, &read))
+	{
+		return 0;
+	}
+
+	/* A flipped CRC byte as well: nothing valid is left, the defaults are returned */
+	test_flip_byte(EEPROM_G3_FIRST_PAGE, TEST_CRC_OFFSET);
+	config_g3_defaults(&defaults, 0);
+	return test_reboot_read(&read) == 0 && configs_equal(&defaults, &read);
+}
+
+static int test_sequence_wrap(void)
+{
+	config_g3_t config, read;
+	int i;
+
+	/* First record forged two writes before the wrap */
+	test_erase();
+	test_config(&config, 0);
+	write_eeprom_g3(&config);
+	test_set_sequence(EEPROM_G3_FIRST_PAGE, 0xFFFFFFFEu);
+	if (test_reboot_read(&read) != 1 || !configs_equal(&config, &read))
+	{
+		return 0;
+	}
+
+	/* Sequence numbers 0xFFFFFFFF, 0 and 1, each checked after a reboot */
+	for (i = 1; i <= 3; i++)
+	{
+		test_config(&config, i);
+		if (write_eeprom_g3(&config) != 1 || test_reboot_read(&read) != 1 || !configs_equal(&config, &read))
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static int test_wear_levelling(void)
+{
+	config_g3_t config, read;
+	int i;
+	uint16_t page;
+
+	test_erase();
+	for (i = 0; i < 2 * EEPROM_G3_PAGES + 1; i++)
+	{
+		test_config(&config, i);
+		if (write_eeprom_g3(&config) != 1)
+		{
+			return 0;
+		}
+		/* One page program per write, on the page after the previous one */
+		page = (uint16_t)(EEPROM_G3_FIRST_PAGE + (i % EEPROM_G3_PAGES));
+		if (page_writes[page] != (uint32_t)(i / EEPROM_G3_PAGES + 1))
+		{
+			return 0;
+		}
+		/* Every third write reboots, the ring goes on from the newest record */
+		if (i % 3 == 2 && (test_reboot_read(&read) != 1 || !configs_equal(&config, &read)))
+		{
+			return 0;
+		}
+	}
+	return stray_writes == 0;
+}
+
+static int test_legacy(void)
+{
+	config_g3_t read, defaults;
+	uint8_t algorithm = 3;
+
+	/* Page 0 as left by the single byte format */
+	test_erase();
+	eeprom_file_backend.write(EEPROM_G3_FIRST_PAGE, &algorithm, 1);
+	config_g3_defaults(&defaults, 3);
+	if (test_reboot_read(&read) != 0 || !configs_equal(&defaults, &read))
+	{
+		return 0;
+	}
+
+	/* A byte that was never an algorithm number */
+	test_erase();
+	algorithm = 7;
+	eeprom_file_backend.write(EEPROM_G3_FIRST_PAGE, &algorithm, 1);
+	config_g3_defaults(&defaults, 0);
+	if (test_reboot_read(&read) != 0 || !configs_equal(&defaults, &read))
+	{
+		return 0;
+	}
+
+	/* The first record written replaces the legacy byte */
+	config_g3_defaults(&defaults, 2);
+	return write_eeprom_g3(&defaults) == 1 && test_reboot_read(&read) == 1 && configs_equal(&defaults, &read);
+}
+
+typedef struct test_t
+{
+	const char *name;
+	int (*run)(void);
+} test_t;
+
+static const test_t tests[] = {
+	{"round_trip", test_round_trip},
+	{"crc_rejection", test_crc_rejection},
+	{"sequence_wrap", test_sequence_wrap},
+	{"wear_levelling", test_wear_levelling},
+	{"legacy", test_legacy}
+};
+
+int main(int argc, char *argv[])
+{
+	int i, ok, failed = 0;
+	int count = (int)(sizeof(tests) / sizeof(tests[0]));
+
+	if (argc > 2)
+	{
+		fprintf(stderr, "usage: %s [image]\n", argv[0]);
+		return 2;
+	}
+	if (argc == 2)
+	{
+		image_path = argv[1];
+	}
+	eeprom_file_set_path(image_path);
+
+	for (i = 0; i < count; i++)
+	{
+		ok = tests[i].run();
+		failed += !ok;
+		printf("{\"type\": \"check\", \"name\": \"%s\", \"ok\": %s}\n", tests[i].name, ok ? "true" : "false");
+	}
+	printf("{\"type\": \"summary\", \"checks\": %d, \"failed\": %d}\n", count, failed);
+
+	remove(image_path);
+	return failed ? 1 : 0;
+}
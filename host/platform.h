@@ -0,0 +1,23 @@
+/*! \file platform.h
+ * \brief Host stand-in for drivers/platform.h
+ *
+ * The signal processing modules in src/ only need the fixed width integer types and the ADC/DAC geometry from the board
+ * platform header. Putting this directory first on the include path (-Ihost) lets them build on a desktop machine
+ * without the LPC407x device headers, so the same sources can be benchmarked and replayed on the host.
+ */
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stdint.h>
+
+/* Core peripheral frequency of the target, kept so that timing conversions match the board */
+#define CLK_FREQ  120000000UL
+
+typedef int Pin;
+
+#define ADC_BITS 12
+#define ADC_MASK ((1u << ADC_BITS) - 1)
+#define DAC_BITS 10
+#define DAC_MASK ((1u << DAC_BITS) - 1)
+
+#endif
@@ -0,0 +1,101 @@
+/*! \file resampler_poly.c
+ * \brief Functions for resampler_poly.h
+ */
+
+/* C Library Headers */
+#include <stddef.h>
+#include <string.h>
+
+/* Header */
+#include "resampler_poly.h"
+
+/* Generated Tables */
+#include "resampler_poly_taps.h"
+
+#if RESAMPLER_POLY_TAPS_OUTPUT_RATE != G_SAMPLE_RATE
+	#error "resampler_poly_taps.h does not match global_parameters.h, run python3 tools/gen_resampler_taps.py"
+#endif
+#if RESAMPLER_TAPS_LONGEST > RESAMPLER_MAX_TAPS
+	#error "RESAMPLER_MAX_TAPS is too small for the generated tables"
+#endif
+
+static const resampler_filter_t resampler_filters[] = {
+	RESAMPLER_FILTER_TABLE
+};
+
+const resampler_filter_t *resampler_find(uint32_t input_rate)
+{
+	int i;
+
+	for (i = 0; i < (int)(sizeof(resampler_filters) / sizeof(resampler_filters[0])); i++)
+	{
+		if (resampler_filters[i].input_rate == input_rate)
+		{
+			return &resampler_filters[i];
+		}
+	}
+	return NULL;
+}
+
+void resampler_init(resampler_t *resampler, const resampler_filter_t *filter)
+{
+	resampler->filter = filter;
+	memset(resampler->history, 0, sizeof(resampler->history));
+	resampler->position = 0;
+	resampler->phase = 0;
+}
+
+int resampler_max_output(const resampler_filter_t *filter, int count)
+{
+	return (int)(((uint32_t)count * filter->up + filter->down - 1) / filter->down) + 1;
+}
+
+/* One branch of the filter; four partial sums keep the multiply-accumulates independent of each other */
+static float resampler_branch(const float *coeffs, const float *history, int taps)
+{
+	float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+	int k;
+
+	for (k = 0; k + 3 < taps; k += 4)
+	{
+		s0 += coeffs[k] * history[k];
+		s1 += coeffs[k + 1] * history[k + 1];
+		s2 += coeffs[k + 2] * history[k + 2];
+		s3 += coeffs[k + 3] * history[k + 3];
+	}
+	for (; k < taps; k++)
+	{
+		s0 += coeffs[k] * history[k];
+	}
+	return (s0 + s1) + (s2 + s3);
+}
+
+int resampler_process(resampler_t *resampler, const double *input, int count, double *output)
+{
+	const resampler_filter_t *filter = resampler->filter;
+	const int taps = filter->taps;
+	uint16_t position = resampler->position;
+	uint16_t phase = resampler->phase;
+	int produced = 0;
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		/* The newest sample goes in front, and again one branch length further so the window never wraps */
+		position = (position == 0) ? (uint16_t)(taps - 1) : (uint16_t)(position - 1);
+		resampler->history[position] = (float)input[i];
+		resampler->history[position + taps] = (float)input[i];
+
+		/* Every output whose position on the interpolated grid falls before the next input */
+		while (phase < filter->up)
+		{
+			output[produced++] = resampler_branch(&filter->coeffs[phase * taps], &resampler->history[position], taps);
+			phase += filter->down;
+		}
+		phase -= filter->up;
+	}
+
+	resampler->position = position;
+	resampler->phase = phase;
+	return produced;
+}
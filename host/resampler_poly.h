@@ -0,0 +1,84 @@
+/*! \file resampler_poly.h
+ * \brief Streaming polyphase resampler converting 16, 44.1 or 48 kHz input to G_SAMPLE_RATE, host only
+ *
+ * Sources such as host recordings deliver audio at rates the detectors were not designed for. The resampler sits in
+ * front of the detectors and converts by a rational factor up/down. Only the polyphase branch needed for each output
+ * sample is evaluated, so the cost is one branch of taps per output sample whatever the ratio.
+ * The delay line is kept across calls: blocks of any length can be fed one after the other and the output is the same
+ * as if the whole signal had been converted in one go, with no gap or repeated sample at block boundaries.
+ *
+ * It is not part of the firmware: the board samples at G_SAMPLE_RATE, and converting costs more than the detection
+ * it would feed (bench_dtmf reports both), with 14 KB of tables for 44.1 kHz alone.
+ *
+ * The filter tables are generated by tools/gen_resampler_taps.py.
+ */
+
+#ifndef RESAMPLER_POLY_H_
+#define RESAMPLER_POLY_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+
+/*! \def RESAMPLER_MAX_TAPS
+* \brief Capacity of the delay line, in taps per branch
+*/
+#define RESAMPLER_MAX_TAPS 64
+
+/*! \typedef resampler_filter_t
+* \brief Polyphase filter for one input rate
+*/
+typedef struct resampler_filter_t
+{
+	uint32_t input_rate;	/*!< Input rate in Hz */
+	uint16_t up;	/*!< Interpolation factor L */
+	uint16_t down;	/*!< Decimation factor M */
+	uint16_t taps;	/*!< Taps per polyphase branch */
+	float delay;	/*!< Group delay, in input samples */
+	const float *coeffs;	/*!< up branches of taps coefficients, newest input first */
+} resampler_filter_t;
+
+/*! \typedef resampler_t
+* \brief State of a resampler, kept between blocks
+*/
+typedef struct resampler_t
+{
+	const resampler_filter_t *filter;	/*!< Filter in use */
+	float history[2 * RESAMPLER_MAX_TAPS];	/*!< Delay line, written twice so that a branch always reads it in one piece */
+	uint16_t position;	/*!< Position of the newest input in the delay line */
+	uint16_t phase;	/*!< Position of the next output on the interpolated grid, relative to the newest input */
+} resampler_t;
+
+/*! \fn const resampler_filter_t *resampler_find(uint32_t input_rate)
+* \param input_rate Input rate in Hz
+* \returns The filter converting that rate to G_SAMPLE_RATE, or NULL if there is none
+*/
+const resampler_filter_t *resampler_find(uint32_t input_rate);
+
+/*! \fn void resampler_init(resampler_t *resampler, const resampler_filter_t *filter)
+* \param resampler State to reset
+* \param filter Filter to use, from resampler_find()
+* \brief Clears the delay line, the first output samples are the filter's response to silence before the input
+*/
+void resampler_init(resampler_t *resampler, const resampler_filter_t *filter);
+
+/*! \fn int resampler_max_output(const resampler_filter_t *filter, int count)
+* \param filter Filter in use
+* \param count Number of input samples of a block
+* \returns The largest number of output samples resampler_process() can produce for such a block
+*/
+int resampler_max_output(const resampler_filter_t *filter, int count);
+
+/*! \fn int resampler_process(resampler_t *resampler, const double *input, int count, double *output)
+* \param resampler State, updated
+* \param input Block of input samples
+* \param count Number of input samples
+* \param output Output buffer, at least resampler_max_output() samples long
+* \returns Number of output samples written
+* \brief Converts one block
+*/
+int resampler_process(resampler_t *resampler, const double *input, int count, double *output);
+
+#endif
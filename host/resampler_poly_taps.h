@@ -0,0 +1,493 @@
+/*! \file resampler_poly_taps.h
+* \brief Polyphase filter tables, generated by tools/gen_resampler_taps.py: do not edit
+*
+* Command: python3 tools/gen_resampler_taps.py --pass 2200 --atten 60 --halfband-pass 1700 --halfband-atten 50 --rates 16000,44100,48000
+* Only included by resampler_poly.c.
+*/
+
+#ifndef RESAMPLER_POLY_TAPS_H_
+#define RESAMPLER_POLY_TAPS_H_
+
+#define RESAMPLER_POLY_TAPS_OUTPUT_RATE 8000	/* Output rate the tables were generated for */
+
+/* 16000 Hz: up 1, down 2, 18 taps per branch, group delay 8.50 input samples */
+static const float RESAMPLER_TAPS_16000[1 * 18] = {
+	0.000540067152f, -0.00227949464f, -0.00587905726f, 0.0123530576f, 0.0231705277f, -0.0409259593f, -0.0718368464f, 0.138515391f,
+	0.446342314f, 0.446342314f, 0.138515391f, -0.0718368464f, -0.0409259593f, 0.0231705277f, 0.0123530576f, -0.00587905726f,
+	-0.00227949464f, 0.000540067152f
+};
+
+/* 44100 Hz: up 80, down 441, 45 taps per branch, group delay 22.49 input samples */
+static const float RESAMPLER_TAPS_44100[80 * 45] = {
+	7.22186586e-05f, -0.000171840288f, -0.000710702213f, -0.00139845174f, -0.00183870011f, -0.0014852375f, 9.69745202e-05f, 0.00288960069f,
+	0.00616019602f, 0.00846876341f, 0.00805737083f, 0.00358355307f, -0.00502660674f, -0.0159599465f, -0.0254846079f, -0.028693663f,
+	-0.0209267216f, 0.00053047901f, 0.0350587538f, 0.0781994073f, 0.122345671f, 0.158540508f, 0.178877081f, 0.178744106f,
+	0.158172082f, 0.121824307f, 0.0776357653f, 0.0345609045f, 0.00017630167f, -0.0211056602f, -0.0287128991f, -0.0253938652f,
+	-0.0158225107f, -0.00489873678f, 0.00366664069f, 0.00808576112f, 0.00845310367f, 0.00612167698f, 0.00284940748f, 6.90176888e-05f,
+	-0.00149665964f, -0.00183693593f, -0.00139032391f, -0.00070247793f, -0.00016692291f, 7.08902877e-05f, -0.000176806521f, -0.000718953292f,
+	-0.00140654316f, -0.00184033899f, -0.00147361733f, 0.000125130259f, 0.0029298785f, 0.00619856954f, 0.008483993f, 0.00802832887f,
+	0.00349979352f, -0.00515486612f, -0.0160971787f, -0.0255743611f, -0.0286726861f, -0.0207455988f, 0.000886750892f, 0.0355579919f,
+	0.0787632251f, 0.122865779f, 0.158906413f, 0.179006794f, 0.178607875f, 0.157801146f, 0.121301704f, 0.0770723165f,
+	0.0340644562f, -0.00017577619f, -0.0212824174f, -0.0287304023f, -0.0253021433f, -0.0156848804f, -0.00477126178f, 0.00374905488f,
+	0.00811350153f, 0.00843701723f, 0.00608301582f, 0.00280930108f, 4.12604073e-05f, -0.00150788434f, -0.00183504758f, -0.00138216068f,
+	-0.000694280978f, -0.000162054419f, 6.95236702e-05f, -0.000181821572f, -0.000727230627f, -0.00141459714f, -0.00184185145f, -0.00146179856f,
+	0.000153484246f, 0.0029702387f, 0.00623679411f, 0.00849878899f, 0.00799863347f, 0.00341536356f, -0.00528350929f, -0.0162341984f,
+	-0.0256631147f, -0.0286499603f, -0.0205622894f, 0.00124511228f, 0.0360586061f, 0.0793272015f, 0.123384613f, 0.159269781f,
+	0.179133242f, 0.178468393f, 0.157427714f, 0.12077788f, 0.0765090779f, 0.0335694214f, -0.000525749728f, -0.0214569957f,
+	-0.0287461808f, -0.0252094521f, -0.0155470645f, -0.00464418724f, 0.00383079423f, 0.00814059391f, 0.00842050755f, 0.00604421594f,
+	0.00276928367f, 1.37032992e-05f, -0.00151891219f, -0.00183303617f, -0.00137396305f, -0.000686111881f, -0.000157234843f, 6.81185469e-05f,
+	-0.000186885398f, -0.000735533672f, -0.00142261268f, -0.00184323638f, -0.00144978063f, 0.000182035801f, 0.00301067904f, 0.00627486632f,
+	0.00851314794f, 0.00796828288f, 0.00333026477f, -0.00541253061f, -0.0163709964f, -0.0257508584f, -0.0286254776f, -0.020376791f,
+	0.00160555803f, 0.0365605841f, 0.079891319f, 0.123902156f, 0.159630602f, 0.179256418f, 0.178325664f, 0.1570518f,
+	0.120252852f, 0.0759460668f, 0.0330758122f, -0.000873614203f, -0.0216293981f, -0.0287602428f, -0.025115802f, -0.0154090719f,
+	-0.00451751864f, 0.00391185734f, 0.00816704012f, 0.00840357812f, 0.00600528074f, 0.00272935741f, -1.36530304e-05f, -0.00152974379f,
+	-0.00183090284f, -0.00136573201f, -0.00067797116f, -0.000152464201f, 6.66746607e-05f, -0.000191997951f, -0.000743861873f, -0.00143058875f,
+	-0.00184449267f, -0.001437563f, 0.000210784226f, 0.00305119727f, 0.00631278272f, 0.00852706643f, 0.00793727539f, 0.00324449878f,
+	-0.00554192436f, -0.0165075639f, -0.0258375822f, -0.0285992302f, -0.0201891011f, 0.00196808291f, 0.0370639132f, 0.0804555604f,
+	0.124418389f, 0.15998886f, 0.17937632f, 0.178179694f, 0.156673416f, 0.11972664f, 0.0753833004f, 0.0325836408f,
+	-0.00121936497f, -0.0217996272f, -0.0287725963f, -0.0250212032f, -0.0152709114f, -0.00439126136f, 0.00399224289f, 0.00819284205f,
+	0.0083862324f, 0.00596621358f, 0.00268952446f, -4.08079949e-05f, -0.00154037975f, -0.0018286487f, -0.00135746858f, -0.000669859329f,
+	-0.000147742512f, 6.51917568e-05f, -0.000197159178f, -0.000752214669f, -0.00143852432f, -0.00184561919f, -0.00142514513f, 0.000239728804f,
+	0.0030917911f, 0.00635053988f, 0.00854054104f, 0.00790560935f, 0.00315806725f, -0.00567168479f, -0.0166438915f, -0.0259232759f,
+	-0.0285712101f, -0.0199992175f, 0.00233268158f, 0.0375685806f, 0.0810199082f, 0.124933295f, 0.160344544f, 0.179492941f,
+	0.178030489f, 0.156292578f, 0.11919926f, 0.0748207957f, 0.0320929191f, -0.00156299749f, -0.0219676862f, -0.0287832497f,
+	-0.0249256657f, -0.015132592f, -0.00426542076f, 0.00407194957f, 0.00821800163f, 0.0083684739f, 0.00592701784f, 0.00264978693f,
+	-6.77610261e-05f, -0.00155082071f, -0.0018262749f, -0.00134917373f, -0.000661776893f, -0.000143069787f, 6.36695824e-05f, -0.00020236902f,
+	-0.000760591494f, -0.00144641836f, -0.00184661485f, -0.0014125265f, 0.000268868801f, 0.00313245824f, 0.00638813433f, 0.00855356837f,
+	0.0078732831f, 0.00307097193f, -0.0058018061f, -0.0167799702f, -0.0260079293f, -0.0285414097f, -0.0198071382f, 0.00269934862f,
+	0.0380745736f, 0.081584345f, 0.125446857f, 0.160697641f, 0.179606279f, 0.177878053f, 0.155909297f, 0.11867073f,
+	0.0742585699f, 0.0316036593f, -0.00190450732f, -0.0221335779f, -0.0287922112f, -0.0248291998f, -0.0149941224f, -0.00414000216f,
+	0.00415097616f, 0.00824252083f, 0.00835030611f, 0.00588769687f, 0.00261014694f, -9.45115738e-05f, -0.0015610673f, -0.00182378256f,
+	-0.00134084846f, -0.000653724352f, -0.00013844603f, 6.21078869e-05f, -0.000207627411f, -0.000768991774f, -0.00145426983f, -0.00184747853f,
+	-0.00139970659f, 0.000298203462f, 0.00317319637f, 0.00642556263f, 0.00856614503f, 0.00784029503f, 0.00298321457f, -0.00593228242f,
+	-0.0169157909f, -0.0260915324f, -0.0285098212f, -0.0196128608f, 0.00306807848f, 0.0385818792f, 0.0821488534f, 0.125959056f,
+	0.161048139f, 0.179716329f, 0.177722393f, 0.155523588f, 0.118141068f, 0.0736966399f, 0.0311158731f, -0.00224389011f,
+	-0.0222973055f, -0.0287994892f, -0.0247318157f, -0.0148555115f, -0.0040150108f, 0.00422932146f, 0.00826640163f, 0.00833173254f,
+	0.00584825402f, 0.00257060658f, -0.000121059106f, -0.00157112016f, -0.00182117281f, -0.00133249375f, -0.000645702199f, -0.000133871244f,
+	6.05064223e-05f, -0.000212934284f, -0.000777414928f, -0.0014620777f, -0.00184820914f, -0.0013866849f, 0.000327732013f, 0.00321400317f,
+	0.0064628213f, 0.00857826762f, 0.00780664358f, 0.002894797f, -0.00606310786f, -0.0170513443f, -0.0261740749f, -0.0284764367f,
+	-0.0194163835f, 0.00343886554f, 0.0390904847f, 0.0827134158f, 0.126469876f, 0.161396023f, 0.179823086f, 0.177563514f,
+	0.155135465f, 0.117610292f, 0.0731350228f, 0.0306295724f, -0.00258114161f, -0.0224588723f, -0.0288050921f, -0.0246335235f,
+	-0.0147167679f, -0.00389045188f, 0.00430698433f, 0.00828964604f, 0.0083127567f, 0.00580869264f, 0.0025311679f, -0.00014740311f,
+	-0.00158097997f, -0.0018184468f, -0.00132411057f, -0.000637710919f, -0.000129345424f, 5.88649425e-05f, -0.000218289561f, -0.000785860369f,
+	-0.00146984093f, -0.00184880557f, -0.00137346095f, 0.000357453663f, 0.00325487627f, 0.00649990686f, 0.00858993279f, 0.0077723272f,
+	0.00280572111f, -0.00619427645f, -0.0171866213f, -0.0262555469f, -0.0284412488f, -0.0192177044f, 0.00381170407f, 0.0396003768f,
+	0.0832780147f, 0.126979299f, 0.161741283f, 0.179926548f, 0.177401422f, 0.154744941f, 0.117078421f, 0.0725737355f,
+	0.0301447689f, -0.00291625767f, -0.0226182814f, -0.0288090283f, -0.0245343334f, -0.0145779004f, -0.00376633056f, 0.00438396367f,
+	0.00831225613f, 0.00829338211f, 0.00576901605f, 0.00249183296f, -0.000173543089f, -0.00159064737f, -0.00181560565f, -0.00131569991f,
+	-0.000629750993f, -0.000124868561f, 5.71832042e-05f, -0.000223693163f, -0.000794327502f, -0.00147755846f, -0.00184926672f, -0.00136003426f,
+	0.0003873676f, 0.0032958133f, 0.00653681583f, 0.00860113716f, 0.00773734439f, 0.0027159888f, -0.0063257822f, -0.0173216125f,
+	-0.0263359381f, -0.0284042498f, -0.0190168215f, 0.00418658824f, 0.0401115426f, 0.0838426326f, 0.127487308f, 0.162083904f,
+	0.180026709f, 0.177236123f, 0.154352031f, 0.11654547f, 0.0720127949f, 0.0296614742f, -0.00324923426f, -0.0227755363f,
+	-0.0288113062f, -0.0244342557f, -0.0144389177f, -0.00364265193f, 0.00446025843f, 0.00833423396f, 0.00827361231f, 0.00572922756f,
+	0.0024526038f, -0.000199478566f, -0.00160012307f, -0.0018126505f, -0.00130726272f, -0.000621822892f, -0.000120440642f, 5.5460966e-05f,
+	-0.000229145002f, -0.000802815729f, -0.00148522925f, -0.00184959152f, -0.00134640437f, 0.000417472995f, 0.00333681189f, 0.00657354472f,
+	0.0086118774f, 0.00770169368f, 0.00262560204f, -0.00645761904f, -0.0174563087f, -0.0264152385f, -0.0283654322f, -0.0188137332f,
+	0.00456351212f, 0.0406239688f, 0.0844072519f, 0.127993885f, 0.162423877f, 0.180123567f, 0.177067623f, 0.153956749f,
+	0.11601146f, 0.0714522179f, 0.0291796999f, -0.00358006741f, -0.0229306403f, -0.0288119343f, -0.0243333005f, -0.0142998283f,
+	-0.00351942105f, 0.00453586761f, 0.00835558165f, 0.00825345083f, 0.00568933047f, 0.00241348241f, -0.000225209081f, -0.00160940773f,
+	-0.00180958249f, -0.00129879997f, -0.000613927082f, -0.000116061647f, 5.36979895e-05f, -0.000234644987f, -0.00081132444f, -0.00149285223f,
+	-0.00184977885f, -0.00133257082f, 0.000447768998f, 0.00337786961f, 0.00661009003f, 0.00862215016f, 0.00766537362f, 0.00253456288f,
+	-0.00658978088f, -0.0175907006f, -0.026493438f, -0.0283247884f, -0.0186084378f, 0.00494246968f, 0.0411376422f, 0.084971855f,
+	0.128499012f, 0.162761187f, 0.180217118f, 0.176895928f, 0.153559108f, 0.115476407f, 0.0708920213f, 0.0286994575f,
+	-0.00390875327f, -0.0230835971f, -0.0288109213f, -0.024231478f, -0.014160641f, -0.00339664291f, 0.00461079026f, 0.00837630133f,
+	0.00823290122f, 0.00564932809f, 0.0023744708f, -0.000250734193f, -0.00161850208f, -0.00180640277f, -0.00129031262f, -0.000606064022f,
+	-0.000111731553f, 5.18940383e-05f, -0.000240193019f, -0.000819853021f, -0.00150042636f, -0.00184982764f, -0.00131853319f, 0.00047825474f,
+	0.00341898404f, 0.00664644825f, 0.00863195213f, 0.00762838281f, 0.00244287336f, -0.00672226157f, -0.0177247788f, -0.0265705266f,
+	-0.0282823111f, -0.0184009338f, 0.0053234548f, 0.0416525494f, 0.0855364241f, 0.129002673f, 0.163095822f, 0.180307359f,
+	0.176721044f, 0.153159122f, 0.11494033f, 0.0703322219f, 0.0282207582f, -0.00423528809f, -0.0232344101f, -0.0288082757f,
+	-0.0241287984f, -0.0140213643f, -0.00327432246f, 0.00468502546f, 0.00839639516f, 0.00821196701f, 0.00560922369f, 0.00233557093f,
+	-0.000276053477f, -0.0016274068f, -0.00180311247f, -0.00128180163f, -0.000598234164f, -0.00010745033f, 5.00488788e-05f, -0.000245788996f,
+	-0.000828400853f, -0.00150795057f, -0.00184973681f, -0.00130429104f, 0.000508929335f, 0.00346015275f, 0.00668261587f, 0.00864128f,
+	0.0075907199f, 0.00235053562f, -0.0068550549f, -0.0178585341f, -0.026646494f, -0.0282379928f, -0.0181912197f, 0.00570646126f,
+	0.042168677f, 0.0861009418f, 0.12950485f, 0.163427772f, 0.180394285f, 0.176542979f, 0.152756807f, 0.114403247f,
+	0.0697728364f, 0.0277436134f, -0.00455966822f, -0.0233830831f, -0.0288040061f, -0.0240252719f, -0.0138820067f, -0.0031524646f,
+	0.00475857235f, 0.00841586534f, 0.00819065177f, 0.00556902055f, 0.00229678475f, -0.000301166528f, -0.00163612263f, -0.00179971273f,
+	-0.00127326793f, -0.000590437955f, -0.000103217945f, 4.81622801e-05f, -0.000251432807f, -0.000836967308f, -0.00151542379f, -0.00184950527f,
+	-0.00128984396f, 0.000539791876f, 0.00350137326f, 0.00671858936f, 0.00865013047f, 0.00755238354f, 0.00225755182f, -0.00698815463f,
+	-0.0179919569f, -0.0267213304f, -0.0281918264f, -0.017979294f, 0.00609148274f, 0.0426860116f, 0.0866653902f, 0.130005526f,
+	0.163757023f, 0.180477894f, 0.176361737f, 0.152352176f, 0.113865175f, 0.0692138815f, 0.0272680344f, -0.00488189011f,
+	-0.0235296199f, -0.0287981212f, -0.0239209086f, -0.0137425767f, -0.00303107417f, 0.00483143012f, 0.00843471409f, 0.00816895906f,
+	0.00552872192f, 0.0022581142f, -0.000326072957f, -0.00164465029f, -0.00179620471f, -0.00126471247f, -0.000582675832f, -9.90343602e-05f,
+	4.62340135e-05f, -0.000257124339f, -0.000845551751f, -0.00152284496f, -0.00184913195f, -0.00127519155f, 0.000570841435f, 0.00354264309f,
+	0.0067543652f, 0.00865850025f, 0.00751337244f, 0.00216392419f, -0.00712155445f, -0.0181250379f, -0.0267950257f, -0.0281438044f,
+	-0.0177651555f, 0.00647851282f, 0.0432045396f, 0.0872297516f, 0.130504683f, 0.164083563f, 0.180558183f, 0.176177327f,
+	0.151945244f, 0.113326133f, 0.0686553738f, 0.0267940321f, -0.00520195028f, -0.0236740242f, -0.0287906298f, -0.0238157187f,
+	-0.0136030828f, -0.00291015596f, 0.004903598f, 0.00845294366f, 0.00814689244f, 0.00548833105f, 0.00221956119f, -0.000350772392f,
+	-0.00165299052f, -0.00179258953f, -0.00125613619f, -0.000574948228f, -9.48995321e-05f, 4.42638534e-05f, -0.000262863469f, -0.000854153543f,
+	-0.001530213f, -0.00184861578f, -0.00126033342f, 0.00060207707f, 0.00358395976f, 0.00678993986f, 0.00866638608f, 0.00747368533f,
+	0.002069655f, -0.00725524803f, -0.0182577677f, -0.0268675698f, -0.0280939196f, -0.0175488031f, 0.00686754498f, 0.0437242472f,
+	0.0877940084f, 0.131002305f, 0.164407382f, 0.180635149f, 0.175989755f, 0.151536026f, 0.112786138f, 0.06809733f,
+	0.0263216177f, -0.0055198454f, -0.0238163001f, -0.0287815405f, -0.0237097124f, -0.0134635334f, -0.00278971472f, 0.00497507527f,
+	0.00847055633f, 0.00812445548f, 0.00544785118f, 0.00218112762f, -0.000375264482f, -0.00166114407f, -0.00178886835f, -0.00124754002f,
+	-0.000567255568f, -9.0813413e-05f, 4.22515767e-05f, -0.000268650072f, -0.000862772034f, -0.00153752684f, -0.00184795569f, -0.00124526921f,
+	0.000633497813f, 0.00362532073f, 0.0068253098f, 0.0086737847f, 0.007433321f, 0.00197474658f, -0.00738922897f, -0.0183901367f,
+	-0.0269389526f, -0.028042165f, -0.0173302355f, 0.0072585726f, 0.0442451209f, 0.0883581427f, 0.131498374f, 0.164728467f,
+	0.180708789f, 0.175799027f, 0.151124535f, 0.112245209f, 0.0675397666f, 0.0258508021f, -0.00583557219f, -0.0239564515f,
+	-0.0287708623f, -0.0236028999f, -0.0133239369f, -0.00266975513f, 0.00504586124f, 0.0084875544f, 0.00810165177f, 0.00540728552f,
+	0.00214281535f, -0.000399548889f, -0.0016691117f, -0.00178504231f, -0.0012389249f, -0.00055959827f, -8.67759505e-05f, 4.0196963e-05f,
+	-0.000274484015f, -0.000871406573f, -0.00154478539f, -0.00184715062f, -0.00122999855f, 0.000665102682f, 0.00366672348f, 0.00686047147f,
+	0.00868069287f, 0.00739227825f, 0.00187920128f, -0.00752349082f, -0.0185221355f, -0.0270091644f, -0.0279885335f, -0.0171094517f,
+	0.00765158898f, 0.0447671469f, 0.0889221367f, 0.131992874f, 0.165046807f, 0.180779101f, 0.175605151f, 0.150710786f,
+	0.111703364f, 0.0669827001f, 0.0253815961f, -0.00614912749f, -0.0240944824f, -0.0287586039f, -0.0234952913f, -0.0131843016f,
+	-0.00255028184f, 0.0051159553f, 0.00850394021f, 0.00807848487f, 0.00536663729f, 0.00210462624f, -0.000423625295f, -0.00167689417f,
+	-0.00178111256f, -0.00123029173f, -0.000551976748f, -8.27870873e-05f, 3.80997948e-05f, -0.00028036516f, -0.000880056497f, -0.00155198758f,
+	-0.0018461995f, -0.00121452109f, 0.000696890673f, 0.00370816546f, 0.00689542131f, 0.00868710737f, 0.00735055594f, 0.00178302155f,
+	-0.00765802711f, -0.0186537546f, -0.0270781949f, -0.0279330179f, -0.0168864509f, 0.00804658729f, 0.0452903111f, 0.0894859727f,
+	0.132485786f, 0.16536239f, 0.180846081f, 0.175408134f, 0.150294795f, 0.11116062f, 0.0664261469f, 0.0249140104f,
+	-0.00646050825f, -0.0242303971f, -0.0287447742f, -0.0233868968f, -0.0130446359f, -0.00243129942f, 0.00518535685f, 0.0085197161f,
+	0.00805495839f, 0.00532590969f, 0.00206656213f, -0.0004474934f, -0.00168449227f, -0.00177708025f, -0.00122164144f, -0.000544391405f,
+	-7.88467618e-05f, 3.59598575e-05f, -0.000286293362f, -0.00088872114f, -0.00155913232f, -0.00184510129f, -0.00119883651f, 0.000728860764f,
+	0.0037496441f, 0.00693015578f, 0.00869302498f, 0.00730815294f, 0.00168620985f, -0.00779283128f, -0.0187849844f, -0.0271460343f,
+	-0.0278756114f, -0.0166612321f, 0.00844356064f, 0.0458145998f, 0.0900496328f, 0.132977094f, 0.165675205f, 0.180909727f,
+	0.175207982f, 0.149876575f, 0.110616997f, 0.0658701235f, 0.0244480559f, -0.00676971149f, -0.0243641997f, -0.0287293822f,
+	-0.0232777266f, -0.0129049481f, -0.00231281242f, 0.00525406535f, 0.00853488447f, 0.0080310759f, 0.00528510589f, 0.00202862482f,
+	-0.000471152918f, -0.00169190677f, -0.00177294651f, -0.00121297494f, -0.00053684264f, -7.49549077e-05f, 3.37769393e-05f, -0.000292268472f,
+	-0.000897399828f, -0.00156621852f, -0.00184385494f, -0.00118294448f, 0.000761011911f, 0.0037911568f, 0.00696467131f, 0.0086984425f,
+	0.00726506818f, 0.0015887687f, -0.00792789676f, -0.0189158154f, -0.0272126726f, -0.027816307f, -0.0164337946f, 0.00884250202f,
+	0.046339999f, 0.0906130991f, 0.133466782f, 0.16598524f, 0.180970037f, 0.175004704f, 0.149456143f, 0.110072511f,
+	0.0653146462f, 0.023983743f, -0.00707673435f, -0.0244958946f, -0.0287124367f, -0.0231677907f, -0.0127652463f, -0.00219482532f,
+	0.00532208031f, 0.00854944772f, 0.008006841f, 0.00524422908f, 0.00199081612f, -0.000494603583f, -0.00169913847f, -0.00176871249f,
+	-0.00120429314f, -0.000529330846f, -7.11114544e-05f, 3.15508311e-05f, -0.000298290334f, -0.000906091881f, -0.00157324508f, -0.00184245939f,
+	-0.00116684469f, 0.000793343053f, 0.00383270098f, 0.00699896434f, 0.00870335676f, 0.00722130061f, 0.00149070069f, -0.00806321691f,
+	-0.019046238f, -0.0272780999f, -0.0277550978f, -0.0162041378f, 0.00924340431f, 0.0468664945f, 0.0911763538f, 0.133954831f,
+	0.166292484f, 0.181027009f, 0.174798307f, 0.149033511f, 0.109527181f, 0.0647597313f, 0.0235210822f, -0.00738157406f,
+	-0.0246254862f, -0.0286939468f, -0.0230570994f, -0.0126255387f, -0.00207734256f, 0.00538940128f, 0.0085634083f, 0.00798225729f,
+	0.00520328241f, 0.0019531378f, -0.000517845146f, -0.00170618818f, -0.00176437935f, -0.00119559692f, -0.000521856407f, -6.73163264e-05f,
+	2.92813273e-05f, -0.000304358785f, -0.000914796612f, -0.00158021092f, -0.00184091361f, -0.00115053685f, 0.000825853109f, 0.00387427399f,
+	0.00703303129f, 0.00870776459f, 0.00717684924f, 0.00139200843f, -0.00819878505f, -0.0191762425f, -0.0273423062f, -0.0276919771f,
+	-0.0159722611f, 0.00964626033f, 0.0473940721f, 0.0917393789f, 0.134441226f, 0.166596926f, 0.18108064f, 0.174588798f,
+	0.148608697f, 0.108981025f, 0.064205395f, 0.0230600839f, -0.00768422795f, -0.024752979f, -0.0286739215f, -0.0229456627f,
+	-0.0124858336f, -0.0019603685f, 0.00545602786f, 0.00857676866f, 0.00795732837f, 0.00516226903f, 0.00191559162f, -0.000540877373f,
+	-0.00171305671f, -0.00175994823f, -0.0011868872f, -0.000514419702f, -6.35694443e-05f, 2.69682248e-05f, -0.000310473657f, -0.000923513328f,
+	-0.00158711494f, -0.00183921656f, -0.00113402069f, 0.000858540978f, 0.00391587321f, 0.00706686858f, 0.00871166284f, 0.0071317131f,
+	0.00129269461f, -0.00833459447f, -0.0193058194f, -0.0274052816f, -0.0276269381f, -0.015738164f, 0.0100510628f, 0.0479227178f,
+	0.0923021567f, 0.134925949f, 0.166898555f, 0.181130929f, 0.174376185f, 0.148181714f, 0.108434062f, 0.0636516536f,
+	0.0226007585f, -0.00798469345f, -0.0248783774f, -0.0286523698f, -0.0228334908f, -0.0123461391f, -0.00184390749f, 0.00552195968f,
+	0.00858953129f, 0.00793205784f, 0.00512119207f, 0.0018781793f, -0.000563700049f, -0.00171974487f, -0.00175542027f, -0.00117816485f,
+	-0.000507021103f, -5.98707238e-05f, 2.46113237e-05f, -0.000316634777f, -0.000932241328f, -0.00159395603f, -0.00183736722f, -0.00111729594f,
+	0.000891405538f, 0.00395749599f, 0.00710047263f, 0.00871504838f, 0.00708589126f, 0.00119276196f, -0.00847063837f, -0.0194349589f,
+	-0.0274670163f, -0.0275599741f, -0.0155018461f, 0.0104578042f, 0.0484524171f, 0.092864669f, 0.135408983f, 0.167197361f,
+	0.181177874f, 0.174160476f, 0.147752579f, 0.107886309f, 0.0630985232f, 0.0221431162f, -0.00828296808f, -0.025001686f,
+	-0.0286293009f, -0.0227205939f, -0.0122064631f, -0.00172796379f, 0.00558719644f, 0.00860169871f, 0.00790644932f, 0.00508005465f,
+	0.00184090256f, -0.000586312975f, -0.0017262535f, -0.00175079662f, -0.00116943077f, -0.000499660975f, -5.62200765e-05f, 2.22104275e-05f,
+	-0.000322841964f, -0.000940979906f, -0.0016007331f, -0.00183536455f, -0.00110036234f, 0.00092444565f, 0.00399913963f, 0.00713383986f,
+	0.00871791809f, 0.00703938282f, 0.00109221324f, -0.00860690995f, -0.0195636514f, -0.0275275004f, -0.0274910786f, -0.0152633072f,
+	0.0108664772f, 0.0489831557f, 0.093426898f, 0.135890312f, 0.167493331f, 0.181221473f, 0.173941678f, 0.147321305f,
+	0.107337784f, 0.0625460199f, 0.0216871671f, -0.00857904946f, -0.0251229097f, -0.0286047238f, -0.0226069819f, -0.0120668138f,
+	-0.00161254164f, 0.00565173785f, 0.00861327345f, 0.0078805064f, 0.00503885987f, 0.00180376311f, -0.000608715968f, -0.00173258344f,
+	-0.00174607843f, -0.00116068582f, -0.000492339676f, -5.26174097e-05f, 1.97653423e-05f, -0.000329095032f, -0.00094972835f, -0.00160744503f,
+	-0.00183320753f, -0.00108321967f, 0.000957660154f, 0.00404080147f, 0.00716696669f, 0.00872026888f, 0.00699218695f, 0.000991051305f,
+	-0.00874340234f, -0.0196918872f, -0.027586724f, -0.027420245f, -0.0150225469f, 0.0112770742f, 0.0495149192f, 0.0939888258f,
+	0.136369919f, 0.167786456f, 0.181261724f, 0.173719801f, 0.146887908f, 0.106788506f, 0.0619941597f, 0.0212329212f,
+	-0.00887293532f, -0.0252420531f, -0.0285786478f, -0.0224926651f, -0.0119271992f, -0.0014976452f, 0.0057155837f, 0.00862425808f,
+	0.0078542327f, 0.00499761083f, 0.00176676261f, -0.000630908862f, -0.00173873553f, -0.00174126684f, -0.00115193089f, -0.00048505756f,
+	-4.90626264e-05f, 1.72758779e-05f, -0.000335393788f, -0.00095848594f, -0.00161409073f, -0.00183089515f, -0.0010658677f, 0.00099104787f,
+	0.00408247878f, 0.0071998495f, 0.00872209765f, 0.00694430282f, 0.000889279021f, -0.00888010863f, -0.0198196566f, -0.0276446773f,
+	-0.0273474667f, -0.0147795653f, 0.0116895873f, 0.0500476931f, 0.0945504342f, 0.136847788f, 0.168076725f, 0.181298627f,
+	0.17349485f, 0.146452404f, 0.106238492f, 0.0614429587f, 0.0207803886f, -0.00916462346f, -0.0253591211f, -0.028551082f,
+	-0.0223776535f, -0.0117876271f, -0.00138327859f, 0.00577873381f, 0.00863465518f, 0.00782763185f, 0.0049563106f, 0.00172990273f,
+	-0.000652891509f, -0.00174471062f, -0.001736363f, -0.00114316683f, -0.00047781497f, -4.55556253e-05f, 1.4741847e-05f, -0.000341738035f,
+	-0.00096725195f, -0.00162066907f, -0.0018284264f, -0.00104830622f, 0.0010246076f, 0.00412416885f, 0.00723248472f, 0.00872340134f,
+	0.00689572967f, 0.000786899325f, -0.00901702185f, -0.0199469499f, -0.0277013505f, -0.0272727374f, -0.0145343623f, 0.012104009f,
+	0.0505814628f, 0.0951117054f, 0.137323901f, 0.168364127f, 0.181332178f, 0.173266836f, 0.146014808f, 0.105687761f,
+	0.0608924327f, 0.0203295789f, -0.00945411181f, -0.0254741186f, -0.0285220357f, -0.0222619571f, -0.0116481057f, -0.0012694459f,
+	0.00584118802f, 0.00864446736f, 0.00780070744f, 0.00491496226f, 0.00169318509f, -0.000674663777f, -0.00175050958f, -0.00173136806f,
+	-0.00113439451f, -0.000470612246f, -4.20963009e-05f, 1.21630657e-05f, -0.000348127567f, -0.000976025648f, -0.00162717895f, -0.00182580028f,
+	-0.00103053504f, 0.00105833812f, 0.00416586894f, 0.00726486873f, 0.00872417691f, 0.00684646675f, 0.000683915201f, -0.009154135f,
+	-0.0200737572f, -0.0277567338f, -0.0271960507f, -0.014286938f, 0.0125203313f, 0.0511162137f, 0.0956726214f, 0.137798243f,
+	0.168648653f, 0.181362379f, 0.173035766f, 0.145575135f, 0.105136331f, 0.0603425976f, 0.0198805022f, -0.00974139838f,
+	-0.0255870506f, -0.0284915181f, -0.0221455861f, -0.0115086426f, -0.00115615113f, 0.00590294626f, 0.00865369725f, 0.0077734631f,
+	0.00487356884f, 0.00165661132f, -0.000696225548f, -0.00175613328f, -0.00172628315f, -0.00112561479f, -0.00046344972f, -3.86845436e-05f,
+	9.53935338e-06f, -0.000354562174f, -0.000984806296f, -0.00163361924f, -0.00182301578f, -0.00101255398f, 0.0010922382f, 0.00420757628f,
+	0.00729699794f, 0.00872442133f, 0.00679651338f, 0.000580329685f, -0.00929144103f, -0.0202000687f, -0.0278108174f, -0.0271174004f,
+	-0.0140372926f, 0.0129385462f, 0.051651931f, 0.096233164f, 0.138270796f, 0.16893029f, 0.181389226f, 0.172801649f,
+	0.145133401f, 0.10458422f, 0.0597934692f, 0.0194331679f, -0.0100264813f, -0.0256979222f, -0.0284595385f, -0.0220285506f,
+	-0.0113692457f, -0.00104339825f, 0.00596400847f, 0.00866234752f, 0.00774590245f, 0.00483213339f, 0.00162018301f, -0.000717576724f,
+	-0.00176158259f, -0.00172110942f, -0.0011168285f, -0.000456327719f, -3.53202396e-05f, 6.87053277e-06f, -0.000361041639f, -0.000993593148f,
+	-0.00163998884f, -0.00182007191f, -0.00099436288f, 0.00112630657f, 0.00424928812f, 0.00732886874f, 0.00872413158f, 0.00674586889f,
+	0.000476145864f, -0.00942893285f, -0.0203258748f, -0.0278635916f, -0.0270367801f, -0.0137854263f, 0.0133586456f, 0.0521886001f,
+	0.0967933153f, 0.138741544f, 0.16920903f, 0.18141272f, 0.172564493f, 0.144689622f, 0.104031447f, 0.0592450634f,
+	0.0189875856f, -0.0103093587f, -0.0258067384f, -0.0284261063f, -0.0219108605f, -0.0112299229f, -0.000931191179f, 0.00602437463f,
+	0.00867042084f, 0.00771802912f, 0.00479065892f, 0.00158390173f, -0.000738717221f, -0.00176685841f, -0.00171584801f, -0.0011080365f,
+	-0.00044924656f, -3.20032713e-05f, 4.15643001e-06f, -0.000367565738f, -0.00100238545f, -0.00164628663f, -0.00181696769f, -0.000975961584f,
+	0.00116054197f, 0.00429100164f, 0.00736047752f, 0.00872330468f, 0.00669453268f, 0.000371366876f, -0.00956660332f, -0.0204511656f,
+	-0.0279150466f, -0.0269541837f, -0.0135313395f, 0.0137806214f, 0.052726206f, 0.0973530572f, 0.13921047f, 0.169484863f,
+	0.181432859f, 0.172324307f, 0.144243813f, 0.103478028f, 0.0586973958f, 0.018543765f, -0.0105900289f, -0.0259135045f,
+	-0.0283912307f, -0.0217925259f, -0.0110906819f, -0.000819533772f, 0.00608404479f, 0.00867791991f, 0.00768984671f, 0.00474914845f,
+	0.00154776905f, -0.00075964697f, -0.00177196162f, -0.00171050007f, -0.00109923962f, -0.000442206557f, -2.87335167e-05f, 1.39687468e-06f,
+	-0.000374134242f, -0.00101118246f, -0.00165251147f, -0.00181370213f, -0.000957349961f, 0.00119494308f, 0.00433271406f, 0.00739182067f,
+	0.00872193765f, 0.00664250416f, 0.000265995912f, -0.00970444524f, -0.0205759311f, -0.0279651728f, -0.0268696051f, -0.0132750326f,
+	0.0142044653f, 0.0532647338f, 0.0979123717f, 0.139677559f, 0.169757777f, 0.181449642f, 0.1720811f, 0.143795989f,
+	0.102923983f, 0.058150482f, 0.0181017153f, -0.0108684904f, -0.0260182258f, -0.0283549213f, -0.0216735569f, -0.0109515304f,
+	-0.000708429844f, 0.00614301902f, 0.00868484747f, 0.00766135885f, 0.00470760496f, 0.0015117865f, -0.000780365922f, -0.00177689312f,
+	-0.00170506673f, -0.0010904387f, -0.000435208016f, -2.551085e-05f, -1.40830015e-06f, -0.000380746915f, -0.00101998339f, -0.00165866225f,
+	-0.00181027425f, -0.000938527891f, 0.0012295086f, 0.00437442254f, 0.00742289457f, 0.00872002753f, 0.00658978281f, 0.000160036211f,
+	-0.00984245139f, -0.0207001617f, -0.0280139605f, -0.0267830383f, -0.0130165063f, 0.014630169f, 0.0538041687f, 0.0984712406f,
+	0.140142794f, 0.170027764f, 0.18146307f, 0.171834881f, 0.143346168f, 0.10236933f, 0.0576043377f, 0.0176614459f,
+	-0.0111447416f, -0.0261209076f, -0.0283171873f, -0.0215539633f, -0.0108124761f, -0.000597883152f, 0.00620129745f, 0.00869120625f,
+	0.00763256917f, 0.00466603143f, 0.00147595559f, -0.000800874041f, -0.00178165383f, -0.00169954913f, -0.00108163455f, -0.000428251236f,
+	-2.23351415e-05f, -4.25925789e-06f, -0.000387403516f, -0.00102878749f, -0.00166473784f, -0.0018066831f, -0.00091949527f, 0.00126423718f,
+	0.00441612425f, 0.00745369561f, 0.00871757139f, 0.00653636812f, 5.34910689e-05f, -0.00998061449f, -0.0208238473f, -0.0280613999f,
+	-0.0266944773f, -0.012755761f, 0.015057724f, 0.0543444955f, 0.099029646f, 0.140606159f, 0.170294813f, 0.181473141f,
+	0.171585658f, 0.142894363f, 0.101814086f, 0.0570589784f, 0.0172229659f, -0.0114187812f, -0.0262215553f, -0.0282780383f,
+	-0.0214337553f, -0.0106735265f, -0.000487897404f, 0.00625888023f, 0.00869699903f, 0.00760348129f, 0.00462443082f, 0.00144027783f,
+	-0.000821171308f, -0.00178624466f, -0.00169394842f, -0.00107282801f, -0.000421336511f, -1.92062575e-05f, -7.15615839e-06f, -0.000394103796f,
+	-0.00103759397f, -0.00167073711f, -0.00180292771f, -0.000900252009f, 0.00129912746f, 0.00445781634f, 0.00748422018f, 0.00871456631f,
+	0.00648225965f, -5.36361712e-05f, -0.0101189272f, -0.0209469782f, -0.0281074816f, -0.0266039162f, -0.0124927977f, 0.0154871217f,
+	0.0548856992f, 0.0995875697f, 0.141067637f, 0.170558915f, 0.181479855f, 0.17133344f, 0.142440592f, 0.10125827f,
+	0.0565144195f, 0.0167862845f, -0.0116906077f, -0.0263201744f, -0.0282374837f, -0.0213129429f, -0.0105346894f, -0.000378476255f,
+	0.00631576757f, 0.00870222861f, 0.00757409883f, 0.00458280608f, 0.00140475469f, -0.000841257717f, -0.00179066652f, -0.00168826572f,
+	-0.00106401987f, -0.000414464127f, -1.61240604e-05f, -1.00991579e-05f, -0.000400847499f, -0.00104640205f, -0.00167665894f, -0.00179900711f,
+	-0.000880798033f, 0.00133417808f, 0.00449949594f, 0.00751446465f, 0.0087110094f, 0.00642745697f, -0.000161342112f, -0.0102573822f,
+	-0.0210695443f, -0.0281521958f, -0.0265113492f, -0.012227617f, 0.0159183536f, 0.0554277646f, 0.100144994f, 0.141527213f,
+	0.170820059f, 0.181483213f, 0.171078238f, 0.14198487f, 0.1007019f, 0.0559706764f, 0.0163514108f, -0.01196022f,
+	-0.0264167705f, -0.028195533f, -0.0211915359f, -0.0103959721f, -0.000269623307f, 0.00637195972f, 0.00870689779f, 0.00754442541f,
+	0.00454116015f, 0.00136938763f, -0.000861133283f, -0.00179492036f, -0.00168250219f, -0.00105521095f, -0.000407634365f, -1.30884089e-05f,
+	-1.30884089e-05f, -0.000407634365f, -0.00105521095f, -0.00168250219f, -0.00179492036f, -0.000861133283f, 0.00136938763f, 0.00454116015f,
+	0.00754442541f, 0.00870689779f, 0.00637195972f, -0.000269623307f, -0.0103959721f, -0.0211915359f, -0.028195533f, -0.0264167705f,
+	-0.01196022f, 0.0163514108f, 0.0559706764f, 0.1007019f, 0.14198487f, 0.171078238f, 0.181483213f, 0.170820059f,
+	0.141527213f, 0.100144994f, 0.0554277646f, 0.0159183536f, -0.012227617f, -0.0265113492f, -0.0281521958f, -0.0210695443f,
+	-0.0102573822f, -0.000161342112f, 0.00642745697f, 0.0087110094f, 0.00751446465f, 0.00449949594f, 0.00133417808f, -0.000880798033f,
+	-0.00179900711f, -0.00167665894f, -0.00104640205f, -0.000400847499f, -1.00991579e-05f, -1.61240604e-05f, -0.000414464127f, -0.00106401987f,
+	-0.00168826572f, -0.00179066652f, -0.000841257717f, 0.00140475469f, 0.00458280608f, 0.00757409883f, 0.00870222861f, 0.00631576757f,
+	-0.000378476255f, -0.0105346894f, -0.0213129429f, -0.0282374837f, -0.0263201744f, -0.0116906077f, 0.0167862845f, 0.0565144195f,
+	0.10125827f, 0.142440592f, 0.17133344f, 0.181479855f, 0.170558915f, 0.141067637f, 0.0995875697f, 0.0548856992f,
+	0.0154871217f, -0.0124927977f, -0.0266039162f, -0.0281074816f, -0.0209469782f, -0.0101189272f, -5.36361712e-05f, 0.00648225965f,
+	0.00871456631f, 0.00748422018f, 0.00445781634f, 0.00129912746f, -0.000900252009f, -0.00180292771f, -0.00167073711f, -0.00103759397f,
+	-0.000394103796f, -7.15615839e-06f, -1.92062575e-05f, -0.000421336511f, -0.00107282801f, -0.00169394842f, -0.00178624466f, -0.000821171308f,
+	0.00144027783f, 0.00462443082f, 0.00760348129f, 0.00869699903f, 0.00625888023f, -0.000487897404f, -0.0106735265f, -0.0214337553f,
+	-0.0282780383f, -0.0262215553f, -0.0114187812f, 0.0172229659f, 0.0570589784f, 0.101814086f, 0.142894363f, 0.171585658f,
+	0.181473141f, 0.170294813f, 0.140606159f, 0.099029646f, 0.0543444955f, 0.015057724f, -0.012755761f, -0.0266944773f,
+	-0.0280613999f, -0.0208238473f, -0.00998061449f, 5.34910689e-05f, 0.00653636812f, 0.00871757139f, 0.00745369561f, 0.00441612425f,
+	0.00126423718f, -0.00091949527f, -0.0018066831f, -0.00166473784f, -0.00102878749f, -0.000387403516f, -4.25925789e-06f, -2.23351415e-05f,
+	-0.000428251236f, -0.00108163455f, -0.00169954913f, -0.00178165383f, -0.000800874041f, 0.00147595559f, 0.00466603143f, 0.00763256917f,
+	0.00869120625f, 0.00620129745f, -0.000597883152f, -0.0108124761f, -0.0215539633f, -0.0283171873f, -0.0261209076f, -0.0111447416f,
+	0.0176614459f, 0.0576043377f, 0.10236933f, 0.143346168f, 0.171834881f, 0.18146307f, 0.170027764f, 0.140142794f,
+	0.0984712406f, 0.0538041687f, 0.014630169f, -0.0130165063f, -0.0267830383f, -0.0280139605f, -0.0207001617f, -0.00984245139f,
+	0.000160036211f, 0.00658978281f, 0.00872002753f, 0.00742289457f, 0.00437442254f, 0.0012295086f, -0.000938527891f, -0.00181027425f,
+	-0.00165866225f, -0.00101998339f, -0.000380746915f, -1.40830015e-06f, -2.551085e-05f, -0.000435208016f, -0.0010904387f, -0.00170506673f,
+	-0.00177689312f, -0.000780365922f, 0.0015117865f, 0.00470760496f, 0.00766135885f, 0.00868484747f, 0.00614301902f, -0.000708429844f,
+	-0.0109515304f, -0.0216735569f, -0.0283549213f, -0.0260182258f, -0.0108684904f, 0.0181017153f, 0.058150482f, 0.102923983f,
+	0.143795989f, 0.1720811f, 0.181449642f, 0.169757777f, 0.139677559f, 0.0979123717f, 0.0532647338f, 0.0142044653f,
+	-0.0132750326f, -0.0268696051f, -0.0279651728f, -0.0205759311f, -0.00970444524f, 0.000265995912f, 0.00664250416f, 0.00872193765f,
+	0.00739182067f, 0.00433271406f, 0.00119494308f, -0.000957349961f, -0.00181370213f, -0.00165251147f, -0.00101118246f, -0.000374134242f,
+	1.39687468e-06f, -2.87335167e-05f, -0.000442206557f, -0.00109923962f, -0.00171050007f, -0.00177196162f, -0.00075964697f, 0.00154776905f,
+	0.00474914845f, 0.00768984671f, 0.00867791991f, 0.00608404479f, -0.000819533772f, -0.0110906819f, -0.0217925259f, -0.0283912307f,
+	-0.0259135045f, -0.0105900289f, 0.018543765f, 0.0586973958f, 0.103478028f, 0.144243813f, 0.172324307f, 0.181432859f,
+	0.169484863f, 0.13921047f, 0.0973530572f, 0.052726206f, 0.0137806214f, -0.0135313395f, -0.0269541837f, -0.0279150466f,
+	-0.0204511656f, -0.00956660332f, 0.000371366876f, 0.00669453268f, 0.00872330468f, 0.00736047752f, 0.00429100164f, 0.00116054197f,
+	-0.000975961584f, -0.00181696769f, -0.00164628663f, -0.00100238545f, -0.000367565738f, 4.15643001e-06f, -3.20032713e-05f, -0.00044924656f,
+	-0.0011080365f, -0.00171584801f, -0.00176685841f, -0.000738717221f, 0.00158390173f, 0.00479065892f, 0.00771802912f, 0.00867042084f,
+	0.00602437463f, -0.000931191179f, -0.0112299229f, -0.0219108605f, -0.0284261063f, -0.0258067384f, -0.0103093587f, 0.0189875856f,
+	0.0592450634f, 0.104031447f, 0.144689622f, 0.172564493f, 0.18141272f, 0.16920903f, 0.138741544f, 0.0967933153f,
+	0.0521886001f, 0.0133586456f, -0.0137854263f, -0.0270367801f, -0.0278635916f, -0.0203258748f, -0.00942893285f, 0.000476145864f,
+	0.00674586889f, 0.00872413158f, 0.00732886874f, 0.00424928812f, 0.00112630657f, -0.00099436288f, -0.00182007191f, -0.00163998884f,
+	-0.000993593148f, -0.000361041639f, 6.87053277e-06f, -3.53202396e-05f, -0.000456327719f, -0.0011168285f, -0.00172110942f, -0.00176158259f,
+	-0.000717576724f, 0.00162018301f, 0.00483213339f, 0.00774590245f, 0.00866234752f, 0.00596400847f, -0.00104339825f, -0.0113692457f,
+	-0.0220285506f, -0.0284595385f, -0.0256979222f, -0.0100264813f, 0.0194331679f, 0.0597934692f, 0.10458422f, 0.145133401f,
+	0.172801649f, 0.181389226f, 0.16893029f, 0.138270796f, 0.096233164f, 0.051651931f, 0.0129385462f, -0.0140372926f,
+	-0.0271174004f, -0.0278108174f, -0.0202000687f, -0.00929144103f, 0.000580329685f, 0.00679651338f, 0.00872442133f, 0.00729699794f,
+	0.00420757628f, 0.0010922382f, -0.00101255398f, -0.00182301578f, -0.00163361924f, -0.000984806296f, -0.000354562174f, 9.53935338e-06f,
+	-3.86845436e-05f, -0.00046344972f, -0.00112561479f, -0.00172628315f, -0.00175613328f, -0.000696225548f, 0.00165661132f, 0.00487356884f,
+	0.0077734631f, 0.00865369725f, 0.00590294626f, -0.00115615113f, -0.0115086426f, -0.0221455861f, -0.0284915181f, -0.0255870506f,
+	-0.00974139838f, 0.0198805022f, 0.0603425976f, 0.105136331f, 0.145575135f, 0.173035766f, 0.181362379f, 0.168648653f,
+	0.137798243f, 0.0956726214f, 0.0511162137f, 0.0125203313f, -0.014286938f, -0.0271960507f, -0.0277567338f, -0.0200737572f,
+	-0.009154135f, 0.000683915201f, 0.00684646675f, 0.00872417691f, 0.00726486873f, 0.00416586894f, 0.00105833812f, -0.00103053504f,
+	-0.00182580028f, -0.00162717895f, -0.000976025648f, -0.000348127567f, 1.21630657e-05f, -4.20963009e-05f, -0.000470612246f, -0.00113439451f,
+	-0.00173136806f, -0.00175050958f, -0.000674663777f, 0.00169318509f, 0.00491496226f, 0.00780070744f, 0.00864446736f, 0.00584118802f,
+	-0.0012694459f, -0.0116481057f, -0.0222619571f, -0.0285220357f, -0.0254741186f, -0.00945411181f, 0.0203295789f, 0.0608924327f,
+	0.105687761f, 0.146014808f, 0.173266836f, 0.181332178f, 0.168364127f, 0.137323901f, 0.0951117054f, 0.0505814628f,
+	0.012104009f, -0.0145343623f, -0.0272727374f, -0.0277013505f, -0.0199469499f, -0.00901702185f, 0.000786899325f, 0.00689572967f,
+	0.00872340134f, 0.00723248472f, 0.00412416885f, 0.0010246076f, -0.00104830622f, -0.0018284264f, -0.00162066907f, -0.00096725195f,
+	-0.000341738035f, 1.4741847e-05f, -4.55556253e-05f, -0.00047781497f, -0.00114316683f, -0.001736363f, -0.00174471062f, -0.000652891509f,
+	0.00172990273f, 0.0049563106f, 0.00782763185f, 0.00863465518f, 0.00577873381f, -0.00138327859f, -0.0117876271f, -0.0223776535f,
+	-0.028551082f, -0.0253591211f, -0.00916462346f, 0.0207803886f, 0.0614429587f, 0.106238492f, 0.146452404f, 0.17349485f,
+	0.181298627f, 0.168076725f, 0.136847788f, 0.0945504342f, 0.0500476931f, 0.0116895873f, -0.0147795653f, -0.0273474667f,
+	-0.0276446773f, -0.0198196566f, -0.00888010863f, 0.000889279021f, 0.00694430282f, 0.00872209765f, 0.0071998495f, 0.00408247878f,
+	0.00099104787f, -0.0010658677f, -0.00183089515f, -0.00161409073f, -0.00095848594f, -0.000335393788f, 1.72758779e-05f, -4.90626264e-05f,
+	-0.00048505756f, -0.00115193089f, -0.00174126684f, -0.00173873553f, -0.000630908862f, 0.00176676261f, 0.00499761083f, 0.0078542327f,
+	0.00862425808f, 0.0057155837f, -0.0014976452f, -0.0119271992f, -0.0224926651f, -0.0285786478f, -0.0252420531f, -0.00887293532f,
+	0.0212329212f, 0.0619941597f, 0.106788506f, 0.146887908f, 0.173719801f, 0.181261724f, 0.167786456f, 0.136369919f,
+	0.0939888258f, 0.0495149192f, 0.0112770742f, -0.0150225469f, -0.027420245f, -0.027586724f, -0.0196918872f, -0.00874340234f,
+	0.000991051305f, 0.00699218695f, 0.00872026888f, 0.00716696669f, 0.00404080147f, 0.000957660154f, -0.00108321967f, -0.00183320753f,
+	-0.00160744503f, -0.00094972835f, -0.000329095032f, 1.97653423e-05f, -5.26174097e-05f, -0.000492339676f, -0.00116068582f, -0.00174607843f,
+	-0.00173258344f, -0.000608715968f, 0.00180376311f, 0.00503885987f, 0.0078805064f, 0.00861327345f, 0.00565173785f, -0.00161254164f,
+	-0.0120668138f, -0.0226069819f, -0.0286047238f, -0.0251229097f, -0.00857904946f, 0.0216871671f, 0.0625460199f, 0.107337784f,
+	0.147321305f, 0.173941678f, 0.181221473f, 0.167493331f, 0.135890312f, 0.093426898f, 0.0489831557f, 0.0108664772f,
+	-0.0152633072f, -0.0274910786f, -0.0275275004f, -0.0195636514f, -0.00860690995f, 0.00109221324f, 0.00703938282f, 0.00871791809f,
+	0.00713383986f, 0.00399913963f, 0.00092444565f, -0.00110036234f, -0.00183536455f, -0.0016007331f, -0.000940979906f, -0.000322841964f,
+	2.22104275e-05f, -5.62200765e-05f, -0.000499660975f, -0.00116943077f, -0.00175079662f, -0.0017262535f, -0.000586312975f, 0.00184090256f,
+	0.00508005465f, 0.00790644932f, 0.00860169871f, 0.00558719644f, -0.00172796379f, -0.0122064631f, -0.0227205939f, -0.0286293009f,
+	-0.025001686f, -0.00828296808f, 0.0221431162f, 0.0630985232f, 0.107886309f, 0.147752579f, 0.174160476f, 0.181177874f,
+	0.167197361f, 0.135408983f, 0.092864669f, 0.0484524171f, 0.0104578042f, -0.0155018461f, -0.0275599741f, -0.0274670163f,
+	-0.0194349589f, -0.00847063837f, 0.00119276196f, 0.00708589126f, 0.00871504838f, 0.00710047263f, 0.00395749599f, 0.000891405538f,
+	-0.00111729594f, -0.00183736722f, -0.00159395603f, -0.000932241328f, -0.000316634777f, 2.46113237e-05f, -5.98707238e-05f, -0.000507021103f,
+	-0.00117816485f, -0.00175542027f, -0.00171974487f, -0.000563700049f, 0.0018781793f, 0.00512119207f, 0.00793205784f, 0.00858953129f,
+	0.00552195968f, -0.00184390749f, -0.0123461391f, -0.0228334908f, -0.0286523698f, -0.0248783774f, -0.00798469345f, 0.0226007585f,
+	0.0636516536f, 0.108434062f, 0.148181714f, 0.174376185f, 0.181130929f, 0.166898555f, 0.134925949f, 0.0923021567f,
+	0.0479227178f, 0.0100510628f, -0.015738164f, -0.0276269381f, -0.0274052816f, -0.0193058194f, -0.00833459447f, 0.00129269461f,
+	0.0071317131f, 0.00871166284f, 0.00706686858f, 0.00391587321f, 0.000858540978f, -0.00113402069f, -0.00183921656f, -0.00158711494f,
+	-0.000923513328f, -0.000310473657f, 2.69682248e-05f, -6.35694443e-05f, -0.000514419702f, -0.0011868872f, -0.00175994823f, -0.00171305671f,
+	-0.000540877373f, 0.00191559162f, 0.00516226903f, 0.00795732837f, 0.00857676866f, 0.00545602786f, -0.0019603685f, -0.0124858336f,
+	-0.0229456627f, -0.0286739215f, -0.024752979f, -0.00768422795f, 0.0230600839f, 0.064205395f, 0.108981025f, 0.148608697f,
+	0.174588798f, 0.18108064f, 0.166596926f, 0.134441226f, 0.0917393789f, 0.0473940721f, 0.00964626033f, -0.0159722611f,
+	-0.0276919771f, -0.0273423062f, -0.0191762425f, -0.00819878505f, 0.00139200843f, 0.00717684924f, 0.00870776459f, 0.00703303129f,
+	0.00387427399f, 0.000825853109f, -0.00115053685f, -0.00184091361f, -0.00158021092f, -0.000914796612f, -0.000304358785f, 2.92813273e-05f,
+	-6.73163264e-05f, -0.000521856407f, -0.00119559692f, -0.00176437935f, -0.00170618818f, -0.000517845146f, 0.0019531378f, 0.00520328241f,
+	0.00798225729f, 0.0085634083f, 0.00538940128f, -0.00207734256f, -0.0126255387f, -0.0230570994f, -0.0286939468f, -0.0246254862f,
+	-0.00738157406f, 0.0235210822f, 0.0647597313f, 0.109527181f, 0.149033511f, 0.174798307f, 0.181027009f, 0.166292484f,
+	0.133954831f, 0.0911763538f, 0.0468664945f, 0.00924340431f, -0.0162041378f, -0.0277550978f, -0.0272780999f, -0.019046238f,
+	-0.00806321691f, 0.00149070069f, 0.00722130061f, 0.00870335676f, 0.00699896434f, 0.00383270098f, 0.000793343053f, -0.00116684469f,
+	-0.00184245939f, -0.00157324508f, -0.000906091881f, -0.000298290334f, 3.15508311e-05f, -7.11114544e-05f, -0.000529330846f, -0.00120429314f,
+	-0.00176871249f, -0.00169913847f, -0.000494603583f, 0.00199081612f, 0.00524422908f, 0.008006841f, 0.00854944772f, 0.00532208031f,
+	-0.00219482532f, -0.0127652463f, -0.0231677907f, -0.0287124367f, -0.0244958946f, -0.00707673435f, 0.023983743f, 0.0653146462f,
+	0.110072511f, 0.149456143f, 0.175004704f, 0.180970037f, 0.16598524f, 0.133466782f, 0.0906130991f, 0.046339999f,
+	0.00884250202f, -0.0164337946f, -0.027816307f, -0.0272126726f, -0.0189158154f, -0.00792789676f, 0.0015887687f, 0.00726506818f,
+	0.0086984425f, 0.00696467131f, 0.0037911568f, 0.000761011911f, -0.00118294448f, -0.00184385494f, -0.00156621852f, -0.000897399828f,
+	-0.000292268472f, 3.37769393e-05f, -7.49549077e-05f, -0.00053684264f, -0.00121297494f, -0.00177294651f, -0.00169190677f, -0.000471152918f,
+	0.00202862482f, 0.00528510589f, 0.0080310759f, 0.00853488447f, 0.00525406535f, -0.00231281242f, -0.0129049481f, -0.0232777266f,
+	-0.0287293822f, -0.0243641997f, -0.00676971149f, 0.0244480559f, 0.0658701235f, 0.110616997f, 0.149876575f, 0.175207982f,
+	0.180909727f, 0.165675205f, 0.132977094f, 0.0900496328f, 0.0458145998f, 0.00844356064f, -0.0166612321f, -0.0278756114f,
+	-0.0271460343f, -0.0187849844f, -0.00779283128f, 0.00168620985f, 0.00730815294f, 0.00869302498f, 0.00693015578f, 0.0037496441f,
+	0.000728860764f, -0.00119883651f, -0.00184510129f, -0.00155913232f, -0.00088872114f, -0.000286293362f, 3.59598575e-05f, -7.88467618e-05f,
+	-0.000544391405f, -0.00122164144f, -0.00177708025f, -0.00168449227f, -0.0004474934f, 0.00206656213f, 0.00532590969f, 0.00805495839f,
+	0.0085197161f, 0.00518535685f, -0.00243129942f, -0.0130446359f, -0.0233868968f, -0.0287447742f, -0.0242303971f, -0.00646050825f,
+	0.0249140104f, 0.0664261469f, 0.11116062f, 0.150294795f, 0.175408134f, 0.180846081f, 0.16536239f, 0.132485786f,
+	0.0894859727f, 0.0452903111f, 0.00804658729f, -0.0168864509f, -0.0279330179f, -0.0270781949f, -0.0186537546f, -0.00765802711f,
+	0.00178302155f, 0.00735055594f, 0.00868710737f, 0.00689542131f, 0.00370816546f, 0.000696890673f, -0.00121452109f, -0.0018461995f,
+	-0.00155198758f, -0.000880056497f, -0.00028036516f, 3.80997948e-05f, -8.27870873e-05f, -0.000551976748f, -0.00123029173f, -0.00178111256f,
+	-0.00167689417f, -0.000423625295f, 0.00210462624f, 0.00536663729f, 0.00807848487f, 0.00850394021f, 0.0051159553f, -0.00255028184f,
+	-0.0131843016f, -0.0234952913f, -0.0287586039f, -0.0240944824f, -0.00614912749f, 0.0253815961f, 0.0669827001f, 0.111703364f,
+	0.150710786f, 0.175605151f, 0.180779101f, 0.165046807f, 0.131992874f, 0.0889221367f, 0.0447671469f, 0.00765158898f,
+	-0.0171094517f, -0.0279885335f, -0.0270091644f, -0.0185221355f, -0.00752349082f, 0.00187920128f, 0.00739227825f, 0.00868069287f,
+	0.00686047147f, 0.00366672348f, 0.000665102682f, -0.00122999855f, -0.00184715062f, -0.00154478539f, -0.000871406573f, -0.000274484015f,
+	4.0196963e-05f, -8.67759505e-05f, -0.00055959827f, -0.0012389249f, -0.00178504231f, -0.0016691117f, -0.000399548889f, 0.00214281535f,
+	0.00540728552f, 0.00810165177f, 0.0084875544f, 0.00504586124f, -0.00266975513f, -0.0133239369f, -0.0236028999f, -0.0287708623f,
+	-0.0239564515f, -0.00583557219f, 0.0258508021f, 0.0675397666f, 0.112245209f, 0.151124535f, 0.175799027f, 0.180708789f,
+	0.164728467f, 0.131498374f, 0.0883581427f, 0.0442451209f, 0.0072585726f, -0.0173302355f, -0.028042165f, -0.0269389526f,
+	-0.0183901367f, -0.00738922897f, 0.00197474658f, 0.007433321f, 0.0086737847f, 0.0068253098f, 0.00362532073f, 0.000633497813f,
+	-0.00124526921f, -0.00184795569f, -0.00153752684f, -0.000862772034f, -0.000268650072f, 4.22515767e-05f, -9.0813413e-05f, -0.000567255568f,
+	-0.00124754002f, -0.00178886835f, -0.00166114407f, -0.000375264482f, 0.00218112762f, 0.00544785118f, 0.00812445548f, 0.00847055633f,
+	0.00497507527f, -0.00278971472f, -0.0134635334f, -0.0237097124f, -0.0287815405f, -0.0238163001f, -0.0055198454f, 0.0263216177f,
+	0.06809733f, 0.112786138f, 0.151536026f, 0.175989755f, 0.180635149f, 0.164407382f, 0.131002305f, 0.0877940084f,
+	0.0437242472f, 0.00686754498f, -0.0175488031f, -0.0280939196f, -0.0268675698f, -0.0182577677f, -0.00725524803f, 0.002069655f,
+	0.00747368533f, 0.00866638608f, 0.00678993986f, 0.00358395976f, 0.00060207707f, -0.00126033342f, -0.00184861578f, -0.001530213f,
+	-0.000854153543f, -0.000262863469f, 4.42638534e-05f, -9.48995321e-05f, -0.000574948228f, -0.00125613619f, -0.00179258953f, -0.00165299052f,
+	-0.000350772392f, 0.00221956119f, 0.00548833105f, 0.00814689244f, 0.00845294366f, 0.004903598f, -0.00291015596f, -0.0136030828f,
+	-0.0238157187f, -0.0287906298f, -0.0236740242f, -0.00520195028f, 0.0267940321f, 0.0686553738f, 0.113326133f, 0.151945244f,
+	0.176177327f, 0.180558183f, 0.164083563f, 0.130504683f, 0.0872297516f, 0.0432045396f, 0.00647851282f, -0.0177651555f,
+	-0.0281438044f, -0.0267950257f, -0.0181250379f, -0.00712155445f, 0.00216392419f, 0.00751337244f, 0.00865850025f, 0.0067543652f,
+	0.00354264309f, 0.000570841435f, -0.00127519155f, -0.00184913195f, -0.00152284496f, -0.000845551751f, -0.000257124339f, 4.62340135e-05f,
+	-9.90343602e-05f, -0.000582675832f, -0.00126471247f, -0.00179620471f, -0.00164465029f, -0.000326072957f, 0.0022581142f, 0.00552872192f,
+	0.00816895906f, 0.00843471409f, 0.00483143012f, -0.00303107417f, -0.0137425767f, -0.0239209086f, -0.0287981212f, -0.0235296199f,
+	-0.00488189011f, 0.0272680344f, 0.0692138815f, 0.113865175f, 0.152352176f, 0.176361737f, 0.180477894f, 0.163757023f,
+	0.130005526f, 0.0866653902f, 0.0426860116f, 0.00609148274f, -0.017979294f, -0.0281918264f, -0.0267213304f, -0.0179919569f,
+	-0.00698815463f, 0.00225755182f, 0.00755238354f, 0.00865013047f, 0.00671858936f, 0.00350137326f, 0.000539791876f, -0.00128984396f,
+	-0.00184950527f, -0.00151542379f, -0.000836967308f, -0.000251432807f, 4.81622801e-05f, -0.000103217945f, -0.000590437955f, -0.00127326793f,
+	-0.00179971273f, -0.00163612263f, -0.000301166528f, 0.00229678475f, 0.00556902055f, 0.00819065177f, 0.00841586534f, 0.00475857235f,
+	-0.0031524646f, -0.0138820067f, -0.0240252719f, -0.0288040061f, -0.0233830831f, -0.00455966822f, 0.0277436134f, 0.0697728364f,
+	0.114403247f, 0.152756807f, 0.176542979f, 0.180394285f, 0.163427772f, 0.12950485f, 0.0861009418f, 0.042168677f,
+	0.00570646126f, -0.0181912197f, -0.0282379928f, -0.026646494f, -0.0178585341f, -0.0068550549f, 0.00235053562f, 0.0075907199f,
+	0.00864128f, 0.00668261587f, 0.00346015275f, 0.000508929335f, -0.00130429104f, -0.00184973681f, -0.00150795057f, -0.000828400853f,
+	-0.000245788996f, 5.00488788e-05f, -0.00010745033f, -0.000598234164f, -0.00128180163f, -0.00180311247f, -0.0016274068f, -0.000276053477f,
+	0.00233557093f, 0.00560922369f, 0.00821196701f, 0.00839639516f, 0.00468502546f, -0.00327432246f, -0.0140213643f, -0.0241287984f,
+	-0.0288082757f, -0.0232344101f, -0.00423528809f, 0.0282207582f, 0.0703322219f, 0.11494033f, 0.153159122f, 0.176721044f,
+	0.180307359f, 0.163095822f, 0.129002673f, 0.0855364241f, 0.0416525494f, 0.0053234548f, -0.0184009338f, -0.0282823111f,
+	-0.0265705266f, -0.0177247788f, -0.00672226157f, 0.00244287336f, 0.00762838281f, 0.00863195213f, 0.00664644825f, 0.00341898404f,
+	0.00047825474f, -0.00131853319f, -0.00184982764f, -0.00150042636f, -0.000819853021f, -0.000240193019f, 5.18940383e-05f, -0.000111731553f,
+	-0.000606064022f, -0.00129031262f, -0.00180640277f, -0.00161850208f, -0.000250734193f, 0.0023744708f, 0.00564932809f, 0.00823290122f,
+	0.00837630133f, 0.00461079026f, -0.00339664291f, -0.014160641f, -0.024231478f, -0.0288109213f, -0.0230835971f, -0.00390875327f,
+	0.0286994575f, 0.0708920213f, 0.115476407f, 0.153559108f, 0.176895928f, 0.180217118f, 0.162761187f, 0.128499012f,
+	0.084971855f, 0.0411376422f, 0.00494246968f, -0.0186084378f, -0.0283247884f, -0.026493438f, -0.0175907006f, -0.00658978088f,
+	0.00253456288f, 0.00766537362f, 0.00862215016f, 0.00661009003f, 0.00337786961f, 0.000447768998f, -0.00133257082f, -0.00184977885f,
+	-0.00149285223f, -0.00081132444f, -0.000234644987f, 5.36979895e-05f, -0.000116061647f, -0.000613927082f, -0.00129879997f, -0.00180958249f,
+	-0.00160940773f, -0.000225209081f, 0.00241348241f, 0.00568933047f, 0.00825345083f, 0.00835558165f, 0.00453586761f, -0.00351942105f,
+	-0.0142998283f, -0.0243333005f, -0.0288119343f, -0.0229306403f, -0.00358006741f, 0.0291796999f, 0.0714522179f, 0.11601146f,
+	0.153956749f, 0.177067623f, 0.180123567f, 0.162423877f, 0.127993885f, 0.0844072519f, 0.0406239688f, 0.00456351212f,
+	-0.0188137332f, -0.0283654322f, -0.0264152385f, -0.0174563087f, -0.00645761904f, 0.00262560204f, 0.00770169368f, 0.0086118774f,
+	0.00657354472f, 0.00333681189f, 0.000417472995f, -0.00134640437f, -0.00184959152f, -0.00148522925f, -0.000802815729f, -0.000229145002f,
+	5.5460966e-05f, -0.000120440642f, -0.000621822892f, -0.00130726272f, -0.0018126505f, -0.00160012307f, -0.000199478566f, 0.0024526038f,
+	0.00572922756f, 0.00827361231f, 0.00833423396f, 0.00446025843f, -0.00364265193f, -0.0144389177f, -0.0244342557f, -0.0288113062f,
+	-0.0227755363f, -0.00324923426f, 0.0296614742f, 0.0720127949f, 0.11654547f, 0.154352031f, 0.177236123f, 0.180026709f,
+	0.162083904f, 0.127487308f, 0.0838426326f, 0.0401115426f, 0.00418658824f, -0.0190168215f, -0.0284042498f, -0.0263359381f,
+	-0.0173216125f, -0.0063257822f, 0.0027159888f, 0.00773734439f, 0.00860113716f, 0.00653681583f, 0.0032958133f, 0.0003873676f,
+	-0.00136003426f, -0.00184926672f, -0.00147755846f, -0.000794327502f, -0.000223693163f, 5.71832042e-05f, -0.000124868561f, -0.000629750993f,
+	-0.00131569991f, -0.00181560565f, -0.00159064737f, -0.000173543089f, 0.00249183296f, 0.00576901605f, 0.00829338211f, 0.00831225613f,
+	0.00438396367f, -0.00376633056f, -0.0145779004f, -0.0245343334f, -0.0288090283f, -0.0226182814f, -0.00291625767f, 0.0301447689f,
+	0.0725737355f, 0.117078421f, 0.154744941f, 0.177401422f, 0.179926548f, 0.161741283f, 0.126979299f, 0.0832780147f,
+	0.0396003768f, 0.00381170407f, -0.0192177044f, -0.0284412488f, -0.0262555469f, -0.0171866213f, -0.00619427645f, 0.00280572111f,
+	0.0077723272f, 0.00858993279f, 0.00649990686f, 0.00325487627f, 0.000357453663f, -0.00137346095f, -0.00184880557f, -0.00146984093f,
+	-0.000785860369f, -0.000218289561f, 5.88649425e-05f, -0.000129345424f, -0.000637710919f, -0.00132411057f, -0.0018184468f, -0.00158097997f,
+	-0.00014740311f, 0.0025311679f, 0.00580869264f, 0.0083127567f, 0.00828964604f, 0.00430698433f, -0.00389045188f, -0.0147167679f,
+	-0.0246335235f, -0.0288050921f, -0.0224588723f, -0.00258114161f, 0.0306295724f, 0.0731350228f, 0.117610292f, 0.155135465f,
+	0.177563514f, 0.179823086f, 0.161396023f, 0.126469876f, 0.0827134158f, 0.0390904847f, 0.00343886554f, -0.0194163835f,
+	-0.0284764367f, -0.0261740749f, -0.0170513443f, -0.00606310786f, 0.002894797f, 0.00780664358f, 0.00857826762f, 0.0064628213f,
+	0.00321400317f, 0.000327732013f, -0.0013866849f, -0.00184820914f, -0.0014620777f, -0.000777414928f, -0.000212934284f, 6.05064223e-05f,
+	-0.000133871244f, -0.000645702199f, -0.00133249375f, -0.00182117281f, -0.00157112016f, -0.000121059106f, 0.00257060658f, 0.00584825402f,
+	0.00833173254f, 0.00826640163f, 0.00422932146f, -0.0040150108f, -0.0148555115f, -0.0247318157f, -0.0287994892f, -0.0222973055f,
+	-0.00224389011f, 0.0311158731f, 0.0736966399f, 0.118141068f, 0.155523588f, 0.177722393f, 0.179716329f, 0.161048139f,
+	0.125959056f, 0.0821488534f, 0.0385818792f, 0.00306807848f, -0.0196128608f, -0.0285098212f, -0.0260915324f, -0.0169157909f,
+	-0.00593228242f, 0.00298321457f, 0.00784029503f, 0.00856614503f, 0.00642556263f, 0.00317319637f, 0.000298203462f, -0.00139970659f,
+	-0.00184747853f, -0.00145426983f, -0.000768991774f, -0.000207627411f, 6.21078869e-05f, -0.00013844603f, -0.000653724352f, -0.00134084846f,
+	-0.00182378256f, -0.0015610673f, -9.45115738e-05f, 0.00261014694f, 0.00588769687f, 0.00835030611f, 0.00824252083f, 0.00415097616f,
+	-0.00414000216f, -0.0149941224f, -0.0248291998f, -0.0287922112f, -0.0221335779f, -0.00190450732f, 0.0316036593f, 0.0742585699f,
+	0.11867073f, 0.155909297f, 0.177878053f, 0.179606279f, 0.160697641f, 0.125446857f, 0.081584345f, 0.0380745736f,
+	0.00269934862f, -0.0198071382f, -0.0285414097f, -0.0260079293f, -0.0167799702f, -0.0058018061f, 0.00307097193f, 0.0078732831f,
+	0.00855356837f, 0.00638813433f, 0.00313245824f, 0.000268868801f, -0.0014125265f, -0.00184661485f, -0.00144641836f, -0.000760591494f,
+	-0.00020236902f, 6.36695824e-05f, -0.000143069787f, -0.000661776893f, -0.00134917373f, -0.0018262749f, -0.00155082071f, -6.77610261e-05f,
+	0.00264978693f, 0.00592701784f, 0.0083684739f, 0.00821800163f, 0.00407194957f, -0.00426542076f, -0.015132592f, -0.0249256657f,
+	-0.0287832497f, -0.0219676862f, -0.00156299749f, 0.0320929191f, 0.0748207957f, 0.11919926f, 0.156292578f, 0.178030489f,
+	0.179492941f, 0.160344544f, 0.124933295f, 0.0810199082f, 0.0375685806f, 0.00233268158f, -0.0199992175f, -0.0285712101f,
+	-0.0259232759f, -0.0166438915f, -0.00567168479f, 0.00315806725f, 0.00790560935f, 0.00854054104f, 0.00635053988f, 0.0030917911f,
+	0.000239728804f, -0.00142514513f, -0.00184561919f, -0.00143852432f, -0.000752214669f, -0.000197159178f, 6.51917568e-05f, -0.000147742512f,
+	-0.000669859329f, -0.00135746858f, -0.0018286487f, -0.00154037975f, -4.08079949e-05f, 0.00268952446f, 0.00596621358f, 0.0083862324f,
+	0.00819284205f, 0.00399224289f, -0.00439126136f, -0.0152709114f, -0.0250212032f, -0.0287725963f, -0.0217996272f, -0.00121936497f,
+	0.0325836408f, 0.0753833004f, 0.11972664f, 0.156673416f, 0.178179694f, 0.17937632f, 0.15998886f, 0.124418389f,
+	0.0804555604f, 0.0370639132f, 0.00196808291f, -0.0201891011f, -0.0285992302f, -0.0258375822f, -0.0165075639f, -0.00554192436f,
+	0.00324449878f, 0.00793727539f, 0.00852706643f, 0.00631278272f, 0.00305119727f, 0.000210784226f, -0.001437563f, -0.00184449267f,
+	-0.00143058875f, -0.000743861873f, -0.000191997951f, 6.66746607e-05f, -0.000152464201f, -0.00067797116f, -0.00136573201f, -0.00183090284f,
+	-0.00152974379f, -1.36530304e-05f, 0.00272935741f, 0.00600528074f, 0.00840357812f, 0.00816704012f, 0.00391185734f, -0.00451751864f,
+	-0.0154090719f, -0.025115802f, -0.0287602428f, -0.0216293981f, -0.000873614203f, 0.0330758122f, 0.0759460668f, 0.120252852f,
+	0.1570518f, 0.178325664f, 0.179256418f, 0.159630602f, 0.123902156f, 0.079891319f, 0.0365605841f, 0.00160555803f,
+	-0.020376791f, -0.0286254776f, -0.0257508584f, -0.0163709964f, -0.00541253061f, 0.00333026477f, 0.00796828288f, 0.00851314794f,
+	0.00627486632f, 0.00301067904f, 0.000182035801f, -0.00144978063f, -0.00184323638f, -0.00142261268f, -0.000735533672f, -0.000186885398f,
+	6.81185469e-05f, -0.000157234843f, -0.000686111881f, -0.00137396305f, -0.00183303617f, -0.00151891219f, 1.37032992e-05f, 0.00276928367f,
+	0.00604421594f, 0.00842050755f, 0.00814059391f, 0.00383079423f, -0.00464418724f, -0.0155470645f, -0.0252094521f, -0.0287461808f,
+	-0.0214569957f, -0.000525749728f, 0.0335694214f, 0.0765090779f, 0.12077788f, 0.157427714f, 0.178468393f, 0.179133242f,
+	0.159269781f, 0.123384613f, 0.0793272015f, 0.0360586061f, 0.00124511228f, -0.0205622894f, -0.0286499603f, -0.0256631147f,
+	-0.0162341984f, -0.00528350929f, 0.00341536356f, 0.00799863347f, 0.00849878899f, 0.00623679411f, 0.0029702387f, 0.000153484246f,
+	-0.00146179856f, -0.00184185145f, -0.00141459714f, -0.000727230627f, -0.000181821572f, 6.95236702e-05f, -0.000162054419f, -0.000694280978f,
+	-0.00138216068f, -0.00183504758f, -0.00150788434f, 4.12604073e-05f, 0.00280930108f, 0.00608301582f, 0.00843701723f, 0.00811350153f,
+	0.00374905488f, -0.00477126178f, -0.0156848804f, -0.0253021433f, -0.0287304023f, -0.0212824174f, -0.00017577619f, 0.0340644562f,
+	0.0770723165f, 0.121301704f, 0.157801146f, 0.178607875f, 0.179006794f, 0.158906413f, 0.122865779f, 0.0787632251f,
+	0.0355579919f, 0.000886750892f, -0.0207455988f, -0.0286726861f, -0.0255743611f, -0.0160971787f, -0.00515486612f, 0.00349979352f,
+	0.00802832887f, 0.008483993f, 0.00619856954f, 0.0029298785f, 0.000125130259f, -0.00147361733f, -0.00184033899f, -0.00140654316f,
+	-0.000718953292f, -0.000176806521f, 7.08902877e-05f, -0.00016692291f, -0.00070247793f, -0.00139032391f, -0.00183693593f, -0.00149665964f,
+	6.90176888e-05f, 0.00284940748f, 0.00612167698f, 0.00845310367f, 0.00808576112f, 0.00366664069f, -0.00489873678f, -0.0158225107f,
+	-0.0253938652f, -0.0287128991f, -0.0211056602f, 0.00017630167f, 0.0345609045f, 0.0776357653f, 0.121824307f, 0.158172082f,
+	0.178744106f, 0.178877081f, 0.158540508f, 0.122345671f, 0.0781994073f, 0.0350587538f, 0.00053047901f, -0.0209267216f,
+	-0.028693663f, -0.0254846079f, -0.0159599465f, -0.00502660674f, 0.00358355307f, 0.00805737083f, 0.00846876341f, 0.00616019602f,
+	0.00288960069f, 9.69745202e-05f, -0.0014852375f, -0.00183870011f, -0.00139845174f, -0.000710702213f, -0.000171840288f, 7.22186586e-05f
+};
+
+/* 48000 Hz: up 1, down 6, 50 taps per branch, group delay 24.50 input samples */
+static const float RESAMPLER_TAPS_48000[1 * 50] = {
+	6.85818557e-05f, -0.00012501941f, -0.000551170356f, -0.00112988361f, -0.00161396289f, -0.00162757812f, -0.000797960975f, 0.00104514419f,
+	0.00367206965f, 0.00635400261f, 0.00794845445f, 0.00720419565f, 0.00323792043f, -0.00395089252f, -0.0131144274f, -0.0217206765f,
+	-0.0263493744f, -0.0234888129f, -0.0105555927f, 0.0131494254f, 0.0458611037f, 0.0833801992f, 0.119782369f, 0.14866985f,
+	0.164652036f, 0.164652036f, 0.14866985f, 0.119782369f, 0.0833801992f, 0.0458611037f, 0.0131494254f, -0.0105555927f,
+	-0.0234888129f, -0.0263493744f, -0.0217206765f, -0.0131144274f, -0.00395089252f, 0.00323792043f, 0.00720419565f, 0.00794845445f,
+	0.00635400261f, 0.00367206965f, 0.00104514419f, -0.000797960975f, -0.00162757812f, -0.00161396289f, -0.00112988361f, -0.000551170356f,
+	-0.00012501941f, 6.85818557e-05f
+};
+
+#define RESAMPLER_TAPS_LONGEST 50	/* Longest branch of the tables */
+
+/* Input rate, up, down, taps per branch, group delay in input samples, table */
+#define RESAMPLER_FILTER_TABLE \
+	{16000, 1, 2, 18, 8.500000f, RESAMPLER_TAPS_16000}, \
+	{44100, 80, 441, 45, 22.493750f, RESAMPLER_TAPS_44100}, \
+	{48000, 1, 6, 50, 24.500000f, RESAMPLER_TAPS_48000}
+
+#endif
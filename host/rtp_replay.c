@@ -0,0 +1,964 @@
+/*! \file rtp_replay.c
+ * \brief Offline in-band DTMF decoder for the RTP streams of a pcap capture
+ *
+ * Reads a classic pcap file (Ethernet, Linux cooked, raw IP or BSD loopback link layer, IPv4 or IPv6, UDP) and picks
+ * out the RTP packets with a G.711 payload, mu-law (payload type 0) or A-law (8). The packets are demultiplexed by
+ * SSRC, put back in sequence number order by a jitter buffer of RTP_JITTER_SLOTS packets per stream and played out
+ * as codes into a per-stream Goertzel decoder: goertzel_g711() and decoder_gtzl() on each frame of G_ARRAY_SIZE
+ * codes, then the digit state machine of digit_state.c, as on the board.
+ *
+ * Lost packets and the pauses of silence suppression are filled with silence codes up to the next RTP timestamp, so
+ * the digits keep their timing; repeating the previous packet instead loses more digits, its phase jumps spread the
+ * tones over the neighbouring bins. A gap of more than a second, or a jump of the sequence number or timestamp, ends
+ * the talk spurt and restarts the decoder of the stream. Packets older than the play out point are dropped as late.
+ *
+ * Memory is bounded whatever the capture: the stream states come from a pool of --max-streams entries allocated at
+ * start, found by SSRC through a hash table. A stream that has not sent a packet for --idle seconds of capture time
+ * is finished and its entry goes back to the pool; a new stream that finds the pool empty is not decoded, and its
+ * packets are counted as dropped.
+ *
+ * The output is one JSON object per line: a "digit" line when a digit ends, with the RTP timestamp of its first
+ * sample and its duration, a "stream" line when a stream is finished, and a "summary" line at the end.
+ *
+ * With --rfc4733 the digits are also sent as RFC 4733 telephone-event packets by rfc4733.c, with the SSRC and the
+ * timestamps of the stream they were found in: to a UDP socket for "udp:host:port", or else to a pcap file of raw
+ * IPv4 datagrams from and to 127.0.0.1 port RTP_EVENT_PORT, stamped with the capture time, which Wireshark decodes
+ * as RTP events once told the port carries RTP.
+ *
+ * Build and run from the repository root:
+ * \code
+ * cc -std=gnu89 -O2 -Ihost -Isrc -Idrivers -o rtp_replay host/rtp_replay.c src/g711.c src/gtzl.c src/decoder_gtzl.c \
+ *    src/digit_state.c src/rfc4733.c src/dtmf_table.c src/complex_g3.c -lm
+ * ./rtp_replay trunk.pcap
+ * ./rtp_replay --max-streams 20000 --idle 30 -o digits.jsonl trunk.pcap
+ * ./rtp_replay --rfc4733 udp:127.0.0.1:5004 trunk.pcap
+ * ./rtp_replay --rfc4733 events.pcap trunk.pcap
+ * \endcode
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+/* C Library Headers */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "dtmf_table.h"
+#include "gtzl.h"
+#include "decoder_gtzl.h"
+#include "digit_state.h"
+#include "g711.h"
+#include "rfc4733.h"
+
+#define RTP_DEFAULT_MAX_STREAMS 4096
+#define RTP_DEFAULT_IDLE_S 10.0
+
+/* Packets a stream holds while waiting for a missing one, 160 ms of 20 ms packets */
+#define RTP_JITTER_SLOTS 8
+
+/* Largest payload kept, 40 ms of G.711, longer packets are counted as oversize and dropped */
+#define RTP_MAX_PAYLOAD 320
+
+/* Longest gap filled with silence, one second; a longer one restarts the decoder of the stream */
+#define RTP_MAX_GAP G_SAMPLE_RATE
+
+/* Sequence number jump taken as a restart of the sender instead of lost packets, as in RFC 3550 */
+#define RTP_MAX_DROPOUT 3000
+
+/* Digits kept for the "stream" line, the "digit" lines have all of them */
+#define RTP_MAX_KEYS 64
+
+#define RTP_PT_PCMU 0
+#define RTP_PT_PCMA 8
+
+/* Link layers of the pcap header */
+#define RTP_LINK_NULL 0
+#define RTP_LINK_ETHERNET 1
+#define RTP_LINK_RAW 101
+#define RTP_LINK_SLL 113
+#define RTP_LINK_SLL2 276
+
+#define RTP_ADDRESS_LENGTH 64	/* "[IPv6]:port" */
+
+/* UDP port of the telephone-event datagrams written to a pcap file */
+#define RTP_EVENT_PORT 5004
+
+/*! \typedef rtp_slot_t
+* \brief A packet waiting in the jitter buffer, empty when length is 0
+*/
+typedef struct rtp_slot_t
+{
+	uint16_t seq;
+	uint16_t length;
+	uint32_t timestamp;
+	unsigned char payload[RTP_MAX_PAYLOAD];
+} rtp_slot_t;
+
+/*! \typedef rtp_stream_t
+* \brief State of one RTP stream, an entry of the pool
+*/
+typedef struct rtp_stream_t
+{
+	uint32_t ssrc;
+	int next;	/* Next entry of the hash chain, or of the free list, -1 at the end */
+	int in_use;
+	uint8_t payload_type;
+	const float *table;	/* Expansion table of the payload type */
+	unsigned char silence;	/* Code of a zero sample */
+	char src[RTP_ADDRESS_LENGTH], dst[RTP_ADDRESS_LENGTH];
+	double first_seen, last_seen;	/* Capture times, in seconds from the first record */
+	/* Jitter buffer */
+	int started;	/* 0 until the first packet sets next_seq */
+	uint16_t next_seq;	/* Sequence number to play out next */
+	int held;	/* Packets in slots[] */
+	rtp_slot_t slots[RTP_JITTER_SLOTS];
+	/* Decoder */
+	int playing;	/* 0 until the first packet sets base_timestamp */
+	uint32_t base_timestamp;	/* RTP timestamp of the first sample given to the digit state machine */
+	uint32_t next_timestamp;	/* RTP timestamp of the next code */
+	unsigned char codes[G_ARRAY_SIZE];	/* Frame being filled */
+	int count;
+	digit_state_t digits;
+	char keys[RTP_MAX_KEYS + 1];
+	int key_count;
+	rfc4733_t events;	/* Telephone-event emitter, its sink is NULL until the first packet is played */
+	/* Statistics */
+	uint32_t packets, lost, late, duplicates, oversize, restarts;
+} rtp_stream_t;
+
+/*! \typedef rtp_replay_t
+* \brief The stream pool and the capture being read
+*/
+typedef struct rtp_replay_t
+{
+	rtp_stream_t *pool;
+	int max_streams;
+	int *buckets;	/* First entry of each hash chain, -1 for none */
+	uint32_t bucket_mask;
+	int free_list;
+	int active, peak;
+	double idle;
+	double now;	/* Capture time of the current record */
+	double last_sweep;
+	digit_state_config_t timing;
+	FILE *out;
+	/* Telephone-event output, to a socket or to a pcap file */
+	int event_output;
+	int event_socket;
+	struct sockaddr_storage event_address;
+	socklen_t event_address_length;
+	FILE *event_file;
+	unsigned long event_packets;
+	/* Statistics */
+	unsigned long records, rtp_packets, skipped, streams, dropped_packets, digits;
+} rtp_replay_t;
+
+static uint32_t rtp_read32(const unsigned char *p, int swap)
+{
+	return swap ? ((uint32_t)p[3] << 24) | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0]
+		: ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint16_t rtp_be16(const unsigned char *p)
+{
+	return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static uint32_t rtp_be32(const unsigned char *p)
+{
+	return rtp_read32(p, 0);
+}
+
+static uint32_t rtp_hash(const rtp_replay_t *replay, uint32_t ssrc)
+{
+	return (ssrc * 2654435761u) & replay->bucket_mask;
+}
+
+static void rtp_write32(unsigned char *p, uint32_t value)
+{
+	p[0] = (unsigned char)(value >> 24);
+	p[1] = (unsigned char)(value >> 16);
+	p[2] = (unsigned char)(value >> 8);
+	p[3] = (unsigned char)value;
+}
+
+/* Sink of the telephone-event emitters: one datagram, or one pcap record with its IPv4 and UDP headers */
+static void rtp_event_sink(void *context, const uint8_t *packet, int length)
+{
+	rtp_replay_t *replay = (rtp_replay_t *)context;
+	unsigned char headers[16 + 28];
+	unsigned char *ip = headers + 16;
+	uint32_t sum = 0, sec, usec;
+	int i;
+
+	replay->event_packets++;
+	if (replay->event_file == NULL)
+	{
+		sendto(replay->event_socket, packet, (size_t)length, 0, (const struct sockaddr *)&replay->event_address,
+			replay->event_address_length);
+		return;
+	}
+
+	/* Record header, in the byte order of this host like the file header */
+	sec = (uint32_t)replay->now;
+	usec = (uint32_t)((replay->now - sec) * 1e6);
+	memcpy(headers, &sec, 4);
+	memcpy(headers + 4, &usec, 4);
+	i = 28 + length;
+	memcpy(headers + 8, &i, 4);
+	memcpy(headers + 12, &i, 4);
+	/* IPv4 from and to 127.0.0.1, then UDP without checksum */
+	memset(ip, 0, 28);
+	ip[0] = 0x45;
+	ip[2] = (unsigned char)((28 + length) >> 8);
+	ip[3] = (unsigned char)(28 + length);
+	ip[8] = 64;
+	ip[9] = 17;
+	rtp_write32(ip + 12, 0x7f000001);
+	rtp_write32(ip + 16, 0x7f000001);
+	for (i = 0; i < 20; i += 2)
+	{
+		sum += (uint32_t)((ip[i] << 8) | ip[i + 1]);
+	}
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = ~((sum & 0xffff) + (sum >> 16)) & 0xffff;
+	ip[10] = (unsigned char)(sum >> 8);
+	ip[11] = (unsigned char)sum;
+	ip[20] = ip[22] = (unsigned char)(RTP_EVENT_PORT >> 8);
+	ip[21] = ip[23] = (unsigned char)(RTP_EVENT_PORT & 0xff);
+	ip[24] = (unsigned char)((8 + length) >> 8);
+	ip[25] = (unsigned char)(8 + length);
+	fwrite(headers, 1, sizeof(headers), replay->event_file);
+	fwrite(packet, 1, (size_t)length, replay->event_file);
+}
+
+/* Opens the telephone-event output, "udp:host:port" or a file name, returns 0 on success */
+static int rtp_event_open(rtp_replay_t *replay, const char *destination)
+{
+	struct addrinfo hints, *result;
+	char host[256];
+	const char *port;
+	uint32_t header[6];
+
+	replay->event_output = 1;
+	if (strncmp(destination, "udp:", 4) != 0)
+	{
+		replay->event_file = fopen(destination, "wb");
+		if (replay->event_file == NULL)
+		{
+			perror(destination);
+			return 1;
+		}
+		/* pcap file header: microseconds, raw IP link layer */
+		header[0] = 0xa1b2c3d4;
+		header[1] = 2 | (4u << 16);
+		header[2] = 0;
+		header[3] = 0;
+		header[4] = 65535;
+		header[5] = RTP_LINK_RAW;
+		if (*(const unsigned char *)&header[1] != 2)
+		{
+			header[1] = 4 | (2u << 16);
+		}
+		fwrite(header, 1, sizeof(header), replay->event_file);
+		return 0;
+	}
+
+	port = strrchr(destination + 4, ':');
+	if (port == NULL || port - (destination + 4) >= (int)sizeof(host))
+	{
+		fprintf(stderr, "rtp_replay: %s: expected udp:host:port\n", destination);
+		return 1;
+	}
+	memcpy(host, destination + 4, (size_t)(port - (destination + 4)));
+	host[port - (destination + 4)] = '\0';
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_DGRAM;
+	if (getaddrinfo(host, port + 1, &hints, &result) != 0)
+	{
+		fprintf(stderr, "rtp_replay: %s: unknown host or port\n", destination);
+		return 1;
+	}
+	replay->event_socket = socket(result->ai_family, SOCK_DGRAM, 0);
+	memcpy(&replay->event_address, result->ai_addr, result->ai_addrlen);
+	replay->event_address_length = result->ai_addrlen;
+	freeaddrinfo(result);
+	if (replay->event_socket < 0)
+	{
+		perror("socket");
+		return 1;
+	}
+	return 0;
+}
+
+/* Writes the key of a frame and the digits it ends, RTP timestamps are taken from the start of the talk spurt */
+static void rtp_stream_frame(rtp_replay_t *replay, rtp_stream_t *stream)
+{
+	double amplitudes[DTMF_FREQ_AMT];
+	digit_event_t events[DIGIT_STATE_MAX_EVENTS];
+	struct_tone_frequencies tones;
+	char key = DIGIT_STATE_NO_KEY;
+	int e, n;
+
+	goertzel_g711(stream->codes, stream->table, amplitudes);
+	tones = decoder_gtzl(amplitudes);
+	if (tones.low >= 0 && tones.high >= 0)
+	{
+		key = dtmf_key_table[tones.low][tones.high];
+	}
+	stream->count = 0;
+
+	n = digit_state_update(&stream->digits, key, events);
+	if (replay->event_output)
+	{
+		rfc4733_digit_events(&stream->events, &stream->digits, events, n);
+	}
+	for (e = 0; e < n; e++)
+	{
+		if (events[e].type == DIGIT_EVENT_PRESS)
+		{
+			if (stream->key_count < RTP_MAX_KEYS)
+			{
+				stream->keys[stream->key_count++] = events[e].key;
+				stream->keys[stream->key_count] = '\0';
+			}
+		}
+		else if (events[e].type == DIGIT_EVENT_RELEASE)
+		{
+			replay->digits++;
+			fprintf(replay->out, "{\"event\": \"digit\", \"ssrc\": \"0x%08lx\", \"key\": \"%c\", \"rtp_timestamp\": %lu, "
+				"\"duration_ms\": %.1f, \"capture_time\": %.6f}\n",
+				(unsigned long)stream->ssrc, events[e].key,
+				(unsigned long)(uint32_t)(stream->base_timestamp + events[e].start),
+				(events[e].end - events[e].start) * 1000.0 / G_SAMPLE_RATE, replay->now);
+		}
+	}
+}
+
+/* Appends codes to the frame being filled, decoding each frame as it fills */
+static void rtp_stream_feed(rtp_replay_t *replay, rtp_stream_t *stream, const unsigned char *codes, int count)
+{
+	int size;
+
+	while (count > 0)
+	{
+		size = G_ARRAY_SIZE - stream->count;
+		if (size > count)
+		{
+			size = count;
+		}
+		if (codes != NULL)
+		{
+			memcpy(stream->codes + stream->count, codes, (size_t)size);
+			codes += size;
+		}
+		else
+		{
+			memset(stream->codes + stream->count, stream->silence, (size_t)size);
+		}
+		stream->count += size;
+		count -= size;
+		stream->next_timestamp += (uint32_t)size;
+		if (stream->count == G_ARRAY_SIZE)
+		{
+			rtp_stream_frame(replay, stream);
+		}
+	}
+}
+
+/* Ends the talk spurt: silence completes the frame and outlasts the hysteresis so a held digit ends, then the decoder
+ * starts over */
+static void rtp_stream_end_spurt(rtp_replay_t *replay, rtp_stream_t *stream)
+{
+	if (!stream->playing)
+	{
+		return;
+	}
+	rtp_stream_feed(replay, stream, NULL, (G_ARRAY_SIZE - stream->count) + (replay->timing.hysteresis + 1) * G_ARRAY_SIZE);
+	if (replay->event_output)
+	{
+		rfc4733_flush(&stream->events, stream->digits.now);
+	}
+	stream->playing = 0;
+}
+
+/* Plays a packet out to the decoder, filling the time since the previous one with silence */
+static void rtp_stream_play(rtp_replay_t *replay, rtp_stream_t *stream, const rtp_slot_t *slot)
+{
+	int32_t gap;
+	int skip = 0;
+
+	if (stream->playing)
+	{
+		gap = (int32_t)(slot->timestamp - stream->next_timestamp);
+		if (gap > RTP_MAX_GAP || gap < -RTP_MAX_GAP)
+		{
+			rtp_stream_end_spurt(replay, stream);
+			stream->restarts++;
+		}
+		else if (gap > 0)
+		{
+			rtp_stream_feed(replay, stream, NULL, gap);
+		}
+		else
+		{
+			/* Overlaps the previous packet, only the new codes are played */
+			skip = -gap < slot->length ? -gap : slot->length;
+		}
+	}
+	if (!stream->playing)
+	{
+		stream->playing = 1;
+		stream->base_timestamp = slot->timestamp;
+		stream->next_timestamp = slot->timestamp;
+		stream->count = 0;
+		digit_state_init(&stream->digits, &replay->timing);
+		if (stream->events.sink == NULL)
+		{
+			rfc4733_init(&stream->events, stream->ssrc, slot->timestamp, rtp_event_sink, replay);
+		}
+		/* The event sequence numbers go on across the restarts of the decoder, only the time base changes */
+		stream->events.timestamp_base = slot->timestamp;
+	}
+	rtp_stream_feed(replay, stream, slot->payload + skip, slot->length - skip);
+}
+
+/* Moves the play out point by one packet, playing it if it arrived */
+static void rtp_stream_advance(rtp_replay_t *replay, rtp_stream_t *stream)
+{
+	rtp_slot_t *slot = &stream->slots[stream->next_seq % RTP_JITTER_SLOTS];
+
+	if (slot->length > 0 && slot->seq == stream->next_seq)
+	{
+		rtp_stream_play(replay, stream, slot);
+		slot->length = 0;
+		stream->held--;
+	}
+	else
+	{
+		stream->lost++;
+	}
+	stream->next_seq++;
+}
+
+/* Plays out every packet still held, in order */
+static void rtp_stream_drain(rtp_replay_t *replay, rtp_stream_t *stream)
+{
+	while (stream->held > 0)
+	{
+		rtp_stream_advance(replay, stream);
+	}
+}
+
+/* Puts a packet in the jitter buffer and plays out the packets that are now in sequence */
+static void rtp_stream_receive(rtp_replay_t *replay, rtp_stream_t *stream, uint16_t seq, uint32_t timestamp,
+	const unsigned char *payload, int length)
+{
+	rtp_slot_t *slot;
+	int diff;
+
+	stream->packets++;
+	stream->last_seen = replay->now;
+	if (length > RTP_MAX_PAYLOAD)
+	{
+		stream->oversize++;
+		return;
+	}
+	if (!stream->started)
+	{
+		stream->started = 1;
+		stream->next_seq = seq;
+	}
+
+	diff = (int16_t)(uint16_t)(seq - stream->next_seq);
+	if (diff > RTP_MAX_DROPOUT || diff < -RTP_MAX_DROPOUT)
+	{
+		/* The sender restarted its numbering */
+		rtp_stream_drain(replay, stream);
+		rtp_stream_end_spurt(replay, stream);
+		stream->restarts++;
+		stream->next_seq = seq;
+		diff = 0;
+	}
+	if (diff < 0)
+	{
+		stream->late++;
+		return;
+	}
+	while (diff >= RTP_JITTER_SLOTS)
+	{
+		/* The missing packet has been waited for as long as the buffer allows */
+		rtp_stream_advance(replay, stream);
+		diff--;
+	}
+
+	slot = &stream->slots[seq % RTP_JITTER_SLOTS];
+	if (slot->length > 0)
+	{
+		stream->duplicates++;
+		return;
+	}
+	slot->seq = seq;
+	slot->timestamp = timestamp;
+	slot->length = (uint16_t)length;
+	memcpy(slot->payload, payload, (size_t)length);
+	stream->held++;
+
+	while (stream->held > 0 && stream->slots[stream->next_seq % RTP_JITTER_SLOTS].length > 0)
+	{
+		rtp_stream_advance(replay, stream);
+	}
+}
+
+/* Finds the stream of an SSRC, or takes a new one from the pool, NULL if the pool is empty */
+static rtp_stream_t *rtp_stream_get(rtp_replay_t *replay, uint32_t ssrc, uint8_t payload_type, const char *src,
+	const char *dst)
+{
+	uint32_t bucket = rtp_hash(replay, ssrc);
+	rtp_stream_t *stream;
+	int i;
+
+	for (i = replay->buckets[bucket]; i >= 0; i = replay->pool[i].next)
+	{
+		if (replay->pool[i].ssrc == ssrc)
+		{
+			return &replay->pool[i];
+		}
+	}
+	if (replay->free_list < 0)
+	{
+		replay->dropped_packets++;
+		return NULL;
+	}
+
+	i = replay->free_list;
+	stream = &replay->pool[i];
+	replay->free_list = stream->next;
+	memset(stream, 0, sizeof(*stream));
+	stream->ssrc = ssrc;
+	stream->in_use = 1;
+	stream->payload_type = payload_type;
+	stream->table = g711_table(payload_type == RTP_PT_PCMA ? G711_ALAW : G711_ULAW);
+	stream->silence = payload_type == RTP_PT_PCMA ? 0xd5 : 0xff;
+	strcpy(stream->src, src);
+	strcpy(stream->dst, dst);
+	stream->first_seen = replay->now;
+	stream->next = replay->buckets[bucket];
+	replay->buckets[bucket] = i;
+
+	replay->streams++;
+	replay->active++;
+	if (replay->active > replay->peak)
+	{
+		replay->peak = replay->active;
+	}
+	return stream;
+}
+
+/* Plays out what is left of a stream, writes its line and returns its entry to the pool */
+static void rtp_stream_finish(rtp_replay_t *replay, rtp_stream_t *stream)
+{
+	int index = (int)(stream - replay->pool);
+	int *link = &replay->buckets[rtp_hash(replay, stream->ssrc)];
+
+	rtp_stream_drain(replay, stream);
+	rtp_stream_end_spurt(replay, stream);
+
+	fprintf(replay->out, "{\"event\": \"stream\", \"ssrc\": \"0x%08lx\", \"payload_type\": %d, \"src\": \"%s\", "
+		"\"dst\": \"%s\", \"start\": %.6f, \"end\": %.6f, \"packets\": %lu, \"lost\": %lu, \"late\": %lu, "
+		"\"duplicates\": %lu, \"oversize\": %lu, \"restarts\": %lu, \"digits\": \"%s\"}\n",
+		(unsigned long)stream->ssrc, stream->payload_type, stream->src, stream->dst, stream->first_seen,
+		stream->last_seen, (unsigned long)stream->packets, (unsigned long)stream->lost, (unsigned long)stream->late,
+		(unsigned long)stream->duplicates, (unsigned long)stream->oversize, (unsigned long)stream->restarts,
+		stream->keys);
+
+	while (*link != index)
+	{
+		link = &replay->pool[*link].next;
+	}
+	*link = stream->next;
+	stream->in_use = 0;
+	stream->next = replay->free_list;
+	replay->free_list = index;
+	replay->active--;
+}
+
+/* Finishes the streams idle for longer than the timeout, at most once per second of capture time */
+static void rtp_sweep(rtp_replay_t *replay)
+{
+	int i;
+
+	if (replay->now - replay->last_sweep < 1.0)
+	{
+		return;
+	}
+	replay->last_sweep = replay->now;
+	for (i = 0; i < replay->max_streams; i++)
+	{
+		if (replay->pool[i].in_use && replay->now - replay->pool[i].last_seen > replay->idle)
+		{
+			rtp_stream_finish(replay, &replay->pool[i]);
+		}
+	}
+}
+
+/* Formats an address and a port as "a.b.c.d:port" or "[v6]:port" */
+static void rtp_address(char *text, int family, const unsigned char *address, uint16_t port)
+{
+	char host[48];
+
+	inet_ntop(family, address, host, sizeof(host));
+	sprintf(text, family == AF_INET6 ? "[%s]:%u" : "%s:%u", host, (unsigned)port);
+}
+
+/* Finds the UDP payload of a record, NULL if the record is not a whole UDP datagram */
+static const unsigned char *rtp_udp_payload(int linktype, const unsigned char *data, uint32_t length, int *payload_length,
+	char *src, char *dst)
+{
+	const unsigned char *ip;
+	const unsigned char *udp;
+	uint32_t offset = 0, family;
+	uint16_t ethertype = 0;
+	uint32_t header, total;
+	int version;
+
+	switch (linktype)
+	{
+		case RTP_LINK_ETHERNET:
+			if (length < 14)
+			{
+				return NULL;
+			}
+			ethertype = rtp_be16(data + 12);
+			offset = 14;
+			/* 802.1Q and 802.1ad tags */
+			while ((ethertype == 0x8100 || ethertype == 0x88a8) && length >= offset + 4)
+			{
+				ethertype = rtp_be16(data + offset + 2);
+				offset += 4;
+			}
+			if (ethertype != 0x0800 && ethertype != 0x86dd)
+			{
+				return NULL;
+			}
+			break;
+		case RTP_LINK_SLL:
+			offset = 16;
+			break;
+		case RTP_LINK_SLL2:
+			offset = 20;
+			break;
+		case RTP_LINK_NULL:
+			if (length < 4)
+			{
+				return NULL;
+			}
+			/* Address family in the byte order of the capturing host: 2 for IPv4, 24, 28 or 30 for IPv6 */
+			family = data[0] | data[3];
+			if (family != 2 && family != 24 && family != 28 && family != 30)
+			{
+				return NULL;
+			}
+			offset = 4;
+			break;
+		case RTP_LINK_RAW:
+			break;
+		default:
+			return NULL;
+	}
+	if (length < offset + 1)
+	{
+		return NULL;
+	}
+
+	ip = data + offset;
+	length -= offset;
+	version = ip[0] >> 4;
+	if (version == 4)
+	{
+		if (length < 20)
+		{
+			return NULL;
+		}
+		header = (uint32_t)(ip[0] & 0x0f) * 4;
+		total = rtp_be16(ip + 2);
+		/* Fragments are not reassembled, a G.711 packet never needs it */
+		if (ip[9] != 17 || header < 20 || total < header + 8 || total > length || (rtp_be16(ip + 6) & 0x3fff) != 0)
+		{
+			return NULL;
+		}
+		udp = ip + header;
+		rtp_address(src, AF_INET, ip + 12, rtp_be16(udp));
+		rtp_address(dst, AF_INET, ip + 16, rtp_be16(udp + 2));
+		total -= header;
+	}
+	else if (version == 6)
+	{
+		/* Extension headers are not followed, RTP rarely has any */
+		if (length < 40 || ip[6] != 17)
+		{
+			return NULL;
+		}
+		total = rtp_be16(ip + 4);
+		if (total < 8 || total + 40 > length)
+		{
+			return NULL;
+		}
+		udp = ip + 40;
+		rtp_address(src, AF_INET6, ip + 8, rtp_be16(udp));
+		rtp_address(dst, AF_INET6, ip + 24, rtp_be16(udp + 2));
+	}
+	else
+	{
+		return NULL;
+	}
+
+	if (rtp_be16(udp + 4) < 8 || rtp_be16(udp + 4) > total)
+	{
+		return NULL;
+	}
+	*payload_length = rtp_be16(udp + 4) - 8;
+	return udp + 8;
+}
+
+/* Hands the G.711 payload of an RTP packet to its stream, returns 0 if the datagram is not one */
+static int rtp_packet(rtp_replay_t *replay, const unsigned char *packet, int length, const char *src, const char *dst)
+{
+	rtp_stream_t *stream;
+	uint8_t payload_type;
+	int header, padding = 0;
+
+	if (length < 12 || (packet[0] >> 6) != 2)
+	{
+		return 0;
+	}
+	payload_type = packet[1] & 0x7f;
+	if (payload_type != RTP_PT_PCMU && payload_type != RTP_PT_PCMA)
+	{
+		return 0;
+	}
+	header = 12 + 4 * (packet[0] & 0x0f);
+	if ((packet[0] & 0x10) && length >= header + 4)
+	{
+		header += 4 + 4 * rtp_be16(packet + header + 2);
+	}
+	if (packet[0] & 0x20)
+	{
+		padding = packet[length - 1];
+	}
+	if (header + padding >= length)
+	{
+		return 0;
+	}
+
+	replay->rtp_packets++;
+	stream = rtp_stream_get(replay, rtp_be32(packet + 8), payload_type, src, dst);
+	if (stream != NULL && stream->payload_type == payload_type)
+	{
+		rtp_stream_receive(replay, stream, rtp_be16(packet + 2), rtp_be32(packet + 4), packet + header,
+			length - header - padding);
+	}
+	return 1;
+}
+
+/* Reads every record of the capture, returns 0 on success */
+static int rtp_read_pcap(rtp_replay_t *replay, FILE *in, const char *name)
+{
+	unsigned char header[24], record[16];
+	unsigned char *data = NULL;
+	uint32_t magic, linktype, snaplen, caplen;
+	uint32_t first_sec = 0;
+	double frac_scale;
+	int swap, payload_length;
+	const unsigned char *payload;
+	char src[RTP_ADDRESS_LENGTH], dst[RTP_ADDRESS_LENGTH];
+
+	if (fread(header, 1, sizeof(header), in) != sizeof(header))
+	{
+		fprintf(stderr, "rtp_replay: %s: not a pcap file\n", name);
+		return 1;
+	}
+	magic = rtp_read32(header, 0);
+	swap = magic == 0xd4c3b2a1 || magic == 0x4d3cb2a1;
+	magic = rtp_read32(header, swap);
+	if (magic != 0xa1b2c3d4 && magic != 0xa1b23c4d)
+	{
+		fprintf(stderr, "rtp_replay: %s: not a pcap file, pcapng captures can be converted with editcap -F pcap\n", name);
+		return 1;
+	}
+	frac_scale = magic == 0xa1b23c4d ? 1e-9 : 1e-6;
+	snaplen = rtp_read32(header + 16, swap);
+	linktype = rtp_read32(header + 20, swap) & 0x0fffffff;
+	if (snaplen == 0 || snaplen > 262144)
+	{
+		snaplen = 262144;
+	}
+	data = (unsigned char *)malloc(snaplen);
+	if (data == NULL)
+	{
+		fprintf(stderr, "rtp_replay: out of memory\n");
+		return 1;
+	}
+
+	while (fread(record, 1, sizeof(record), in) == sizeof(record))
+	{
+		caplen = rtp_read32(record + 8, swap);
+		if (caplen > snaplen)
+		{
+			fprintf(stderr, "rtp_replay: %s: record %lu is longer than the snapshot length\n", name, replay->records + 1);
+			break;
+		}
+		if (fread(data, 1, caplen, in) != caplen)
+		{
+			break;
+		}
+		if (replay->records++ == 0)
+		{
+			first_sec = rtp_read32(record, swap);
+		}
+		replay->now = (double)(rtp_read32(record, swap) - first_sec) + rtp_read32(record + 4, swap) * frac_scale;
+
+		payload = rtp_udp_payload((int)linktype, data, caplen, &payload_length, src, dst);
+		if (payload == NULL || !rtp_packet(replay, payload, payload_length, src, dst))
+		{
+			replay->skipped++;
+		}
+		rtp_sweep(replay);
+	}
+	free(data);
+	return 0;
+}
+
+static void rtp_usage(const char *argv0)
+{
+	fprintf(stderr,
+		"usage: %s [-o file] [--max-streams n] [--idle s] [--rfc4733 udp:host:port|file] capture.pcap\n"
+		"Decodes the in-band DTMF digits of the G.711 RTP streams of a capture, one JSON object per line.\n", argv0);
+}
+
+int main(int argc, char *argv[])
+{
+	rtp_replay_t replay;
+	const char *path = NULL;
+	FILE *in;
+	uint32_t buckets;
+	int i, status;
+
+	memset(&replay, 0, sizeof(replay));
+	replay.max_streams = RTP_DEFAULT_MAX_STREAMS;
+	replay.idle = RTP_DEFAULT_IDLE_S;
+	replay.out = stdout;
+
+	for (i = 1; i < argc; i++)
+	{
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if (argv[i][0] != '-')
+		{
+			path = argv[i];
+			continue;
+		}
+		if (value == NULL)
+		{
+			rtp_usage(argv[0]);
+			return 2;
+		}
+		if (strcmp(argv[i], "-o") == 0)
+		{
+			replay.out = fopen(value, "w");
+			if (replay.out == NULL)
+			{
+				perror(value);
+				return 1;
+			}
+		}
+		else if (strcmp(argv[i], "--max-streams") == 0) replay.max_streams = atoi(value);
+		else if (strcmp(argv[i], "--idle") == 0) replay.idle = atof(value);
+		else if (strcmp(argv[i], "--rfc4733") == 0)
+		{
+			if (rtp_event_open(&replay, value) != 0)
+			{
+				return 1;
+			}
+		}
+		else
+		{
+			rtp_usage(argv[0]);
+			return 2;
+		}
+		i++;
+	}
+	if (path == NULL || replay.max_streams < 1)
+	{
+		rtp_usage(argv[0]);
+		return 2;
+	}
+
+	/* Hash chains of one or two entries on average */
+	for (buckets = 1; buckets < (uint32_t)replay.max_streams; buckets <<= 1)
+	{
+	}
+	replay.bucket_mask = buckets - 1;
+	replay.pool = (rtp_stream_t *)malloc((size_t)replay.max_streams * sizeof(rtp_stream_t));
+	replay.buckets = (int *)malloc(buckets * sizeof(int));
+	if (replay.pool == NULL || replay.buckets == NULL)
+	{
+		fprintf(stderr, "rtp_replay: out of memory for %d streams\n", replay.max_streams);
+		return 1;
+	}
+	for (i = 0; i < (int)buckets; i++)
+	{
+		replay.buckets[i] = -1;
+	}
+	for (i = 0; i < replay.max_streams; i++)
+	{
+		replay.pool[i].in_use = 0;
+		replay.pool[i].next = i + 1 < replay.max_streams ? i + 1 : -1;
+	}
+	replay.free_list = 0;
+	digit_state_default_config(&replay.timing);
+
+	in = fopen(path, "rb");
+	if (in == NULL)
+	{
+		perror(path);
+		return 1;
+	}
+	status = rtp_read_pcap(&replay, in, path);
+	fclose(in);
+
+	for (i = 0; i < replay.max_streams; i++)
+	{
+		if (replay.pool[i].in_use)
+		{
+			rtp_stream_finish(&replay, &replay.pool[i]);
+		}
+	}
+	fprintf(replay.out, "{\"event\": \"summary\", \"records\": %lu, \"rtp_packets\": %lu, \"skipped\": %lu, "
+		"\"streams\": %lu, \"peak_streams\": %d, \"dropped_packets\": %lu, \"digits\": %lu, \"event_packets\": %lu, \"pool_bytes\": %lu}\n",
+		replay.records, replay.rtp_packets, replay.skipped, replay.streams, replay.peak, replay.dropped_packets,
+		replay.digits, replay.event_packets, (unsigned long)((size_t)replay.max_streams * sizeof(rtp_stream_t) + buckets * sizeof(int)));
+
+	if (replay.out != stdout)
+	{
+		fclose(replay.out);
+	}
+	if (replay.event_file != NULL)
+	{
+		fclose(replay.event_file);
+	}
+	else if (replay.event_output)
+	{
+		close(replay.event_socket);
+	}
+	free(replay.buckets);
+	free(replay.pool);
+	return status;
+}
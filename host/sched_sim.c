@@ -0,0 +1,461 @@
+/*! \file sched_sim.c
+ * \brief Host simulation of the event driven main loop of scheduler.c
+ *
+ * Runs the real scheduler.c against a simulated board: a clock in core cycles, every interrupt source the firmware
+ * leaves running, and tasks that only take time. The sources are the ADC interrupt every CLK_FREQ / G_SAMPLE_RATE
+ * cycles, posting the tick and frame events and scanning the keys at each tick like reader.c does (SysTick is off and
+ * TIMER0 raises none), the edge interrupt of the on-board switch, a few per press with the bounces, and with
+ * --capture 1 the transmit interrupt of the UART refilling its FIFO while a record of capture.h is sent. The frame
+ * task costs the detector's cost_estimate() times a number of cycles per multiplication, the display task a fixed
+ * LCD update time. An interrupt that falls inside a task takes its time from it, one that falls while the scheduler
+ * is locked waits for unlock(), as on the Cortex-M4.
+ *
+ * For every detector of g_detectors[] and every scenario it reports the duty cycle measured by the scheduler, the
+ * one of the simulation for comparison, the wake-ups and the interrupts of each source per second and the frames whose event was coalesced with the
+ * next one because the frame task was too slow. The SDFT detector is fed while the frame is read, as main.c does: the
+ * interrupt also posts the stride event every SDFT_DECISION_STRIDE samples and the stride task takes the share of the
+ * cost of the samples it feeds, leaving the rest of the frame to the frame task. The polling loop it replaces was awake 100% of the time. The
+ * switching scenario changes the detector from the settings page every second: the frame task initialises it and
+ * writes the configuration record after the frame, as main.c does, and no frame may be missed.
+ *
+ * Build and run from the repository root:
+ * \code
+ * cc -std=gnu89 -O2 -Ihost -Isrc -Idrivers -o sched_sim host/sched_sim.c src/scheduler.c src/detector*.c \
+ *    src/resampler.c src/tone_bank.c src/sdft.c src/gtzl.c src/decoder_gtzl.c src/fft.c src/decoder.c src/dtmf_table.c \
+ *    src/complex_g3.c -lm
+ * ./sched_sim -o sched_output.txt
+ * \endcode
+ */
+
+/* C Library Headers */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "detector.h"
+#include "scheduler.h"
+#include "sdft.h"
+#include "capture.h"
+
+#define SIM_SAMPLE_CYCLES ((double)CLK_FREQ / G_SAMPLE_RATE)
+
+/* Defaults of the cost model, in core cycles */
+#define SIM_DEFAULT_SECONDS 10
+#define SIM_DEFAULT_CYCLES_PER_MULT 40.0	/* Double precision multiply and add in software on the Cortex-M4F */
+#define SIM_DEFAULT_ISR_CYCLES 400.0	/* ADC read, calibration and store of one sample */
+#define SIM_DEFAULT_KEY_SCAN_CYCLES 150.0	/* input_lpc_tick() reading the keys, in the ADC interrupt at each tick */
+#define SIM_DEFAULT_SWITCH_ISR_CYCLES 60.0	/* Edge of the on-board switch, flagged for the next tick */
+#define SIM_DEFAULT_UART_ISR_CYCLES 200.0	/* 16 bytes from the capture ring to the transmit FIFO */
+#define SIM_DEFAULT_TICK_CYCLES 300.0	/* algorithm_setter_tick() and the timeout of scroll_LCD() */
+#define SIM_DEFAULT_DISPLAY_CYCLES 240000.0	/* 2 ms to write a row of the LCD */
+#define SIM_DEFAULT_EEPROM_CYCLES 360000.0	/* 3 ms to erase and program a page of the EEPROM */
+
+/* Interrupt sources besides the ADC */
+#define SIM_SWITCH_EDGES 4	/* Falling edges of a press of the on-board switch, with its bounces */
+#define SIM_SWITCH_BOUNCE_CYCLES (CLK_FREQ / 2000.0)	/* 0.5 ms between them */
+#define SIM_UART_FIFO 16
+#define SIM_UART_BURST ((CAPTURE_RECORD_SIZE + SIM_UART_FIFO - 1) / SIM_UART_FIFO)	/* Transmit interrupts of a record */
+#define SIM_UART_FIFO_CYCLES ((double)CLK_FREQ * SIM_UART_FIFO * 10 / CAPTURE_BAUD)	/* 10 bits a byte on the line */
+
+/*! \typedef sim_scenario_t
+* \brief Activity on the line
+*/
+typedef struct sim_scenario_t
+{
+	const char *name;
+	int digit_frames;	/* A digit, so a display update, every this many frames, 0 for none */
+	int switch_frames;	/* A press of the switch and a detector switch, so an EEPROM write, every this many frames, 0 for none */
+} sim_scenario_t;
+
+static const sim_scenario_t SIM_SCENARIOS[] = {
+	{"silent_line", 0, 0},
+	{"dialing", 4, 0},
+	{"switching", 4, 16}
+};
+
+/* Cost model */
+static double cycles_per_mult = SIM_DEFAULT_CYCLES_PER_MULT;
+static double isr_cycles = SIM_DEFAULT_ISR_CYCLES;
+static double key_scan_cycles = SIM_DEFAULT_KEY_SCAN_CYCLES;
+static double switch_isr_cycles = SIM_DEFAULT_SWITCH_ISR_CYCLES;
+static double uart_isr_cycles = SIM_DEFAULT_UART_ISR_CYCLES;
+static double tick_cycles = SIM_DEFAULT_TICK_CYCLES;
+static double display_cycles = SIM_DEFAULT_DISPLAY_CYCLES;
+static double eeprom_cycles = SIM_DEFAULT_EEPROM_CYCLES;
+static int capture;
+
+/*! \typedef sim_irq_t
+* \brief Interrupt source of the board, raised in bursts of burst interrupts spacing cycles apart, a burst every period
+*/
+typedef struct sim_irq_t
+{
+	const char *name;
+	double period;	/* Cycles from a burst to the next, HUGE_VAL for a source that never fires */
+	double spacing;	/* Cycles between the interrupts of a burst */
+	int burst;
+	const double *cycles;	/* Time of its handler */
+	void (*handler)(void);	/* What it does besides taking time */
+	double next;	/* Time of its next interrupt */
+	int edge;	/* Interrupts of the current burst raised */
+	int pending;	/* Due but not served yet */
+	unsigned long count;
+} sim_irq_t;
+
+/* Simulated board */
+static double sim_clock;	/* Cycles since the start */
+static double asleep;	/* Cycles spent in sleep() */
+static int locked;
+static unsigned long samples;
+static unsigned long frames_posted;
+static unsigned long frames_run;
+static unsigned long fed;	/* Samples whose decoding has taken its time */
+static int stride;	/* reader_stride of main.c: SDFT_DECISION_STRIDE for the SDFT detector, else 0 */
+static const detector_t *sim_detector;
+static const sim_scenario_t *sim_scenario;
+
+/* The sample interrupt, as reader.c does: the ADC one, which also keeps the tick and samples the keys */
+static void sim_adc_handler(void)
+{
+	samples++;
+	if (samples % SCHED_TICK_SAMPLES == 0)
+	{
+		sim_clock += key_scan_cycles;
+		sched_post(SCHED_EVENT_TICK);
+	}
+	if (stride != 0 && samples % stride == 0)
+	{
+		sched_post(SCHED_EVENT_STRIDE);
+	}
+	if (samples % G_ARRAY_SIZE == 0)
+	{
+		frames_posted++;
+		sched_post(SCHED_EVENT_FRAME);
+	}
+}
+
+/* The edge of the on-board switch and the transmit FIFO of the capture only take their time */
+static void sim_time_handler(void)
+{
+}
+
+/* In the order of their priority, all that is left once SysTick is off: TIMER0 only drives MAT0.1 */
+static sim_irq_t sim_irqs[] = {
+	{"adc", 0.0, 0.0, 1, &isr_cycles, sim_adc_handler, 0.0, 0, 0, 0},
+	{"switch", 0.0, 0.0, SIM_SWITCH_EDGES, &switch_isr_cycles, sim_time_handler, 0.0, 0, 0, 0},
+	{"uart", 0.0, 0.0, SIM_UART_BURST, &uart_isr_cycles, sim_time_handler, 0.0, 0, 0, 0}
+};
+
+#define SIM_IRQ_AMT ((int)(sizeof(sim_irqs) / sizeof(sim_irqs[0])))
+
+/* Time of the next interrupt of any source */
+static double sim_next_irq(void)
+{
+	double next = HUGE_VAL;
+	int i;
+
+	for (i = 0; i < SIM_IRQ_AMT; i++)
+	{
+		if (sim_irqs[i].next < next)
+		{
+			next = sim_irqs[i].next;
+		}
+	}
+	return next;
+}
+
+/* Runs the interrupts that are due, the first source first */
+static void sim_serve(void)
+{
+	int i;
+
+	for (i = 0; i < SIM_IRQ_AMT && !locked; i++)
+	{
+		while (sim_irqs[i].pending > 0)
+		{
+			sim_irqs[i].pending--;
+			sim_irqs[i].count++;
+			sim_clock += *sim_irqs[i].cycles;
+			sim_irqs[i].handler();
+		}
+	}
+}
+
+/* Marks the interrupts whose time has come as pending */
+static void sim_raise(void)
+{
+	int i;
+
+	for (i = 0; i < SIM_IRQ_AMT; i++)
+	{
+		sim_irq_t *irq = &sim_irqs[i];
+
+		while (irq->next <= sim_clock)
+		{
+			irq->pending++;
+			irq->edge++;
+			if (irq->edge < irq->burst)
+			{
+				irq->next += irq->spacing;
+			}
+			else
+			{
+				irq->next += irq->period - (irq->burst - 1) * irq->spacing;
+				irq->edge = 0;
+			}
+		}
+	}
+}
+
+/* Spends cycles in a task, the interrupts that fall inside take their time from it */
+static void sim_busy(double cycles)
+{
+	double end = sim_clock + cycles;
+	double next;
+
+	while ((next = sim_next_irq()) <= end)
+	{
+		double remaining = end - next;
+
+		sim_clock = next;
+		sim_raise();
+		sim_serve();
+		end = sim_clock + remaining;
+	}
+	sim_clock = end;
+}
+
+static uint32_t sim_now(void)
+{
+	return (uint32_t)fmod(sim_clock, 4294967296.0);
+}
+
+static uint32_t sim_lock(void)
+{
+	uint32_t state = (uint32_t)locked;
+
+	locked = 1;
+	return state;
+}
+
+static void sim_unlock(uint32_t state)
+{
+	locked = (int)state;
+	if (!locked)
+	{
+		sim_raise();
+		sim_serve();
+	}
+}
+
+static void sim_sleep(void)
+{
+	double next = sim_next_irq();
+
+	if (next > sim_clock)
+	{
+		asleep += next - sim_clock;
+		sim_clock = next;
+	}
+	sim_raise();
+}
+
+static const sched_backend_t sim_backend = {
+	(uint32_t)CLK_FREQ,
+	sim_now,
+	sim_lock,
+	sim_unlock,
+	sim_sleep
+};
+
+/* Spends the share of cost_estimate() of the samples up to end that are not decoded yet */
+static void sim_decode(unsigned long end)
+{
+	if (end > fed)
+	{
+		sim_busy((double)sim_detector->cost_estimate() * cycles_per_mult * (double)(end - fed) / G_ARRAY_SIZE);
+		fed = end;
+	}
+}
+
+static void sim_frame_task(uint32_t events)
+{
+	(void)events;
+	frames_run++;
+	sim_decode(frames_run * G_ARRAY_SIZE);
+	if (sim_scenario->switch_frames > 0 && frames_run % (unsigned long)sim_scenario->switch_frames == 0)
+	{
+		/* Switched at the frame boundary, the record is written once the frame is decoded */
+		sim_detector->init();
+		sim_busy(eeprom_cycles);
+	}
+	if (sim_scenario->digit_frames > 0 && frames_run % (unsigned long)sim_scenario->digit_frames == 0)
+	{
+		sched_post(SCHED_EVENT_DISPLAY);
+	}
+}
+
+/* The samples stored so far, up to the end of the frame after the last one the frame task took */
+static void sim_stride_task(uint32_t events)
+{
+	(void)events;
+	sim_decode(samples < (frames_run + 1) * G_ARRAY_SIZE ? samples : (frames_run + 1) * G_ARRAY_SIZE);
+}
+
+static void sim_tick_task(uint32_t events)
+{
+	(void)events;
+	sim_busy(tick_cycles);
+}
+
+static void sim_display_task(uint32_t events)
+{
+	(void)events;
+	sim_busy(display_cycles);
+}
+
+static const sched_task_t sim_tasks[] = {
+	{SCHED_EVENT_FRAME, sim_frame_task},
+	{SCHED_EVENT_STRIDE, sim_stride_task},
+	{SCHED_EVENT_TICK, sim_tick_task},
+	{SCHED_EVENT_DISPLAY, sim_display_task}
+};
+
+static void sim_run(FILE *out, const sim_scenario_t *scenario, const detector_t *detector, int seconds, int first)
+{
+	double end = (double)seconds * CLK_FREQ;
+	double duty_sum = 0.0;
+	uint32_t windows = 0;
+	const sched_stats_t *stats;
+	double frame_period = SIM_SAMPLE_CYCLES * G_ARRAY_SIZE;
+	int i;
+
+	sim_clock = 0.0;
+	asleep = 0.0;
+	locked = 0;
+	samples = 0;
+	frames_posted = 0;
+	frames_run = 0;
+	fed = 0;
+	stride = (detector == &detector_sdft) ? SDFT_DECISION_STRIDE : 0;
+	sim_detector = detector;
+	sim_scenario = scenario;
+	detector->init();
+
+	sim_irqs[0].period = SIM_SAMPLE_CYCLES;
+	/* The press that opens the settings comes half a frame before each switch */
+	sim_irqs[1].period = scenario->switch_frames > 0 ? frame_period * scenario->switch_frames : HUGE_VAL;
+	sim_irqs[1].spacing = SIM_SWITCH_BOUNCE_CYCLES;
+	/* A record is queued at each frame and sent at the line rate */
+	sim_irqs[2].period = capture ? frame_period : HUGE_VAL;
+	sim_irqs[2].spacing = SIM_UART_FIFO_CYCLES;
+	for (i = 0; i < SIM_IRQ_AMT; i++)
+	{
+		sim_irqs[i].next = sim_irqs[i].period;
+		sim_irqs[i].edge = 0;
+		sim_irqs[i].pending = 0;
+		sim_irqs[i].count = 0;
+	}
+	sim_irqs[1].next -= frame_period / 2;
+
+	sched_init(&sim_backend, sim_tasks, sizeof(sim_tasks) / sizeof(sim_tasks[0]));
+	stats = sched_stats();
+	while (sim_clock < end)
+	{
+		sched_step();
+		if (stats->windows != windows)
+		{
+			windows = stats->windows;
+			duty_sum += stats->duty_permille;
+		}
+	}
+
+	fprintf(out, "%s    {\"scenario\": \"%s\", \"detector\": \"%s\", \"frame_cycles\": %.0f, \"duty_percent\": %.1f, "
+		"\"simulated_duty_percent\": %.1f, \"wakeups_per_s\": %.0f, \"irqs_per_s\": {",
+		first ? "" : ",\n", scenario->name, detector->name, (double)detector->cost_estimate() * cycles_per_mult,
+		windows ? duty_sum / windows / 10.0 : 100.0, 100.0 * (1.0 - asleep / sim_clock),
+		(double)stats->wakeups / seconds);
+	for (i = 0; i < SIM_IRQ_AMT; i++)
+	{
+		fprintf(out, "%s\"%s\": %.1f", i ? ", " : "", sim_irqs[i].name, (double)sim_irqs[i].count / seconds);
+	}
+	fprintf(out, "}, \"frames\": %lu, \"frames_missed\": %lu}", frames_posted, frames_posted - frames_run);
+}
+
+static void sim_usage(const char *argv0)
+{
+	fprintf(stderr,
+		"usage: %s [-o file] [--seconds s] [--cycles-per-mult c] [--isr-cycles c] [--key-scan-cycles c]\n"
+		"          [--switch-isr-cycles c] [--uart-isr-cycles c] [--tick-cycles c] [--display-cycles c]\n"
+		"          [--eeprom-cycles c] [--capture 0|1]\n", argv0);
+}
+
+int main(int argc, char *argv[])
+{
+	int seconds = SIM_DEFAULT_SECONDS;
+	FILE *out = stdout;
+	int first = 1;
+	int i, j;
+
+	for (i = 1; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if (value == NULL)
+		{
+			sim_usage(argv[0]);
+			return 2;
+		}
+		if (strcmp(arg, "-o") == 0)
+		{
+			out = fopen(value, "w");
+			if (out == NULL)
+			{
+				perror(value);
+				return 1;
+			}
+		}
+		else if (strcmp(arg, "--seconds") == 0) seconds = atoi(value);
+		else if (strcmp(arg, "--cycles-per-mult") == 0) cycles_per_mult = atof(value);
+		else if (strcmp(arg, "--isr-cycles") == 0) isr_cycles = atof(value);
+		else if (strcmp(arg, "--key-scan-cycles") == 0) key_scan_cycles = atof(value);
+		else if (strcmp(arg, "--switch-isr-cycles") == 0) switch_isr_cycles = atof(value);
+		else if (strcmp(arg, "--uart-isr-cycles") == 0) uart_isr_cycles = atof(value);
+		else if (strcmp(arg, "--tick-cycles") == 0) tick_cycles = atof(value);
+		else if (strcmp(arg, "--display-cycles") == 0) display_cycles = atof(value);
+		else if (strcmp(arg, "--eeprom-cycles") == 0) eeprom_cycles = atof(value);
+		else if (strcmp(arg, "--capture") == 0) capture = atoi(value);
+		else
+		{
+			sim_usage(argv[0]);
+			return 2;
+		}
+		i++;
+	}
+	if (seconds < 2)
+	{
+		seconds = 2;
+	}
+
+	fprintf(out, "{\n  \"benchmark\": \"scheduler\",\n  \"clock_hz\": %lu,\n  \"seconds\": %d,\n  \"cycles_per_mult\": %.1f,\n"
+		"  \"isr_cycles\": %.0f,\n  \"capture\": %d,\n  \"polling_duty_percent\": 100.0,\n  \"results\": [\n",
+		(unsigned long)CLK_FREQ, seconds, cycles_per_mult, isr_cycles, capture);
+	for (i = 0; i < (int)(sizeof(SIM_SCENARIOS) / sizeof(SIM_SCENARIOS[0])); i++)
+	{
+		for (j = 0; j < g_detector_count; j++)
+		{
+			sim_run(out, &SIM_SCENARIOS[i], g_detectors[j], seconds, first);
+			first = 0;
+		}
+	}
+	fprintf(out, "\n  ]\n}\n");
+
+	if (out != stdout)
+	{
+		fclose(out);
+	}
+	return 0;
+}
@@ -1,6 +1,6 @@
 /*! \file algorithm_setter.c
  * \author Gioele Giunta
- * \version 1.0
+ * \version 1.1
  * \since 8<sup>th</sup> May 2024
  * \brief Functions for algorithm_setter.h
  */
@@ -9,70 +9,119 @@
 #include "algorithm_setter.h"
 
 
-/*! \fn int algorithm_setter (int selection)
-* \param selection Current algorithm in use
-* \returns User selected algorithm
-* \brief Allows the user to select between the two available signal decoding algorithm
-*
-* The number '2' indicates FFT while '3' indicates 'Goertzel' .
-*/
-int algorithm_setter (int selection)
+/* Shows the detector at position index of g_detectors[] between selection marks on the bottom line */
+static void print_selection (int index)
 {
-	int scrollingCounterA = 0;
-	int g = 16;
-	char title[70] =  " Select the decoding algorithm, using the joystick";
-	char title_[70] = " Select the deco";
-	
-	leds_set(0, 1, 0);
-	
-	if (selection == 2)
+	char line[17];
+	const char *name = g_detectors[index]->name;
+	int length = strlen(name);
+	int start;
+
+	if (length > DETECTOR_NAME_LENGTH)
 	{
-		print_bottom("|FFT|      GTZL ");
+		length = DETECTOR_NAME_LENGTH;
 	}
-	else if (selection == 3)
+	start = (16 - length) / 2;
+
+	memset(line, ' ', 16);
+	line[16] = '\0';
+	line[0] = '<';
+	line[15] = '>';
+	memcpy(&line[start], name, length);
+	print_bottom(line);
+}
+
+/* Scrolls in the title from the right, one character per step */
+static const char TITLE[] = " Select the decoding algorithm, using the joystick";
+
+/* Shows the 16 characters of the title that end at position length */
+static void print_title (int length)
+{
+	char line[17];
+
+	memcpy(line, &TITLE[length - 16], 16);
+	line[16] = '\0';
+	print_top(line);
+}
+
+void algorithm_setter_open(algorithm_setter_t *setter, const detector_t *selection)
+{
+	if (setter->state != ALGORITHM_SETTER_CLOSED)
 	{
-		print_bottom(" FFT      |GTZL|");
+		return;
 	}
-	else
+	setter->state = ALGORITHM_SETTER_SELECTING;
+	setter->index = detector_index(selection);
+	if (setter->index < 0)
 	{
-		print_bottom(" FFT       GTZL ");
+		setter->index = 0;
 	}
-	
-	
-	while(1)
-	{
-		/* Title Scrolling Section */
-		scrollingCounterA++;
+	setter->title_length = 16;
+	setter->ticks = 0;
 
-		
-		if (((scrollingCounterA % (200000)) == 0) && (g < strlen(title)))
-		{
-			/* Add one character from title[] to title_[] to facilitate g_scrolling to the left by one character */
-			title_[g] = title[g];
-			g++;
-			print_top(title_);
-		}
-		
-		/* Selection System Section */
-		if (switch_get(P_SW_LT))
-		{
-			print_bottom("|FFT|      GTZL ");
-			selection = 2;
-		}
+	leds_set(0, 1, 0);
+	print_title(setter->title_length);
+	print_selection(setter->index);
+}
 
-		if (switch_get(P_SW_RT))
-		{
-			print_bottom(" FFT      |GTZL|");
-			selection = 3;
-		}
+/*! \fn const detector_t *algorithm_setter_key(algorithm_setter_t *setter, const input_event_t *event)
+* \param setter The settings page
+* \param event A key event of input.h
+* \returns The detector chosen with this key, NULL otherwise
+* \brief Left and right step through g_detectors[], one step per press, centre confirms
+*/
+const detector_t *algorithm_setter_key(algorithm_setter_t *setter, const input_event_t *event)
+{
+	/* Selection System Section */
+	/* One step per press, holding the joystick does not cycle through the table */
+	if (setter->state != ALGORITHM_SETTER_SELECTING || event->type != INPUT_PRESS)
+	{
+		return NULL;
+	}
+	switch (event->key)
+	{
+	case INPUT_KEY_LEFT:
+		setter->index = (setter->index + g_detector_count - 1) % g_detector_count;
+		print_selection(setter->index);
+		break;
+	case INPUT_KEY_RIGHT:
+		setter->index = (setter->index + 1) % g_detector_count;
+		print_selection(setter->index);
+		break;
+	case INPUT_KEY_CENTRE:
+		print_bottom("      SET!      ");
+		setter->state = ALGORITHM_SETTER_SET;
+		setter->ticks = 0;
+		return g_detectors[setter->index];
+	default:
+		break;
+	}
+	return NULL;
+}
 
-		if (switch_get(P_SW_CR) && selection != 0)
+/*! \fn void algorithm_setter_tick(algorithm_setter_t *setter)
+* \param setter The settings page
+* \brief Scrolls the title, once per tick of the scheduler while the page is shown
+*
+* The page closes and clears the LCD ALGORITHM_SETTER_SET_TICKS after the choice.
+*/
+void algorithm_setter_tick(algorithm_setter_t *setter)
+{
+	setter->ticks++;
+	if (setter->state == ALGORITHM_SETTER_SET)
+	{
+		if (setter->ticks >= ALGORITHM_SETTER_SET_TICKS)
 		{
-			print_bottom("      SET!      ");
-			delay_ms(500);
+			setter->state = ALGORITHM_SETTER_CLOSED;
 			lcd_clear();
-
-			return selection;
 		}
 	}
+	/* Title Scrolling Section */
+	else if (setter->state == ALGORITHM_SETTER_SELECTING && (setter->ticks % ALGORITHM_SETTER_TITLE_TICKS) == 0
+		&& setter->title_length < (int)strlen(TITLE))
+	{
+		/* The last 16 characters scrolled in so far */
+		setter->title_length++;
+		print_title(setter->title_length);
+	}
 }
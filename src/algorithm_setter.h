@@ -1,10 +1,12 @@
 /*! \file algorithm_setter.h
  * \author Gioele Giunta
- * \version 1.0
+ * \version 1.1
  * \since 8<sup>th</sup> May 2024
  * \brief Selector for the signal decoding algorithm to be used
  *
- * The options are between FFT and Goertzel.
+ * The options are the detectors listed in g_detectors[]. The settings page is a state machine driven by the key events
+ * of input.h and the tick task, it never waits: the reader and the decoder keep running while it is shown, and the
+ * detector it returns is switched by the caller at the next frame boundary.
  */
 
 #ifndef ALGORITH_MSETTER_H_
@@ -17,22 +19,63 @@
 
 /* Driver Headers */
 #include <gpio.h>
-#include <delay.h>
 #include <lcd.h>
 #include <leds.h>
 
 /* Our Headers */
 #include "global_parameters.h"
 #include "switches.h"
+#include "detector.h"
+#include "input.h"
 
+/* Ticks of the scheduler between two steps of the title scrolling, 150 ms */
+#define ALGORITHM_SETTER_TITLE_TICKS 15
 
-/*! \fn int algorithm_setter (int selection)
-* \param selection Current algorithm in use
-* \returns User selected algorithm
-* \brief Allows the user to select between the two available signal decoding algorithm
+/* Ticks "SET!" stays on the bottom row after the choice, 500 ms */
+#define ALGORITHM_SETTER_SET_TICKS 50
+
+/*! \typedef algorithm_setter_state_t
+* \brief Page of the settings shown
+*/
+typedef enum algorithm_setter_state_t
+{
+	ALGORITHM_SETTER_CLOSED,	/*!< Not shown, the LCD belongs to the decoder */
+	ALGORITHM_SETTER_SELECTING,	/*!< Left and right step through the detectors */
+	ALGORITHM_SETTER_SET	/*!< The choice was made, "SET!" is shown until the page closes */
+} algorithm_setter_state_t;
+
+/*! \typedef algorithm_setter_t
+* \brief State of the settings page
+*/
+typedef struct algorithm_setter_t
+{
+	algorithm_setter_state_t state;	/*!< Page shown */
+	int index;	/*!< Position of the selection in g_detectors[] */
+	int title_length;	/*!< Characters of the title scrolled in so far */
+	uint32_t ticks;	/*!< Ticks since the page was opened or the choice made */
+} algorithm_setter_t;
+
+/*! \fn void algorithm_setter_open(algorithm_setter_t *setter, const detector_t *selection)
+* \param setter The settings page
+* \param selection Current detector in use, selected first
+* \brief Shows the settings page, does nothing if it is already shown
+*/
+void algorithm_setter_open(algorithm_setter_t *setter, const detector_t *selection);
+
+/*! \fn const detector_t *algorithm_setter_key(algorithm_setter_t *setter, const input_event_t *event)
+* \param setter The settings page
+* \param event A key event of input.h
+* \returns The detector chosen with this key, NULL otherwise
+* \brief Left and right step through g_detectors[], one step per press, centre confirms
+*/
+const detector_t *algorithm_setter_key(algorithm_setter_t *setter, const input_event_t *event);
+
+/*! \fn void algorithm_setter_tick(algorithm_setter_t *setter)
+* \param setter The settings page
+* \brief Scrolls the title, once per tick of the scheduler while the page is shown
 *
-* The number '2' indicates FFT while '3' indicates 'Goertzel' .
+* The page closes and clears the LCD ALGORITHM_SETTER_SET_TICKS after the choice.
 */
-int algorithm_setter (int selection);
+void algorithm_setter_tick(algorithm_setter_t *setter);
 
 #endif // ALGORITHM_SETTER_H_
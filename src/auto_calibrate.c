@@ -0,0 +1,82 @@
+/*! \file auto_calibrate.c
+ * \brief Functions for auto_calibrate.h
+ */
+
+/* Header */
+#include "auto_calibrate.h"
+
+/* Variable Declarations */
+auto_calibration_t g_calibration;
+
+/*! \fn void auto_calibrate_init(int seed_code)
+* \param seed_code Raw ADC code used as the initial DC estimate
+* \brief Resets the calibration and seeds the DC estimate
+*/
+void auto_calibrate_init(int seed_code)
+{
+	g_calibration.dc_acc = (int32_t)seed_code << AUTO_CAL_DC_SHIFT;
+	g_calibration.scale = AUTO_CAL_NOMINAL_SCALE;
+	g_calibration.next_scale = AUTO_CAL_NOMINAL_SCALE;
+	g_calibration.scale_pending = 0;
+	g_calibration.rms = 0.0;
+	g_calibration.frames = 0;
+	g_calibration.seeded = 1;
+}
+
+/*! \fn void auto_calibrate_block(const complex_g3_t *frame, int n)
+* \param frame A full frame of centred samples
+* \param n Number of samples in the frame
+* \brief Per-frame step of the calibration, measures the RMS of the frame
+*/
+void auto_calibrate_block(const complex_g3_t *frame, int n)
+{
+	double sum_sq = 0.0;
+	int i;
+
+	if (n <= 0)
+	{
+		return;
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		sum_sq += frame[i].re * frame[i].re;
+	}
+	g_calibration.rms = sqrt(sum_sq / n);
+	g_calibration.frames++;
+}
+
+/*! \fn void auto_calibrate_gain(double frame_scale)
+* \param frame_scale Scale the frame was read with, array_ready_scale of the reader
+* \brief Gain step for the frame last given to auto_calibrate_block(), to be called when a key was found in it
+*
+* Moves the scale AUTO_CAL_GAIN_RATE of the way from frame_scale to the one that would have read the frame at
+* AUTO_CAL_TARGET_RMS, within the limits. The reader has usually taken a new scale for the frame after this one by the
+* time it is decoded, so the step starts from the scale of the frame and not from g_calibration.scale, or a correction
+* would be applied again on top of itself. Nothing is done while the previous scale still waits for the reader
+* interrupt.
+*/
+void auto_calibrate_gain(double frame_scale)
+{
+	double scale;
+
+	if (g_calibration.scale_pending || g_calibration.rms <= 0.0)
+	{
+		return;
+	}
+	scale = frame_scale + AUTO_CAL_GAIN_RATE * (frame_scale * AUTO_CAL_TARGET_RMS / g_calibration.rms - frame_scale);
+	if (scale < AUTO_CAL_NOMINAL_SCALE * AUTO_CAL_GAIN_MIN)
+	{
+		scale = AUTO_CAL_NOMINAL_SCALE * AUTO_CAL_GAIN_MIN;
+	}
+	else if (scale > AUTO_CAL_NOMINAL_SCALE * AUTO_CAL_GAIN_MAX)
+	{
+		scale = AUTO_CAL_NOMINAL_SCALE * AUTO_CAL_GAIN_MAX;
+	}
+	if (scale != g_calibration.scale)
+	{
+		/* The interrupt reads next_scale only once the flag is set, and the flag is only set here once it has cleared it */
+		g_calibration.next_scale = scale;
+		g_calibration.scale_pending = 1;
+	}
+}
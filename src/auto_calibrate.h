@@ -0,0 +1,129 @@
+/*! \file auto_calibrate.h
+ * \brief Background DC-offset and level calibration of the reader samples
+ *
+ * Replaces the interactive mask calibration. The DC offset of the input circuit is estimated with a running mean of the
+ * raw ADC codes, updated on every sample inside the reader interrupt with a handful of integer instructions.
+ * The estimator is seeded from the first conversions, so the first frame after power-on is already centred.
+ *
+ * The gain is calibrated on the digits themselves: the RMS of each frame is measured once per frame from the main loop,
+ * and each frame in which a key was found moves the scale a step towards the one that brings the frame to
+ * AUTO_CAL_TARGET_RMS, the level the detection thresholds are tuned for. Silence and noise never move it, and it stays
+ * within AUTO_CAL_GAIN_MIN and AUTO_CAL_GAIN_MAX of the nominal scale. A new scale is handed to the reader interrupt
+ * through a mailbox and taken at the start of a frame, so every frame is read with a single scale.
+ */
+
+#ifndef AUTO_CALIBRATE_H_
+#define AUTO_CALIBRATE_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "complex_g3.h"
+#include "global_parameters.h"
+
+/*! \def AUTO_CAL_DC_SHIFT
+* \brief Time constant of the running mean, as a power of two in samples
+*
+* 2^12 samples is about half a second at 8000 Hz, the corner frequency stays far below the DTMF band.
+*/
+#define AUTO_CAL_DC_SHIFT 12
+
+/*! \def AUTO_CAL_SEED_SAMPLES
+* \brief Number of conversions averaged at start-up to seed the DC estimate
+*/
+#define AUTO_CAL_SEED_SAMPLES 16
+
+/*! \def AUTO_CAL_NOMINAL_SCALE
+* \brief Reader units per ADC code of an uncalibrated board, full scale reads G_MAX_AMPLITUDE
+*/
+#define AUTO_CAL_NOMINAL_SCALE (G_MAX_AMPLITUDE / (double)ADC_MASK)
+
+/*! \def AUTO_CAL_TARGET_RMS
+* \brief RMS of a frame of DTMF the gain calibration aims at, two tones of 1000 units as in the host benchmark
+*/
+#define AUTO_CAL_TARGET_RMS 1000.0
+
+/*! \def AUTO_CAL_GAIN_RATE
+* \brief Share of the way to the target scale taken per frame with a key, about 16 frames to settle
+*/
+#define AUTO_CAL_GAIN_RATE 0.125
+
+/* Limits of the scale, relative to AUTO_CAL_NOMINAL_SCALE */
+#define AUTO_CAL_GAIN_MIN 0.5
+#define AUTO_CAL_GAIN_MAX 4.0
+
+/*! \typedef auto_calibration_t
+* \brief State of the calibration
+*/
+typedef struct auto_calibration_t
+{
+	volatile int32_t dc_acc;	/*!< DC estimate of the raw ADC codes, scaled by 2^AUTO_CAL_DC_SHIFT */
+	double scale;	/*!< Reader units per ADC code, the gain applied to the centred samples, only written by the reader interrupt once running */
+	double next_scale;	/*!< Scale waiting for the start of the next frame, written by auto_calibrate_gain() */
+	volatile int scale_pending;	/*!< next_scale is waiting, set by the main loop and cleared by the reader interrupt */
+	double rms;	/*!< RMS of the last frame given to auto_calibrate_block(), in reader units */
+	uint32_t frames;	/*!< Number of frames seen by auto_calibrate_block() */
+	int seeded;	/*!< Set once a DC estimate exists, seeded from the ADC or restored from the configuration record */
+} auto_calibration_t;
+
+/* Global Variable Declarations */
+extern auto_calibration_t g_calibration;
+
+/*! \fn void auto_calibrate_init(int seed_code)
+* \param seed_code Raw ADC code used as the initial DC estimate
+* \brief Resets the calibration and seeds the DC estimate
+*/
+void auto_calibrate_init(int seed_code);
+
+/*! \fn int auto_calibrate_sample(int res)
+* \param res Raw ADC code
+* \returns The ADC code with the running DC estimate removed
+* \brief Per-sample step of the calibration, meant to be called from the sampling interrupt
+*
+* One add, two shifts and two subtractions: the running mean is a first order low-pass filter in fixed point.
+*/
+static __inline int auto_calibrate_sample(int res)
+{
+	int32_t acc = g_calibration.dc_acc;
+
+	acc += res - (acc >> AUTO_CAL_DC_SHIFT);
+	g_calibration.dc_acc = acc;
+
+	return res - (acc >> AUTO_CAL_DC_SHIFT);
+}
+
+/*! \fn double auto_calibrate_frame_scale(void)
+* \returns The scale of the frame that starts, to be called by the reader interrupt before its first sample
+* \brief Takes the scale waiting in the mailbox, if any
+*/
+static __inline double auto_calibrate_frame_scale(void)
+{
+	if (g_calibration.scale_pending)
+	{
+		g_calibration.scale = g_calibration.next_scale;
+		g_calibration.scale_pending = 0;
+	}
+	return g_calibration.scale;
+}
+
+/*! \fn void auto_calibrate_block(const complex_g3_t *frame, int n)
+* \param frame A full frame of centred samples
+* \param n Number of samples in the frame
+* \brief Per-frame step of the calibration, measures the RMS of the frame
+*/
+void auto_calibrate_block(const complex_g3_t *frame, int n);
+
+/*! \fn void auto_calibrate_gain(double frame_scale)
+* \param frame_scale Scale the frame was read with, array_ready_scale of the reader
+* \brief Gain step for the frame last given to auto_calibrate_block(), to be called when a key was found in it
+*
+* Moves the scale AUTO_CAL_GAIN_RATE of the way from frame_scale to the one that would have read the frame at
+* AUTO_CAL_TARGET_RMS, within the limits. The reader has usually taken a new scale for the frame after this one by the
+* time it is decoded, so the step starts from the scale of the frame and not from g_calibration.scale, or a correction
+* would be applied again on top of itself. Nothing is done while the previous scale still waits for the reader
+* interrupt.
+*/
+void auto_calibrate_gain(double frame_scale);
+
+#endif // AUTO_CALIBRATE_H_
@@ -0,0 +1,104 @@
+/*! \file capture.c
+* \brief Functions for capture.h shared by the board and the host, the board part is in capture_lpc.c
+*/
+
+/* C Library Headers */
+#include <string.h>
+
+/* Header */
+#include "capture.h"
+
+/* Offsets in a marker */
+#define CAPTURE_AT_FRAME 4
+#define CAPTURE_AT_DROPPED 6
+#define CAPTURE_AT_DC_ACC 8
+#define CAPTURE_AT_SCALE 12	/* IEEE 754 double, copied as it is: the board, x86 and ARM hosts are all little endian */
+#define CAPTURE_AT_DECISION_FRAME 20
+#define CAPTURE_AT_PROCESSED 22
+#define CAPTURE_AT_DETECTOR 24
+#define CAPTURE_AT_INITS 25
+#define CAPTURE_AT_LOW 26
+#define CAPTURE_AT_HIGH 27
+#define CAPTURE_AT_CHECKSUM 31	/* Bytes 4 to 31 add up to 0 modulo 256, 28 to 30 are 0 */
+
+static void capture_put16(uint8_t *out, uint16_t value)
+{
+	out[0] = (uint8_t)value;
+	out[1] = (uint8_t)(value >> 8);
+}
+
+static uint16_t capture_get16(const uint8_t *in)
+{
+	return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+void capture_marker_encode(const capture_marker_t *marker, uint8_t *out)
+{
+	uint32_t dc_acc = (uint32_t)marker->dc_acc;
+	uint8_t checksum = 0;
+	int i;
+
+	memset(out, 0, CAPTURE_MARKER_SIZE);
+	out[0] = CAPTURE_SYNC_0;
+	out[1] = CAPTURE_SYNC_1;
+	out[2] = CAPTURE_SYNC_2;
+	out[3] = CAPTURE_SYNC_3;
+	capture_put16(out + CAPTURE_AT_FRAME, marker->frame);
+	capture_put16(out + CAPTURE_AT_DROPPED, marker->dropped);
+	capture_put16(out + CAPTURE_AT_DC_ACC, (uint16_t)dc_acc);
+	capture_put16(out + CAPTURE_AT_DC_ACC + 2, (uint16_t)(dc_acc >> 16));
+	memcpy(out + CAPTURE_AT_SCALE, &marker->scale, sizeof(double));
+	capture_put16(out + CAPTURE_AT_DECISION_FRAME, marker->decision.frame);
+	capture_put16(out + CAPTURE_AT_PROCESSED, marker->decision.processed);
+	out[CAPTURE_AT_DETECTOR] = marker->decision.detector;
+	out[CAPTURE_AT_INITS] = marker->decision.inits;
+	out[CAPTURE_AT_LOW] = (uint8_t)marker->decision.low;
+	out[CAPTURE_AT_HIGH] = (uint8_t)marker->decision.high;
+	for (i = CAPTURE_AT_FRAME; i < CAPTURE_AT_CHECKSUM; i++)
+	{
+		checksum = (uint8_t)(checksum + out[i]);
+	}
+	out[CAPTURE_AT_CHECKSUM] = (uint8_t)(0x100 - checksum);
+}
+
+int capture_marker_decode(const uint8_t *in, capture_marker_t *marker)
+{
+	uint8_t checksum = 0;
+	int i;
+
+	if (in[0] != CAPTURE_SYNC_0 || in[1] != CAPTURE_SYNC_1 || in[2] != CAPTURE_SYNC_2 || in[3] != CAPTURE_SYNC_3)
+	{
+		return 0;
+	}
+	for (i = CAPTURE_AT_FRAME; i < CAPTURE_MARKER_SIZE; i++)
+	{
+		checksum = (uint8_t)(checksum + in[i]);
+	}
+	if (checksum != 0)
+	{
+		return 0;
+	}
+	marker->frame = capture_get16(in + CAPTURE_AT_FRAME);
+	marker->dropped = capture_get16(in + CAPTURE_AT_DROPPED);
+	marker->dc_acc = (int32_t)((uint32_t)capture_get16(in + CAPTURE_AT_DC_ACC)
+		| ((uint32_t)capture_get16(in + CAPTURE_AT_DC_ACC + 2) << 16));
+	memcpy(&marker->scale, in + CAPTURE_AT_SCALE, sizeof(double));
+	marker->decision.frame = capture_get16(in + CAPTURE_AT_DECISION_FRAME);
+	marker->decision.processed = capture_get16(in + CAPTURE_AT_PROCESSED);
+	marker->decision.detector = in[CAPTURE_AT_DETECTOR];
+	marker->decision.inits = in[CAPTURE_AT_INITS];
+	marker->decision.low = (int8_t)in[CAPTURE_AT_LOW];
+	marker->decision.high = (int8_t)in[CAPTURE_AT_HIGH];
+	return 1;
+}
+
+void capture_unpack(const uint8_t *in, int count, int *codes)
+{
+	int i;
+
+	for (i = 0; i < count; i += 2, in += 3)
+	{
+		codes[i] = in[0] | ((in[1] & 0x0F) << 8);
+		codes[i + 1] = (in[1] >> 4) | (in[2] << 4);
+	}
+}
@@ -0,0 +1,128 @@
+/*! \file capture.h
+* \brief Raw ADC capture: the codes of the reader streamed over the UART with frame markers, for a bit exact replay
+*
+* Every frame of the reader is sent as a record: a marker of CAPTURE_MARKER_SIZE bytes, then the G_ARRAY_SIZE raw
+* ADC codes of the frame packed 12 bits each, two codes in three bytes (the low byte of the first, its high nibble and
+* the low nibble of the second, the high byte of the second). The codes are taken in store_sample() before anything is
+* done to them, so the frames of the capture are exactly the frames of the reader.
+*
+* The marker carries what the host needs to rebuild the samples the detectors saw: the DC estimate of auto_calibrate.h
+* before the first code of the frame and the scale, so a replay can start at any record. It also carries the last
+* decision of the main loop, the frame it decoded and its tones, which tells the replay which frames the board
+* decoded (a frame whose event was coalesced with the next is skipped) and lets it check that it finds the same
+* tones. host/capture_replay.c reads the records back into the same pipeline.
+*
+* A record is only started when the whole of it fits in the transmit buffer, so a UART too slow for the moment drops
+* whole frames, counted in the markers, and never cuts one. All the fields are little endian.
+*/
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+
+/*! \def CAPTURE_ENABLE
+* \brief 1: the reader streams its raw codes over UART0 at CAPTURE_BAUD
+*/
+#define CAPTURE_ENABLE 0
+
+/*! \def CAPTURE_BAUD
+* \brief Line rate: a record every 64 ms needs about 125 kbit/s with the start and stop bits
+*/
+#define CAPTURE_BAUD 230400
+
+/* Sizes of a record */
+#define CAPTURE_MARKER_SIZE 32
+#define CAPTURE_FRAME_BYTES ((G_ARRAY_SIZE * 3) / 2)
+#define CAPTURE_RECORD_SIZE (CAPTURE_MARKER_SIZE + CAPTURE_FRAME_BYTES)
+
+/* First bytes of a marker, which a reader that lost track looks for */
+#define CAPTURE_SYNC_0 0xA5
+#define CAPTURE_SYNC_1 0x5A
+#define CAPTURE_SYNC_2 0xC3
+#define CAPTURE_SYNC_3 0x3C
+
+#if (G_ARRAY_SIZE % 2) != 0
+#error "capture.c packs the codes in pairs and needs an even G_ARRAY_SIZE"
+#endif
+
+/*! \typedef capture_decision_t
+* \brief Outcome of the last frame decoded by the main loop
+*/
+typedef struct capture_decision_t
+{
+	uint16_t frame;	/*!< Number of the frame decoded */
+	uint16_t processed;	/*!< Frames decoded since the start, wrapping: a step larger than the one of frame means none was skipped */
+	uint8_t detector;	/*!< Identifier of the detector that decoded it */
+	uint8_t inits;	/*!< Calls of init() of the detector since the start, wrapping */
+	int8_t low;	/*!< Low group tone found, as in struct_tone_frequencies */
+	int8_t high;	/*!< High group tone found */
+} capture_decision_t;
+
+/*! \typedef capture_marker_t
+* \brief Contents of a marker
+*/
+typedef struct capture_marker_t
+{
+	uint16_t frame;	/*!< Number of the frame whose codes follow, wrapping */
+	uint16_t dropped;	/*!< Frames not sent since the start because the UART was behind, wrapping */
+	int32_t dc_acc;	/*!< g_calibration.dc_acc before the first code of the frame */
+	double scale;	/*!< g_calibration.scale */
+	capture_decision_t decision;	/*!< Last decision of the main loop when the frame started, frame 0xFFFF before the first */
+} capture_marker_t;
+
+/*! \fn void capture_marker_encode(const capture_marker_t *marker, uint8_t *out)
+* \param marker The marker
+* \param out Receives CAPTURE_MARKER_SIZE bytes, with the sync pattern and a checksum
+*/
+void capture_marker_encode(const capture_marker_t *marker, uint8_t *out);
+
+/*! \fn int capture_marker_decode(const uint8_t *in, capture_marker_t *marker)
+* \param in CAPTURE_MARKER_SIZE bytes
+* \param marker Filled if they are a marker
+* \returns 1 if the sync pattern and the checksum are right, 0 otherwise
+*/
+int capture_marker_decode(const uint8_t *in, capture_marker_t *marker);
+
+/*! \fn void capture_unpack(const uint8_t *in, int count, int *codes)
+* \param in Packed codes, three bytes per pair
+* \param count Number of codes, even
+* \param codes Receives the codes
+*/
+void capture_unpack(const uint8_t *in, int count, int *codes);
+
+/*! \fn void capture_lpc_start(void)
+* \brief Sets up UART0 at CAPTURE_BAUD and its transmit interrupt, board only, before reader_init()
+*/
+void capture_lpc_start(void);
+
+/*! \fn void capture_sample(int code, int index)
+* \param code Raw ADC code
+* \param index Position of the code in the frame being filled, a marker is queued before index 0
+* \brief Queues a code from the sampling interrupt, before the calibration uses it, board only
+*/
+void capture_sample(int code, int index);
+
+/*! \fn uint16_t capture_ready_frame(void)
+* \returns The number of the frame in array_ready, read at the start of the frame task, board only
+*/
+uint16_t capture_ready_frame(void);
+
+/*! \fn void capture_decided(uint16_t frame, uint8_t detector, struct_tone_frequencies tones)
+* \param frame Number of the frame decoded, from capture_ready_frame()
+* \param detector Identifier of the detector in use
+* \param tones Tones it found
+* \brief Publishes a decision, sent in the next marker, board only
+*/
+void capture_decided(uint16_t frame, uint8_t detector, struct_tone_frequencies tones);
+
+/*! \fn void capture_detector_init(void)
+* \brief Counts a call of init() of the detector, board only
+*/
+void capture_detector_init(void);
+
+#endif // CAPTURE_H_
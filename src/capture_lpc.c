@@ -0,0 +1,159 @@
+/*! \file capture_lpc.c
+* \brief Board part of capture.h: a transmit ring filled by the sampling interrupt and emptied by the UART interrupt
+*
+* The sampling interrupt writes a marker at the start of each frame and three bytes for every second code, the UART
+* interrupt moves up to 16 bytes at a time from the ring to the transmit FIFO. The ring has one writer and one reader,
+* so neither masks the other. When the UART has sent everything it stops asking, and the next code written restarts
+* it with uart_tx_kick(): the sampling interrupt has the higher priority, and the UART interrupt only reports an empty
+* ring as its last step, so the two never write the FIFO at the same time.
+*/
+
+/* Driver Headers */
+#include <platform.h>
+#include <uart.h>
+
+/* Our Headers */
+#include "capture.h"
+#include "auto_calibrate.h"
+
+/* Bytes of the ring, a power of two holding two records */
+#define CAPTURE_RING_SIZE 2048
+
+#if CAPTURE_RING_SIZE < 2 * CAPTURE_RECORD_SIZE
+#error "CAPTURE_RING_SIZE has to hold two records, one being sent and one being written"
+#endif
+
+static uint8_t ring[CAPTURE_RING_SIZE];
+static volatile uint32_t ring_head;	/* Bytes written, by the sampling interrupt */
+static volatile uint32_t ring_tail;	/* Bytes sent, by the UART interrupt */
+static volatile int sending;	/* Cleared by the UART interrupt when it found the ring empty */
+
+static uint16_t frames;	/* Frames completed, the number of the frame being filled */
+static uint16_t dropped;
+static int capturing;	/* The frame being filled is sent */
+static int first_code;	/* First code of the pair being packed */
+static volatile capture_decision_t decision;
+static uint8_t inits;
+
+/* Transmit callback of the UART, in its interrupt */
+static int capture_tx_byte(uint8_t *c)
+{
+	uint32_t tail = ring_tail;
+
+	if (tail == ring_head)
+	{
+		sending = 0;
+		return 0;
+	}
+	*c = ring[tail % CAPTURE_RING_SIZE];
+	ring_tail = tail + 1;
+	return 1;
+}
+
+static void capture_write(const uint8_t *data, int count)
+{
+	uint32_t head = ring_head;
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		ring[(head + i) % CAPTURE_RING_SIZE] = data[i];
+	}
+	ring_head = head + count;
+}
+
+void capture_lpc_start(void)
+{
+	ring_head = 0;
+	ring_tail = 0;
+	sending = 0;
+	frames = 0;
+	dropped = 0;
+	capturing = 0;
+	decision.frame = 0xFFFF;
+	decision.processed = 0;
+	decision.detector = 0;
+	decision.inits = 0;
+	decision.low = G_TONE_NONE;
+	decision.high = G_TONE_NONE;
+	inits = 0;
+	uart_init(CAPTURE_BAUD);
+	uart_enable();
+	uart_set_tx_callback(capture_tx_byte);
+}
+
+void capture_sample(int code, int index)
+{
+	capture_marker_t marker;
+	uint8_t bytes[CAPTURE_MARKER_SIZE];
+
+	if (index == 0)
+	{
+		/* A whole record or nothing, the UART only frees space from here on */
+		capturing = CAPTURE_RING_SIZE - (ring_head - ring_tail) >= CAPTURE_RECORD_SIZE;
+		if (capturing)
+		{
+			marker.frame = frames;
+			marker.dropped = dropped;
+			marker.dc_acc = g_calibration.dc_acc;
+			marker.scale = g_calibration.scale;
+			marker.decision = decision;
+			capture_marker_encode(&marker, bytes);
+			capture_write(bytes, CAPTURE_MARKER_SIZE);
+		}
+		else
+		{
+			dropped++;
+		}
+	}
+	if (capturing)
+	{
+		if ((index & 1) == 0)
+		{
+			first_code = code;
+		}
+		else
+		{
+			bytes[0] = (uint8_t)first_code;
+			bytes[1] = (uint8_t)(((first_code >> 8) & 0x0F) | (code << 4));
+			bytes[2] = (uint8_t)(code >> 4);
+			capture_write(bytes, 3);
+		}
+		if (!sending)
+		{
+			sending = 1;
+			uart_tx_kick();
+		}
+	}
+	if (index == G_ARRAY_SIZE - 1)
+	{
+		/* Counted with the code that completes the frame, in the same interrupt that hands it to the main loop */
+		frames++;
+	}
+}
+
+uint16_t capture_ready_frame(void)
+{
+	return (uint16_t)(frames - 1);
+}
+
+void capture_decided(uint16_t frame, uint8_t detector, struct_tone_frequencies tones)
+{
+	capture_decision_t next;
+
+	next.frame = frame;
+	next.processed = (uint16_t)(decision.processed + 1);
+	next.detector = detector;
+	next.inits = inits;
+	next.low = (int8_t)tones.low;
+	next.high = (int8_t)tones.high;
+	/* The sampling interrupt copies it into a marker */
+	__disable_irq();
+	decision = next;
+	__enable_irq();
+}
+
+void capture_detector_init(void)
+{
+	inits++;
+}
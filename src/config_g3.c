@@ -0,0 +1,55 @@
+/*! \file config_g3.c
+* \brief Functions for config_g3.h
+*/
+
+#include "config_g3.h"
+#include "global_parameters.h"
+#include "auto_calibrate.h"
+#include "decoder.h"
+#include "decoder_gtzl.h"
+
+void config_g3_defaults(config_g3_t *config, int algorithm)
+{
+	config->algorithm = (uint8_t)algorithm;
+	config->dc_offset = (uint16_t)(ADC_MASK / 2);
+	config->scale = (float)AUTO_CAL_NOMINAL_SCALE;
+	config->gtzl_threshold = (float)GTZL_DEFAULT_THRESHOLD;
+	config->fft_threshold_low = (float)FFT_DEFAULT_THRESHOLD;
+	config->fft_threshold_high = (float)FFT_DEFAULT_THRESHOLD;
+	config->fft_freq_tolerance = FFT_DEFAULT_FREQ_TOLERANCE;
+	config->sample_rate = G_SAMPLE_RATE;
+	config->frame_size = G_ARRAY_SIZE;
+}
+
+void config_g3_capture(config_g3_t *config, int algorithm)
+{
+	config->algorithm = (uint8_t)algorithm;
+	/* Whole ADC codes only: sub-code jitter of the running mean must not cause an EEPROM write on every boot */
+	config->dc_offset = (uint16_t)(g_calibration.dc_acc >> AUTO_CAL_DC_SHIFT);
+	config->scale = (float)g_calibration.scale;
+	config->gtzl_threshold = (float)ampl_thrs;
+	config->fft_threshold_low = (float)amplitude_threshold_low;
+	config->fft_threshold_high = (float)amplitude_threshold_high;
+	config->fft_freq_tolerance = (uint16_t)freq_tolerance;
+	config->sample_rate = G_SAMPLE_RATE;
+	config->frame_size = G_ARRAY_SIZE;
+}
+
+int config_g3_apply(const config_g3_t *config)
+{
+	if (config->sample_rate != G_SAMPLE_RATE || config->frame_size != G_ARRAY_SIZE)
+	{
+		return 0;
+	}
+
+	ampl_thrs = config->gtzl_threshold;
+	amplitude_threshold_low = config->fft_threshold_low;
+	amplitude_threshold_high = config->fft_threshold_high;
+	freq_tolerance = config->fft_freq_tolerance;
+
+	auto_calibrate_init(config->dc_offset);
+	g_calibration.scale = config->scale;
+	g_calibration.next_scale = config->scale;
+
+	return 1;
+}
@@ -0,0 +1,59 @@
+/*! \file config_g3.h
+* \brief Persistent configuration of the decoder: algorithm, calibration, thresholds and window settings
+*
+* The record is stored by eeprom_g3.h. On a warm boot the calibration is restored from it, so the reader starts
+* with a settled DC estimate instead of seeding one from the first conversions.
+*/
+
+#ifndef CONFIG_G3_H_
+#define CONFIG_G3_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/*! \def CONFIG_G3_SETTLE_FRAMES
+* \brief Frames after which the running calibration is considered settled and worth saving
+*/
+#define CONFIG_G3_SETTLE_FRAMES 16
+
+/*! \typedef config_g3_t
+* \brief Contents of the configuration record
+*/
+typedef struct config_g3_t
+{
+	uint8_t algorithm;	/*!< Identifier of the selected detector, see detector.h */
+	uint16_t dc_offset;	/*!< Calibrated DC offset, in ADC codes */
+	float scale;	/*!< Reader units per ADC code */
+	float gtzl_threshold;	/*!< Magnitude squared threshold of decoder_gtzl() */
+	float fft_threshold_low;	/*!< Low group magnitude threshold of decode_dtmf() */
+	float fft_threshold_high;	/*!< High group magnitude threshold of decode_dtmf() */
+	uint16_t fft_freq_tolerance;	/*!< Frequency tolerance of decode_dtmf(), in Hz */
+	uint16_t sample_rate;	/*!< Sample rate the thresholds were tuned for */
+	uint16_t frame_size;	/*!< Frame length the thresholds were tuned for */
+} config_g3_t;
+
+/*! \fn void config_g3_defaults(config_g3_t *config, int algorithm)
+* \param config Record to fill
+* \param algorithm Detector identifier to store in the record
+* \brief Fills a record with the built-in thresholds and the nominal calibration
+*/
+void config_g3_defaults(config_g3_t *config, int algorithm);
+
+/*! \fn void config_g3_capture(config_g3_t *config, int algorithm)
+* \param config Record to fill
+* \param algorithm Detector identifier to store in the record
+* \brief Fills a record from the running calibration and the thresholds currently in use
+*/
+void config_g3_capture(config_g3_t *config, int algorithm);
+
+/*! \fn int config_g3_apply(const config_g3_t *config)
+* \param config Record to apply
+* \returns 1 if the calibration was restored, 0 if the record was made for a different sample rate or frame size
+* \brief Restores thresholds and calibration from a record
+*
+* Thresholds depend on the frame length and the sample rate, so a record written by a build with different window
+* settings is ignored apart from its algorithm.
+*/
+int config_g3_apply(const config_g3_t *config);
+
+#endif
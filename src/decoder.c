@@ -3,78 +3,91 @@
 */
 
 #include "decoder.h"
+#include "dtmf_table.h"
 #include "string.h"
 #include "lcd.h"
 
 double const T = 1.0 / FS;  /* Sampling interval */
 /* Amplitude thresholds for now */
-double const amplitude_threshold_low = 40000.0; 
-double const amplitude_threshold_high = 40000.0;
+double amplitude_threshold_low = FFT_DEFAULT_THRESHOLD; 
+double amplitude_threshold_high = FFT_DEFAULT_THRESHOLD;
 
-/* DTMF frequencies and their typical ranges due to FFT resolution */
-int const dtmf_low_freqs[] = {697, 770, 852, 941};
-int const dtmf_high_freqs[] = {1209, 1336, 1477, 1633};
-int const freq_tolerance = 30; /* Frequency tolerance due to FFT resolution */
+/* Range around the DTMF frequencies of dtmf_table.h due to FFT resolution */
+int freq_tolerance = FFT_DEFAULT_FREQ_TOLERANCE; /* Frequency tolerance due to FFT resolution */
+
+/* Magnitude ratio to the strongest peak of a group below which decode_dtmf_power() ignores a peak, 10 dB */
+#define DECODE_GROUP_RANGE 3.16
 
 /*! \fn struct_tone_frequencies decode_dtmf(complex_g3_t *data)
 * \param data Pointer to an array of complex numbers representing the frequency spectrum of a DTMF signal
-* \returns A struct_tone_frequencies object containing the dominant low and high frequencies detected in the DTMF signal
+* \returns A struct_tone_frequencies object containing the indices of the dominant low and high frequencies detected in the DTMF signal
 * \brief Identifies the potential low and high frequencies from a given DTMF signal using the FFT output provided in the `data` array.
 * 
 * This function processes the FFT results stored in `data` to detect the presence of specific DTMF frequencies within the permissible 
 * frequency tolerance. It calculates the magnitude of each frequency that is within a range of a valid dtmf tone in the FFT output and 
 * compares it against an amplitude threshold and frequency tolerance. The function returns the dominant frequencies that are within 
-* the specified thresholds. If multiple valid frequencies are found within the tolerance range or if no valid frequency is detected, the 
-* function may adjust or set the values to indicate an error or ambiguity in detection.
+* the specified thresholds. If no valid frequency is detected in a group its index is G_TONE_NONE, if several distinct ones are found 
+* it is G_TONE_MULTI.
 */
 struct_tone_frequencies decode_dtmf(complex_g3_t *data) 
+{
+	return decode_dtmf_rate(data, FS, NN);
+}
+
+/*! \fn struct_tone_frequencies decode_dtmf_rate(complex_g3_t *data, int fs, int n)
+* \param data Pointer to the spectrum of n samples taken at fs
+* \param fs Sample rate of the analysed samples, in Hz
+* \param n Number of points of the FFT
+* \returns The indices of the dominant low and high frequencies, as decode_dtmf()
+* \brief decode_dtmf() for a spectrum computed at another rate or size, such as after the decimate-by-2 stage
+*
+* Bin i is at fs * i / n Hz. The magnitude of a tone grows with the number of points, so the thresholds tuned for
+* NN points are scaled by n / NN.
+*/
+struct_tone_frequencies decode_dtmf_rate(complex_g3_t *data, int fs, int n) 
 {
 	struct_tone_frequencies result;
 	double max_low_freq_amp = 0, max_high_freq_amp = 0;
+	double threshold_low = amplitude_threshold_low * n / NN;
+	double threshold_high = amplitude_threshold_high * n / NN;
 	int i, j;
-	result.low = 0, result.high = 0;
+	result.low = G_TONE_NONE, result.high = G_TONE_NONE;
 
 	/* Check only up to Nyquist frequency */
-	for (i = 0; i < (NN / 2); i++)
-	{ 		
-		double amp = sqrt(data[i].re * data[i].re + data[i].im * data[i].im);
-	}
-
-	/* Check only up to Nyquist frequency */
-	for (i = 0; i < (NN / 2); i++) 
+	for (i = 0; i < (n / 2); i++) 
 	{ 
-		double freq = (double)(FS * i) / NN;
+		double freq = (double)(fs * i) / n;
 		double amp = complex_magnitude(data[i]);
 
 		/* Check low group frequencies */
 		for (j = 0; j < 4; j++) 
 		{
-			if (fabs(freq - dtmf_low_freqs[j]) <= freq_tolerance && amp > amplitude_threshold_low) 
+			if (fabs(freq - dtmf_low_freqs[j]) <= freq_tolerance && amp > threshold_low) 
 			{
-				if (result.low == 0 || (amp > max_low_freq_amp && fabs(freq - result.low) <= freq_tolerance)) 
+				if (result.low == G_TONE_NONE || (result.low >= 0 && amp > max_low_freq_amp && fabs(freq - dtmf_low_freqs[result.low]) <= freq_tolerance)) 
 				{
 					max_low_freq_amp = amp;
-					result.low = dtmf_low_freqs[j];
+					result.low = j;
 				}
-				else if (result.low != dtmf_low_freqs[j] && fabs(freq - result.low) > freq_tolerance)
+				else if (result.low >= 0 && result.low != j && fabs(freq - dtmf_low_freqs[result.low]) > freq_tolerance)
 				{
-					result.low = -1;
+					result.low = G_TONE_MULTI;
 				}
 			}
 		}
 		/* Check high group frequencies */
 		for (j = 0; j < 4; j++) 
 		{
-			if (fabs(freq - dtmf_high_freqs[j]) <= freq_tolerance && amp > amplitude_threshold_high) 
+			if (fabs(freq - dtmf_high_freqs[j]) <= freq_tolerance && amp > threshold_high) 
 			{
-				if (result.high == 0 || (amp > max_high_freq_amp && fabs(freq - result.high) <= freq_tolerance)) 
+				if (result.high == G_TONE_NONE || (result.high >= 0 && amp > max_high_freq_amp && fabs(freq - dtmf_high_freqs[result.high]) <= freq_tolerance)) 
 				{
 					max_high_freq_amp = amp;
-					result.high = dtmf_high_freqs[j];
+					result.high = j;
 				}
-				else if (result.high != dtmf_high_freqs[j] && fabs(freq - result.high) > freq_tolerance)
+				else if (result.high >= 0 && result.high != j && fabs(freq - dtmf_high_freqs[result.high]) > freq_tolerance)
 				{
-					result.high = -1;
+					result.high = G_TONE_MULTI;
 				}
 			}
 		}
@@ -82,3 +95,123 @@ struct_tone_frequencies decode_dtmf(complex_g3_t *data)
 
 	return result;
 }
+
+/* Magnitude |X| at the vertex of the parabola through the log powers of bins i - 1, i, i + 1, and its frequency, or 0 if
+* bin i is not a local peak */
+static double decode_interpolate(const double *power, int i, int fs, int n, double *frequency)
+{
+	double a, b, c, offset;
+
+	if (power[i] <= power[i - 1] || power[i] < power[i + 1] || power[i - 1] <= 0.0 || power[i + 1] <= 0.0)
+	{
+		return 0.0;
+	}
+	a = log(power[i - 1]);
+	b = log(power[i]);
+	c = log(power[i + 1]);
+	offset = 0.5 * (c - a) / (2.0 * b - a - c);
+	*frequency = (i + offset) * fs / n;
+	return exp(0.5 * (b + 0.25 * (c - a) * offset));
+}
+
+/* First and last bins searched between two frequencies, keeping a neighbour on each side */
+static void decode_bins(double low, double high, int fs, int n, int *first, int *last)
+{
+	*first = (int)floor(low * n / fs);
+	*last = (int)ceil(high * n / fs);
+	*first = *first < 1 ? 1 : *first;
+	*last = *last > n / 2 - 2 ? n / 2 - 2 : *last;
+}
+
+/*! \fn double decode_peak_frequency(const double *power, int fs, int n, double low, double high, double *magnitude)
+* \param power The n / 2 bin powers of FFT_power()
+* \param fs Sample rate of the analysed samples, in Hz
+* \param n Number of points of the FFT
+* \param low Lowest frequency searched, in Hz
+* \param high Highest frequency searched, in Hz
+* \param magnitude Set to the interpolated peak magnitude |X|, before the window gain is taken out; may be NULL
+* \returns The interpolated frequency of the strongest local peak between low and high, or -1 if there is none
+* \brief Sub-bin frequency of a tone from a windowed power spectrum
+*/
+double decode_peak_frequency(const double *power, int fs, int n, double low, double high, double *magnitude)
+{
+	double result = -1.0, peak = 0.0, frequency, amp;
+	int first, last, i;
+
+	decode_bins(low, high, fs, n, &first, &last);
+	for (i = first; i <= last; i++)
+	{
+		amp = decode_interpolate(power, i, fs, n, &frequency);
+		if (amp > peak && frequency >= low && frequency <= high)
+		{
+			peak = amp;
+			result = frequency;
+		}
+	}
+	if (magnitude != NULL)
+	{
+		*magnitude = peak;
+	}
+	return result;
+}
+
+/* Tone of a group for decode_dtmf_power(), from the interpolated local peaks between the group edges. As in the tone
+* bank, a peak only counts within 10 dB of the strongest one of the group: with the shorter blocks a noise peak next to a
+* tone gets over the threshold far more often than with the 512 points. */
+static int decode_group_power(const double *power, int fs, int n, const int *tones, double threshold)
+{
+	double frequency, magnitude, strongest = 0.0;
+	int tone = G_TONE_NONE;
+	int first, last, i, j;
+
+	decode_bins(tones[0] - freq_tolerance, tones[3] + freq_tolerance, fs, n, &first, &last);
+	for (i = first; i <= last; i++)
+	{
+		magnitude = decode_interpolate(power, i, fs, n, &frequency);
+		strongest = magnitude > strongest ? magnitude : strongest;
+	}
+	if (strongest / DECODE_GROUP_RANGE > threshold)
+	{
+		threshold = strongest / DECODE_GROUP_RANGE;
+	}
+
+	for (i = first; i <= last; i++)
+	{
+		if (decode_interpolate(power, i, fs, n, &frequency) <= threshold)
+		{
+			continue;
+		}
+		for (j = 0; j < 4; j++)
+		{
+			if (fabs(frequency - tones[j]) <= freq_tolerance)
+			{
+				if (tone == G_TONE_NONE)
+				{
+					tone = j;
+				}
+				else if (tone != j)
+				{
+					return G_TONE_MULTI;
+				}
+			}
+		}
+	}
+	return tone;
+}
+
+/*! \fn struct_tone_frequencies decode_dtmf_power(const double *power, int fs, int n, double gain)
+* \param power The n / 2 bin powers of FFT_power()
+* \param fs Sample rate of the analysed samples, in Hz
+* \param n Number of points of the FFT
+* \param gain Coherent gain of the window, FFT_window_gain()
+* \returns The indices of the dominant low and high frequencies, as decode_dtmf()
+* \brief decode_dtmf() on the interpolated peaks of a windowed spectrum
+*/
+struct_tone_frequencies decode_dtmf_power(const double *power, int fs, int n, double gain)
+{
+	struct_tone_frequencies result;
+
+	result.low = decode_group_power(power, fs, n, dtmf_low_freqs, amplitude_threshold_low * n / NN * gain);
+	result.high = decode_group_power(power, fs, n, dtmf_high_freqs, amplitude_threshold_high * n / NN * gain);
+	return result;
+}
@@ -15,18 +15,66 @@
 #define NN G_ARRAY_SIZE  /* Define the maximum FFT size, must be a power of 2 */
 #define FS G_SAMPLE_RATE
 
+/* Built-in thresholds, the values in use can be restored from the configuration record at boot */
+#define FFT_DEFAULT_THRESHOLD 40000.0
+#define FFT_DEFAULT_FREQ_TOLERANCE 30
+
+extern double amplitude_threshold_low;
+extern double amplitude_threshold_high;
+extern int freq_tolerance;
+
 /*! \fn struct_tone_frequencies decode_dtmf(complex_g3_t *data)
 * \param data Pointer to an array of complex numbers representing the frequency spectrum of a DTMF signal
-* \returns A struct_tone_frequencies object containing the dominant low and high frequencies detected in the DTMF signal
+* \returns A struct_tone_frequencies object containing the indices of the dominant low and high frequencies detected in the DTMF signal
 * \brief Identifies the potential low and high frequencies from a given DTMF signal using the FFT output provided in the `data` array.
 * 
 * This function processes the FFT results stored in `data` to detect the presence of specific DTMF frequencies within the permissible 
 * frequency tolerance. It calculates the magnitude of each frequency that is within a range of a valid dtmf tone in the FFT output and 
 * compares it against an amplitude threshold and frequency tolerance. The function returns the dominant frequencies that are within 
-* the specified thresholds. If multiple valid frequencies are found within the tolerance range or if no valid frequency is detected, the 
-* function may adjust or set the values to indicate an error or ambiguity in detection.
+* the specified thresholds. If no valid frequency is detected in a group its index is G_TONE_NONE, if several distinct ones are found 
+* it is G_TONE_MULTI.
 */
 
 struct_tone_frequencies decode_dtmf(complex_g3_t *data);
 
+/*! \fn struct_tone_frequencies decode_dtmf_rate(complex_g3_t *data, int fs, int n)
+* \param data Pointer to the spectrum of n samples taken at fs
+* \param fs Sample rate of the analysed samples, in Hz
+* \param n Number of points of the FFT
+* \returns The indices of the dominant low and high frequencies, as decode_dtmf()
+* \brief decode_dtmf() for a spectrum computed at another rate or size, such as after the decimate-by-2 stage
+*
+* The thresholds tuned for NN points are scaled by n / NN.
+*/
+struct_tone_frequencies decode_dtmf_rate(complex_g3_t *data, int fs, int n);
+
+/*! \fn double decode_peak_frequency(const double *power, int fs, int n, double low, double high, double *magnitude)
+* \param power The n / 2 bin powers of FFT_power()
+* \param fs Sample rate of the analysed samples, in Hz
+* \param n Number of points of the FFT
+* \param low Lowest frequency searched, in Hz
+* \param high Highest frequency searched, in Hz
+* \param magnitude Set to the interpolated peak magnitude |X|, before the window gain is taken out; may be NULL
+* \returns The interpolated frequency of the strongest local peak between low and high, or -1 if there is none
+* \brief Sub-bin frequency of a tone from a windowed power spectrum
+*
+* A parabola is fitted through the logarithm of the powers of the peak bin and its two neighbours, which is exact for a
+* Gaussian main lobe and within a few hundredths of a bin for the Hann and Blackman windows.
+*/
+double decode_peak_frequency(const double *power, int fs, int n, double low, double high, double *magnitude);
+
+/*! \fn struct_tone_frequencies decode_dtmf_power(const double *power, int fs, int n, double gain)
+* \param power The n / 2 bin powers of FFT_power()
+* \param fs Sample rate of the analysed samples, in Hz
+* \param n Number of points of the FFT
+* \param gain Coherent gain of the window, FFT_window_gain()
+* \returns The indices of the dominant low and high frequencies, as decode_dtmf()
+* \brief decode_dtmf() on the interpolated peaks of a windowed spectrum
+*
+* Each local peak of a group above the threshold is interpolated with decode_peak_frequency() and taken for the DTMF tone
+* within freq_tolerance of its frequency, a peak near no tone is ignored and two peaks of different tones give
+* G_TONE_MULTI. The peak magnitudes are divided by the window gain, so the thresholds of decode_dtmf_rate() apply.
+*/
+struct_tone_frequencies decode_dtmf_power(const double *power, int fs, int n, double gain);
+
 #endif
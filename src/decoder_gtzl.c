@@ -8,7 +8,7 @@
 #include "gtzl.h"
 #include "decoder_gtzl.h"
 
-const double AMPL_THRS = 1200000000;	/* The amplitude threshold for the amplitude of a DTMF frequency */
+double ampl_thrs = GTZL_DEFAULT_THRESHOLD;	/* The amplitude threshold for the amplitude of a DTMF frequency */
 const unsigned short DTMF_FREQ_AMT_D2 = DTMF_FREQ_AMT / 2;
 
 struct_tone_frequencies
@@ -17,10 +17,10 @@ decoder_gtzl
 double amplitudes[DTMF_FREQ_AMT]
 )
 {
-	/* This contains the dominant frequencies from the received array of frequency amplitudes.
-	* Values of -1 indicate an error or that a DTMF tone has not been identified.
+	/* This contains the indices of the dominant frequencies from the received array of frequency amplitudes.
+	* Values of G_TONE_MULTI indicate that the signal is not DTMF, G_TONE_NONE that a tone of the group has not been identified.
 	*/
-	struct_tone_frequencies frqs_tone_return = {-1,-1};
+	struct_tone_frequencies frqs_tone_return = {G_TONE_MULTI, G_TONE_MULTI};
 
 	/* The below two booleans indicate if a low and high frequency has been found, which is above the desired threshold.
 	* These will also be used to check if there are multiple DTMF tone pairs, which results in a signal that is not DTMF.
@@ -29,15 +29,15 @@ double amplitudes[DTMF_FREQ_AMT]
 	unsigned char found_lo = 0;
 	unsigned char found_hi = 0;
 
-	unsigned short frq_tmp_lo = 0;
-	unsigned short frq_tmp_hi = 0;
+	int frq_tmp_lo = G_TONE_NONE;
+	int frq_tmp_hi = G_TONE_NONE;
 
 	unsigned short i = 0;	/* Generic Iterator */
 
 	/* Ideal threshold for amps probably in the range [500, 800] */
 	for (i = 0; i < DTMF_FREQ_AMT_D2; i++)
 	{
-		if (amplitudes[i] > AMPL_THRS)
+		if (amplitudes[i] > ampl_thrs)
 		/* This signifies the low frequencies.
 		* The amplitudes of the following frequencies are held between i = 0 and i = 3: {697, 770, 852, 941}
 		*/
@@ -50,12 +50,12 @@ double amplitudes[DTMF_FREQ_AMT]
 			}
 			else
 			{
-				frq_tmp_lo = DTMF_FRQS[i];
+				frq_tmp_lo = i;
 				found_lo = 1;
 			}
 		}
 		
-		if (amplitudes[4 + i] > AMPL_THRS)
+		if (amplitudes[4 + i] > ampl_thrs)
 		/* This signifies the high frequencies.
 		* The amplitudes of the following frequencies are held between i = 4 and i = 7: {1209, 1336, 1477, 1633}
 		*/
@@ -68,14 +68,14 @@ double amplitudes[DTMF_FREQ_AMT]
 			}
 			else
 			{
-				frq_tmp_hi = DTMF_FRQS[4 + i];
+				frq_tmp_hi = i;
 				found_hi = 1;
 			}
 		}
 	}
 
-	frqs_tone_return.low = (int) frq_tmp_lo;
-	frqs_tone_return.high = (int) frq_tmp_hi;
+	frqs_tone_return.low = frq_tmp_lo;
+	frqs_tone_return.high = frq_tmp_hi;
 
 	return frqs_tone_return;
 }
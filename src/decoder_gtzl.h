@@ -10,9 +10,19 @@
 #include "global_parameters.h"
 #include "gtzl.h"
 
+/*! \def GTZL_DEFAULT_THRESHOLD
+* \brief Built-in threshold for the magnitude squared of a DTMF frequency
+*/
+#define GTZL_DEFAULT_THRESHOLD 1200000000.0
+
+/*! \var double ampl_thrs
+* \brief The amplitude threshold in use, restored from the configuration record at boot
+*/
+extern double ampl_thrs;
+
 /*! \fn struct_tone_frequencies decoder_gtzl (double amplitudes[DTMF_FREQ_AMT])
 * \param amplitudes[DTMF_FREQ_AMT] Array of amplitudes for the 8 DTMF frequencies; size is enforced through the constant DTMF_FREQ_AMT.
-* \returns Two dominant DTMF frequencies; values of -1 for both frequencies ({-1,-1}) indicates an error during function execution or that the input signal is not DTMF compliant.
+* \returns The indices (0-3 within each group) of the two dominant DTMF frequencies; G_TONE_MULTI for both indicates that the input signal is not DTMF compliant, G_TONE_NONE that no tone of a group is above the threshold.
 * \brief Identifies the two dominant frequencies of an input signal represented through the amplitudes of DTMF frequencies within it
 *
 * DTMF compliancy is checked at this stage.
@@ -0,0 +1,52 @@
+/*! \file detector.c
+* \brief Functions for detector.h
+*/
+
+/* C Library Headers */
+#include <stddef.h>
+
+/* Header */
+#include "detector.h"
+
+/* Identifiers 2 and 3 are the algorithm numbers used before the table existed, so stored records keep working.
+* 5 was the decimated Goertzel detector: it is not reused, a record that still holds it boots with the default. */
+const detector_t *const g_detectors[] = {
+	&detector_fft,
+	&detector_gtzl,
+	&detector_fft_d2,
+	&detector_hybrid,
+	&detector_fft_256,
+	&detector_fft_128,
+	&detector_bank,
+	&detector_sdft
+};
+
+const int g_detector_count = sizeof(g_detectors) / sizeof(g_detectors[0]);
+
+const detector_t *detector_find(int id)
+{
+	int i;
+
+	for (i = 0; i < g_detector_count; i++)
+	{
+		if (g_detectors[i]->id == id)
+		{
+			return g_detectors[i];
+		}
+	}
+	return NULL;
+}
+
+int detector_index(const detector_t *detector)
+{
+	int i;
+
+	for (i = 0; i < g_detector_count; i++)
+	{
+		if (g_detectors[i] == detector)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
@@ -0,0 +1,78 @@
+/*! \file detector.h
+* \brief Common interface of the DTMF detectors and the table of the detectors built into the firmware
+*
+* A detector takes one frame of G_ARRAY_SIZE centred samples and reports the dominant low and high DTMF frequencies,
+* with the same conventions as decode_dtmf() and decoder_gtzl(). The main loop, the settings page, the configuration
+* record and the host benchmark only go through this interface, so a new engine is added by writing one
+* detector_xxx.c file and listing it in g_detectors[].
+*/
+
+#ifndef DETECTOR_H_
+#define DETECTOR_H_
+
+/* C Library Headers */
+#include <stddef.h>
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "complex_g3.h"
+
+/*! \def DETECTOR_NAME_LENGTH
+* \brief Longest name that fits between the selection marks of the settings page
+*/
+#define DETECTOR_NAME_LENGTH 12
+
+/*! \typedef detector_t
+* \brief Description and entry points of a detector
+*/
+typedef struct detector_t
+{
+	const char *name;	/*!< Name shown on the settings page and in the benchmark output */
+	uint8_t id;	/*!< Identifier stored in the configuration record, never reused */
+	uint8_t led_red, led_green, led_blue;	/*!< LED colour shown while the detector is running */
+	void (*init)(void);	/*!< Resets the detector state, called when the detector is selected */
+	void (*process_frame)(complex_g3_t *frame);	/*!< Analyses one frame of G_ARRAY_SIZE samples */
+	struct_tone_frequencies (*get_tones)(void);	/*!< Tone indices found in the last frame, G_TONE_NONE or G_TONE_MULTI when there is none */
+	uint32_t (*memory_footprint)(void);	/*!< Bytes of RAM used by the detector */
+	uint32_t (*cost_estimate)(void);	/*!< Multiplications per frame */
+	void (*process_g711)(const unsigned char *codes, const float *table);	/*!< Analyses one frame of G_ARRAY_SIZE G.711 codes with the expansion table of their law, NULL if g711_detect() has to expand them into a frame first */
+} detector_t;
+
+/* Detectors built into the firmware, the calls specific to one engine are in its own detector_xxx.h */
+extern const detector_t detector_fft;
+extern const detector_t detector_gtzl;
+extern const detector_t detector_fft_d2;
+extern const detector_t detector_hybrid;
+extern const detector_t detector_fft_256;
+extern const detector_t detector_fft_128;
+extern const detector_t detector_bank;
+extern const detector_t detector_sdft;
+
+/*! \var g_detectors
+* \brief Table of the available detectors, the first one is the default
+*/
+extern const detector_t *const g_detectors[];
+
+/*! \var g_detector_count
+* \brief Number of entries of g_detectors[]
+*/
+extern const int g_detector_count;
+
+/*! \fn const detector_t *detector_find(int id)
+* \param id Identifier stored in the configuration record
+* \returns The detector with that identifier, or NULL if there is none
+* \brief Looks a detector up by identifier
+*/
+const detector_t *detector_find(int id);
+
+/*! \fn int detector_index(const detector_t *detector)
+* \param detector A detector of the table
+* \returns Position of the detector in g_detectors[], or -1 if it is not listed
+* \brief Looks a detector up in the table
+*/
+int detector_index(const detector_t *detector);
+
+#endif
@@ -0,0 +1,48 @@
+/*! \file detector_bank.c
+* \brief Tone bank detector: every family of tone_bank.c in one pass, the DTMF result drives the display
+*/
+
+/* Header */
+#include "detector_bank.h"
+
+static tone_bank_t bank;
+
+static void bank_init(void)
+{
+	tone_bank_init(&bank, TONE_BANK_ALL_FAMILIES);
+}
+
+static void bank_process_frame(complex_g3_t *frame)
+{
+	tone_bank_process(&bank, frame);
+}
+
+static struct_tone_frequencies bank_get_tones(void)
+{
+	return bank.result.dtmf;
+}
+
+static uint32_t bank_memory_footprint(void)
+{
+	return sizeof(bank);
+}
+
+static uint32_t bank_cost_estimate(void)
+{
+	return tone_bank_mults(&bank);
+}
+
+const tone_bank_result_t *detector_bank_result(void)
+{
+	return &bank.result;
+}
+
+const detector_t detector_bank = {
+	"TONES", 7, 1, 0, 0,
+	bank_init,
+	bank_process_frame,
+	bank_get_tones,
+	bank_memory_footprint,
+	bank_cost_estimate,
+	NULL
+};
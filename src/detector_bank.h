@@ -0,0 +1,17 @@
+/*! \file detector_bank.h
+* \brief Tones of the other families found by the tone bank detector, next to the common interface of detector.h
+*/
+
+#ifndef DETECTOR_BANK_H_
+#define DETECTOR_BANK_H_
+
+/* Our Headers */
+#include "detector.h"
+#include "tone_bank.h"
+
+/*! \fn const tone_bank_result_t *detector_bank_result(void)
+* \returns Call progress, fax and MF tones found by detector_bank in the last frame, next to its DTMF tones
+*/
+const tone_bank_result_t *detector_bank_result(void);
+
+#endif
@@ -0,0 +1,60 @@
+/*! \file detector_fft.c
+* \brief FFT detector: FFT_simple() followed by decode_dtmf()
+*/
+
+/* Our Headers */
+#include "detector.h"
+#include "fft.h"
+#include "decoder.h"
+
+static struct_tone_frequencies tones;
+
+static void fft_init(void)
+{
+	tones.low = G_TONE_NONE;
+	tones.high = G_TONE_NONE;
+}
+
+static void fft_process_frame(complex_g3_t *frame)
+{
+	tones = decode_dtmf(FFT_simple(frame, G_ARRAY_SIZE));
+}
+
+static void fft_process_g711(const unsigned char *codes, const float *table)
+{
+	tones = decode_dtmf(FFT_simple_g711(codes, table, G_ARRAY_SIZE));
+}
+
+static struct_tone_frequencies fft_get_tones(void)
+{
+	return tones;
+}
+
+/* out[] of fft.c, the twiddle factors and the bit-reversal table are in flash */
+static uint32_t fft_memory_footprint(void)
+{
+	return NN * sizeof(complex_g3_t) + sizeof(tones);
+}
+
+/* N/2 log2(N) butterflies of 4 real multiplications */
+static uint32_t fft_cost_estimate(void)
+{
+	uint32_t stages = 0;
+	uint32_t n;
+
+	for (n = NN; n > 1; n >>= 1)
+	{
+		stages++;
+	}
+	return 2 * NN * stages;
+}
+
+const detector_t detector_fft = {
+	"FFT", 2, 0, 0, 1,
+	fft_init,
+	fft_process_frame,
+	fft_get_tones,
+	fft_memory_footprint,
+	fft_cost_estimate,
+	fft_process_g711
+};
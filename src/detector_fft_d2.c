@@ -0,0 +1,62 @@
+/*! \file detector_fft_d2.c
+* \brief Decimated FFT detector: decimate-by-2 stage, then a G_ARRAY_SIZE / 2 point FFT at G_SAMPLE_RATE / 2
+*
+* The bins keep the spacing of the full rate FFT, the transform costs less than half.
+*/
+
+/* Our Headers */
+#include "detector.h"
+#include "resampler.h"
+#include "fft.h"
+#include "decoder.h"
+
+static resampler_halfband_t halfband;
+static complex_g3_t decimated[G_ARRAY_SIZE / 2];
+static struct_tone_frequencies tones;
+
+static void fft_d2_init(void)
+{
+	resampler_halfband_init(&halfband);
+	tones.low = G_TONE_NONE;
+	tones.high = G_TONE_NONE;
+}
+
+static void fft_d2_process_frame(complex_g3_t *frame)
+{
+	resampler_halfband_process(&halfband, frame, G_ARRAY_SIZE, decimated);
+	tones = decode_dtmf_rate(FFT_simple(decimated, G_ARRAY_SIZE / 2), G_SAMPLE_RATE / 2, G_ARRAY_SIZE / 2);
+}
+
+static struct_tone_frequencies fft_d2_get_tones(void)
+{
+	return tones;
+}
+
+/* The half of out[] of fft.c in use, the decimated frame and the filter state */
+static uint32_t fft_d2_memory_footprint(void)
+{
+	return (NN / 2) * sizeof(complex_g3_t) + sizeof(decimated) + sizeof(halfband) + sizeof(tones);
+}
+
+/* Half-band filter, then the FFT of detector_fft.c on half the points */
+static uint32_t fft_d2_cost_estimate(void)
+{
+	uint32_t stages = 0;
+	uint32_t n;
+
+	for (n = NN / 2; n > 1; n >>= 1)
+	{
+		stages++;
+	}
+	return (NN / 2) * resampler_halfband_mults() + NN * stages;
+}
+
+const detector_t detector_fft_d2 = {
+	"FFT/2", 4, 1, 0, 1,
+	fft_d2_init,
+	fft_d2_process_frame,
+	fft_d2_get_tones,
+	fft_d2_memory_footprint,
+	fft_d2_cost_estimate,
+	NULL
+};
@@ -0,0 +1,56 @@
+/*! \file detector_gtzl.c
+* \brief Goertzel detector: goertzel() followed by decoder_gtzl()
+*/
+
+/* Our Headers */
+#include "detector.h"
+#include "gtzl.h"
+#include "decoder_gtzl.h"
+
+static double amplitudes[DTMF_FREQ_AMT];
+static struct_tone_frequencies tones;
+
+static void gtzl_init(void)
+{
+	tones.low = G_TONE_NONE;
+	tones.high = G_TONE_NONE;
+}
+
+static void gtzl_process_frame(complex_g3_t *frame)
+{
+	goertzel(frame, amplitudes);
+	tones = decoder_gtzl(amplitudes);
+}
+
+/* The codes are expanded inside the recursions, the frame of samples is never built */
+static void gtzl_process_g711(const unsigned char *codes, const float *table)
+{
+	goertzel_g711(codes, table, amplitudes);
+	tones = decoder_gtzl(amplitudes);
+}
+
+static struct_tone_frequencies gtzl_get_tones(void)
+{
+	return tones;
+}
+
+static uint32_t gtzl_memory_footprint(void)
+{
+	return sizeof(amplitudes) + sizeof(tones);
+}
+
+/* One multiplication per frequency and sample, three per frequency for the final magnitude */
+static uint32_t gtzl_cost_estimate(void)
+{
+	return DTMF_FREQ_AMT * (G_ARRAY_SIZE + 3);
+}
+
+const detector_t detector_gtzl = {
+	"GTZL", 3, 0, 1, 1,
+	gtzl_init,
+	gtzl_process_frame,
+	gtzl_get_tones,
+	gtzl_memory_footprint,
+	gtzl_cost_estimate,
+	gtzl_process_g711
+};
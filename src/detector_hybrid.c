@@ -0,0 +1,163 @@
+/*! \file detector_hybrid.c
+* \brief Hybrid detector: goertzel() on every frame, the FFT detector only on the frames Goertzel cannot settle
+*
+* Each group of four Goertzel magnitudes is clear when all of them are well below the threshold, or when one is well
+* above it and the other three well below. A frame is settled by Goertzel alone when both groups are clear and, if
+* both hold a tone, the twist is within the DTMF limits and the two tones carry most of the frame energy; the last
+* check is what tells a tone pair from broadband noise that reaches the same bins. Any other frame, borderline or
+* possibly multitone, goes through FFT_simple() and decode_dtmf() as in the FFT detector, whose result is used.
+*/
+
+/* Header */
+#include "detector_hybrid.h"
+
+/* Our Headers */
+#include "gtzl.h"
+#include "decoder_gtzl.h"
+#include "fft.h"
+#include "decoder.h"
+
+/* Margins around ampl_thrs, on the magnitudes squared: a tone is well above at 4 times (+6 dB), absent below a quarter */
+#define HYBRID_MARGIN_HIGH 4.0
+#define HYBRID_MARGIN_LOW 0.25
+
+/* Largest power ratio between the two tones, 8 dB of twist */
+#define HYBRID_TWIST_RATIO 6.3
+
+/* Smallest share of the frame energy carried by the two tones */
+#define HYBRID_TONE_SHARE 0.5
+
+static double amplitudes[DTMF_FREQ_AMT];
+static struct_tone_frequencies tones;
+static uint32_t frames;
+static uint32_t escalated;
+
+static void hybrid_init(void)
+{
+	tones.low = G_TONE_NONE;
+	tones.high = G_TONE_NONE;
+	frames = 0;
+	escalated = 0;
+}
+
+/* Returns the index of the tone of a group of four magnitudes, G_TONE_NONE if all are absent, G_TONE_MULTI if unclear */
+static int hybrid_group(const double *group, double high, double low)
+{
+	int found = G_TONE_NONE;
+	int i;
+
+	for (i = 0; i < DTMF_FREQ_AMT / 2; i++)
+	{
+		if (group[i] >= high && found == G_TONE_NONE)
+		{
+			found = i;
+		}
+		else if (group[i] >= low)
+		{
+			return G_TONE_MULTI;
+		}
+	}
+	return found;
+}
+
+/* Share of the frame energy in the two tones: a tone of amplitude A gives a magnitude squared of (A N / 2)^2 and
+* A^2 N / 2 of energy, the block of goertzel() is taken as N = G_ARRAY_SIZE */
+static double hybrid_tone_share(const complex_g3_t *frame, double tone_power)
+{
+	double energy = 0.0;
+	int i;
+
+	for (i = 0; i < G_ARRAY_SIZE; i++)
+	{
+		energy += frame[i].re * frame[i].re;
+	}
+	if (energy <= 0.0)
+	{
+		return 0.0;
+	}
+	return 2.0 * tone_power / ((double)G_ARRAY_SIZE * energy);
+}
+
+/* Returns 1 if Goertzel alone settles the frame */
+static int hybrid_settled(const complex_g3_t *frame)
+{
+	const double *low_group = amplitudes;
+	const double *high_group = amplitudes + DTMF_FREQ_AMT / 2;
+	int low = hybrid_group(low_group, ampl_thrs * HYBRID_MARGIN_HIGH, ampl_thrs * HYBRID_MARGIN_LOW);
+	int high = hybrid_group(high_group, ampl_thrs * HYBRID_MARGIN_HIGH, ampl_thrs * HYBRID_MARGIN_LOW);
+	double low_power, high_power;
+
+	if (low == G_TONE_MULTI || high == G_TONE_MULTI)
+	{
+		return 0;
+	}
+	if (low == G_TONE_NONE || high == G_TONE_NONE)
+	{
+		/* Silence or a single tone, not a key either way */
+		return 1;
+	}
+
+	low_power = low_group[low];
+	high_power = high_group[high];
+	if (low_power > HYBRID_TWIST_RATIO * high_power || high_power > HYBRID_TWIST_RATIO * low_power)
+	{
+		return 0;
+	}
+	return hybrid_tone_share(frame, low_power + high_power) >= HYBRID_TONE_SHARE;
+}
+
+static void hybrid_process_frame(complex_g3_t *frame)
+{
+	goertzel(frame, amplitudes);
+	frames++;
+	if (hybrid_settled(frame))
+	{
+		tones = decoder_gtzl(amplitudes);
+	}
+	else
+	{
+		escalated++;
+		tones = decode_dtmf(FFT_simple(frame, G_ARRAY_SIZE));
+	}
+}
+
+static struct_tone_frequencies hybrid_get_tones(void)
+{
+	return tones;
+}
+
+/* The Goertzel magnitudes plus out[] of fft.c, which stays reserved for the escalated frames */
+static uint32_t hybrid_memory_footprint(void)
+{
+	return sizeof(amplitudes) + sizeof(tones) + NN * sizeof(complex_g3_t);
+}
+
+/* Goertzel and at most the energy of the frame, plus the FFT detector cost weighted by the share of escalated frames
+* seen since hybrid_init(), all of it until a frame has been seen */
+static uint32_t hybrid_cost_estimate(void)
+{
+	uint32_t goertzel_cost = DTMF_FREQ_AMT * (G_ARRAY_SIZE + 3) + G_ARRAY_SIZE;
+	uint32_t fft_cost = detector_fft.cost_estimate();
+
+	if (frames == 0)
+	{
+		return goertzel_cost + fft_cost;
+	}
+	return goertzel_cost + (uint32_t)(((double)fft_cost * escalated) / frames);
+}
+
+void detector_hybrid_stats(uint32_t *frame_count, uint32_t *escalated_count)
+{
+	*frame_count = frames;
+	*escalated_count = escalated;
+}
+
+const detector_t detector_hybrid = {
+	"HYBRID", 6, 0, 1, 0,
+	hybrid_init,
+	hybrid_process_frame,
+	hybrid_get_tones,
+	hybrid_memory_footprint,
+	hybrid_cost_estimate,
+	NULL
+};
@@ -0,0 +1,18 @@
+/*! \file detector_hybrid.h
+* \brief Counters of the hybrid detector, next to the common interface of detector.h
+*/
+
+#ifndef DETECTOR_HYBRID_H_
+#define DETECTOR_HYBRID_H_
+
+/* Our Headers */
+#include "detector.h"
+
+/*! \fn void detector_hybrid_stats(uint32_t *frames, uint32_t *escalated)
+* \param frames Number of frames analysed by detector_hybrid since its init()
+* \param escalated Number of those frames that needed the FFT
+* \brief Escalation counters of the hybrid detector
+*/
+void detector_hybrid_stats(uint32_t *frames, uint32_t *escalated);
+
+#endif
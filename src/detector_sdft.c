@@ -0,0 +1,156 @@
+/*! \file detector_sdft.c
+* \brief Sliding DFT detector: the magnitudes of sdft.c are valid at every sample, a decision is taken every millisecond
+*
+* The frame is fed in steps of SDFT_DECISION_STRIDE samples and the key reported for the frame is the one decided most
+* often over its steps, if it holds a quarter of them. The decisions lag the signal by about half a window, so a frame
+* that only has the end of a digit in its first 13 ms stays silent, and one half filled by the start of a digit still
+* has more than a quarter of it past the onset. The
+* callback set by detector_sdft_set_callback() is told of each key change as soon as it is decided.
+*
+* Fed only by process_frame(), the decisions of a whole frame are taken when it ends, so the callback hears of them up
+* to a frame late. detector_sdft_stream() feeds the frame as the reader fills it instead, and process_frame() then only
+* feeds what the stream has not: the decisions, and the callback, come within a stride of the samples they are taken
+* on, and the key of each frame is the same either way.
+*/
+
+/* C Library Headers */
+#include <string.h>
+
+/* Header */
+#include "detector_sdft.h"
+
+/* Our Headers */
+#include "decoder_gtzl.h"
+
+static sdft_t sdft;
+static sdft_callback_t callback;
+static void *callback_context;
+
+/* Decisions of a frame a key needs to be reported for it */
+#define SDFT_FRAME_DECISIONS (G_ARRAY_SIZE / SDFT_DECISION_STRIDE / 4)
+
+static struct_tone_frequencies tones;
+
+/* Votes of the frame being fed */
+static unsigned char decisions[4][4];
+static unsigned char most;
+static struct_tone_frequencies leading;
+
+/* Frame being fed by detector_sdft_stream(), NULL once process_frame() has taken it, and its samples fed so far */
+static const complex_g3_t *stream_frame;
+static int stream_fed;
+
+static void sdft_vote_reset(void)
+{
+	memset(decisions, 0, sizeof(decisions));
+	most = SDFT_FRAME_DECISIONS - 1;
+	leading.low = G_TONE_NONE;
+	leading.high = G_TONE_NONE;
+}
+
+/* Feeds samples up to each decision and counts the key decided for the vote of the frame */
+static void sdft_feed(const complex_g3_t *samples, int count)
+{
+	int step;
+
+	while (count > 0)
+	{
+		step = SDFT_DECISION_STRIDE - (int)(sdft.sample % SDFT_DECISION_STRIDE);
+		if (step > count)
+		{
+			step = count;
+		}
+		sdft_process(&sdft, samples, step);
+		samples += step;
+		count -= step;
+		if (sdft.sample % SDFT_DECISION_STRIDE != 0 || sdft.key == SDFT_NO_KEY)
+		{
+			continue;
+		}
+		if (++decisions[sdft.tones.low][sdft.tones.high] > most)
+		{
+			most = decisions[sdft.tones.low][sdft.tones.high];
+			leading = sdft.tones;
+		}
+	}
+}
+
+static void sdft_detector_init(void)
+{
+	sdft_init(&sdft, ampl_thrs);
+	sdft_set_callback(&sdft, callback, callback_context);
+	tones.low = G_TONE_NONE;
+	tones.high = G_TONE_NONE;
+	sdft_vote_reset();
+	stream_frame = NULL;
+	stream_fed = 0;
+}
+
+static void sdft_process_frame(complex_g3_t *frame)
+{
+	if (frame != stream_frame)
+	{
+		/* Not streamed: fed whole. Votes left by a streamed frame are from one the main loop dropped. */
+		sdft_vote_reset();
+		stream_fed = 0;
+	}
+	sdft_feed(frame + stream_fed, G_ARRAY_SIZE - stream_fed);
+	tones = leading;
+	sdft_vote_reset();
+	stream_frame = NULL;
+	stream_fed = 0;
+}
+
+static struct_tone_frequencies sdft_get_tones(void)
+{
+	return tones;
+}
+
+static uint32_t sdft_memory_footprint(void)
+{
+	return sizeof(sdft) + sizeof(decisions);
+}
+
+static uint32_t sdft_cost_estimate(void)
+{
+	/* Rotation of the 8 bins and energy at every sample, magnitudes and checks at every decision, seeding one window in
+	* SDFT_RESEED_WINDOWS */
+	return G_ARRAY_SIZE * (4 * DTMF_FREQ_AMT + 2)
+		+ G_ARRAY_SIZE / SDFT_DECISION_STRIDE * (2 * DTMF_FREQ_AMT + 4)
+		+ G_ARRAY_SIZE * (2 * DTMF_FREQ_AMT + 1) / SDFT_RESEED_WINDOWS;
+}
+
+void detector_sdft_stream(const complex_g3_t *frame, int stored)
+{
+	if (frame != stream_frame)
+	{
+		if (stream_fed > 0)
+		{
+			/* The previous frame is not taken by process_frame() yet, the samples of this one must wait for it */
+			return;
+		}
+		stream_frame = frame;
+	}
+	if (stored > stream_fed)
+	{
+		sdft_feed(frame + stream_fed, stored - stream_fed);
+		stream_fed = stored;
+	}
+}
+
+void detector_sdft_set_callback(sdft_callback_t function, void *context)
+{
+	callback = function;
+	callback_context = context;
+	sdft_set_callback(&sdft, function, context);
+}
+
+const detector_t detector_sdft = {
+	"SDFT", 8, 1, 1, 0,
+	sdft_detector_init,
+	sdft_process_frame,
+	sdft_get_tones,
+	sdft_memory_footprint,
+	sdft_cost_estimate,
+	NULL
+};
@@ -0,0 +1,28 @@
+/*! \file detector_sdft.h
+* \brief Key change callback and streaming of the sliding DFT detector, next to the common interface of detector.h
+*/
+
+#ifndef DETECTOR_SDFT_H_
+#define DETECTOR_SDFT_H_
+
+/* Our Headers */
+#include "detector.h"
+#include "sdft.h"
+
+/*! \fn void detector_sdft_stream(const complex_g3_t *frame, int stored)
+* \param frame Frame being read, which process_frame() is later called with
+* \param stored Samples of it stored so far
+* \brief Feeds the samples stored since the last call, deciding on them now instead of in process_frame().
+*
+* Samples of the next frame are ignored until process_frame() has taken the previous one, they are fed by a later call.
+*/
+void detector_sdft_stream(const complex_g3_t *frame, int stored);
+
+/*! \fn void detector_sdft_set_callback(sdft_callback_t function, void *context)
+* \param function Called from detector_sdft_stream() or process_frame() of detector_sdft on each key change, NULL for none
+* \param context Passed to the function
+* \brief Kept across init(), so it can be set once at boot
+*/
+void detector_sdft_set_callback(sdft_callback_t function, void *context);
+
+#endif
@@ -0,0 +1,59 @@
+/*! \file digit_log.c
+* \brief Functions for digit_log.h
+*/
+
+/* Header */
+#include "digit_log.h"
+
+#define DIGIT_LOG_MASK (G_SEQUENCE_LENGTH - 1)
+
+void digit_log_init(digit_log_t *log)
+{
+	log->first = 0;
+	log->end = 0;
+	log->length = 0;
+	log->dropped = 0;
+}
+
+void digit_log_append(digit_log_t *log, char digit)
+{
+	log->digits[log->end & DIGIT_LOG_MASK] = digit;
+	log->end++;
+	if (log->length == G_SEQUENCE_LENGTH)
+	{
+		/* The new digit took the slot of the oldest one */
+		log->first++;
+		log->dropped++;
+	}
+	else
+	{
+		log->length++;
+	}
+}
+
+uint32_t digit_log_window(const digit_log_t *log, uint32_t end, uint32_t width, char *text)
+{
+	uint32_t count, i;
+
+	/* Signed differences keep the clamping right across a wrap of the positions */
+	if ((int32_t)(end - log->end) > 0)
+	{
+		end = log->end;
+	}
+	if ((int32_t)(end - log->first) < 0)
+	{
+		end = log->first;
+	}
+
+	count = end - log->first;
+	if (count > width)
+	{
+		count = width;
+	}
+	for (i = 0; i < count; i++)
+	{
+		text[i] = log->digits[(end - count + i) & DIGIT_LOG_MASK];
+	}
+	text[count] = '\0';
+	return count;
+}
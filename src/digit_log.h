@@ -0,0 +1,76 @@
+/*! \file digit_log.h
+* \brief Ring buffer of the decoded digits, read by the display through a window
+*
+* The log keeps the last G_SEQUENCE_LENGTH digits. Appending is constant time and never fails: when the buffer is
+* full the oldest digit ages out and the drop counter goes up, so decoding never stops to empty the sequence.
+*
+* Positions are absolute: digit number 0 is the first one appended since digit_log_init(), and a position keeps
+* naming the same digit while newer ones arrive. The retained digits are the positions from digit_log_first() up to,
+* not including, digit_log_end(). The display keeps the end of its window as a position, so a scrolled view does not
+* move when digits are appended.
+*/
+
+#ifndef DIGIT_LOG_H_
+#define DIGIT_LOG_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+
+#if (G_SEQUENCE_LENGTH & (G_SEQUENCE_LENGTH - 1)) != 0
+#error "G_SEQUENCE_LENGTH must be a power of two"
+#endif
+
+/*! \typedef digit_log_t
+* \brief The log and its indices
+*/
+typedef struct digit_log_t
+{
+	char digits[G_SEQUENCE_LENGTH];	/*!< Ring storage, position p is at digits[p % G_SEQUENCE_LENGTH] */
+	uint32_t first;	/*!< Position of the oldest retained digit, the read index */
+	uint32_t end;	/*!< Position the next digit will take, the write index */
+	uint32_t length;	/*!< Number of retained digits, end - first */
+	uint32_t dropped;	/*!< Digits aged out because the log was full */
+} digit_log_t;
+
+/*! \fn void digit_log_init(digit_log_t *log)
+* \param log The log to empty, positions and drop counter restart from 0
+*/
+void digit_log_init(digit_log_t *log);
+
+/*! \fn void digit_log_append(digit_log_t *log, char digit)
+* \param log The log
+* \param digit Digit to store at position digit_log_end()
+* \brief Appends a digit in constant time, dropping the oldest one if the log is full
+*/
+void digit_log_append(digit_log_t *log, char digit);
+
+/*! \fn uint32_t digit_log_window(const digit_log_t *log, uint32_t end, uint32_t width, char *text)
+* \param log The log
+* \param end Position just after the last digit of the window, clamped to the retained digits
+* \param width Largest number of digits to copy
+* \param text Filled with the digits and a terminating '\0', width + 1 chars
+* \returns The number of digits copied
+* \brief Copies the up to width retained digits that end at position end
+*/
+uint32_t digit_log_window(const digit_log_t *log, uint32_t end, uint32_t width, char *text);
+
+/*! \fn uint32_t digit_log_first(const digit_log_t *log)
+* \returns The position of the oldest retained digit
+*/
+static __inline uint32_t digit_log_first(const digit_log_t *log)
+{
+	return log->first;
+}
+
+/*! \fn uint32_t digit_log_end(const digit_log_t *log)
+* \returns The position after the newest digit
+*/
+static __inline uint32_t digit_log_end(const digit_log_t *log)
+{
+	return log->end;
+}
+
+#endif // DIGIT_LOG_H_
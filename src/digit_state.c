@@ -0,0 +1,145 @@
+/*! \file digit_state.c
+* \brief Functions for digit_state.h
+*/
+
+/* Header */
+#include "digit_state.h"
+
+void digit_state_default_config(digit_state_config_t *config)
+{
+	config->min_on = DIGIT_STATE_MIN_ON_FRAMES;
+	config->min_off = DIGIT_STATE_MIN_OFF_FRAMES;
+	config->hysteresis = DIGIT_STATE_HYSTERESIS_FRAMES;
+	config->step = G_ARRAY_SIZE;
+}
+
+void digit_state_init(digit_state_t *state, const digit_state_config_t *config)
+{
+	state->config = *config;
+	state->phase = DIGIT_IDLE;
+	state->key = DIGIT_STATE_NO_KEY;
+	state->now = 0;
+	state->on = 0;
+	/* The input is considered silent before the first frame, so a tone at power-on is accepted */
+	state->off = config->min_off;
+	state->digit.type = DIGIT_EVENT_NONE;
+	state->digit.key = DIGIT_STATE_NO_KEY;
+	state->digit.start = 0;
+	state->digit.end = 0;
+}
+
+static int digit_state_present(digit_state_t *state, digit_event_t *event);
+
+/* Starts tracking a key seen in the frame starting at now, off frames after the last frame of the previous digit */
+static int digit_state_candidate(digit_state_t *state, char key, uint32_t now, digit_event_t *event)
+{
+	state->phase = DIGIT_CANDIDATE;
+	state->key = key;
+	state->on = 0;
+	state->digit.key = key;
+	state->digit.start = now;
+	return digit_state_present(state, event);
+}
+
+/* The tracked key is present for one more frame: it is confirmed once seen in min_on frames, and min_off frames after
+ * the previous digit, the frames of the candidate before this one counting as part of the pause */
+static int digit_state_present(digit_state_t *state, digit_event_t *event)
+{
+	state->on++;
+	if (state->on < state->config.min_on || state->off + state->on - 1 < state->config.min_off)
+	{
+		return 0;
+	}
+
+	state->phase = DIGIT_CONFIRMED;
+	*event = state->digit;
+	event->type = DIGIT_EVENT_PRESS;
+	return 1;
+}
+
+/* Ends the confirmed digit after off frames without it */
+static int digit_state_end(digit_state_t *state, uint32_t off, digit_event_t *event)
+{
+	state->phase = DIGIT_IDLE;
+	state->key = DIGIT_STATE_NO_KEY;
+	state->off = off;
+	*event = state->digit;
+	event->type = DIGIT_EVENT_RELEASE;
+	return 1;
+}
+
+int digit_state_update(digit_state_t *state, char key, digit_event_t *events)
+{
+	uint32_t now = state->now;
+	int count;
+
+	state->now += state->config.step;
+
+	switch (state->phase)
+	{
+	case DIGIT_IDLE:
+		if (key != DIGIT_STATE_NO_KEY)
+		{
+			/* Also when the pause is still too short: digit_state_present() holds the key back until it is over */
+			return digit_state_candidate(state, key, now, events);
+		}
+		/* Only compared with min_off, so it stops there instead of wrapping on a line silent for years */
+		if (state->off < state->config.min_off)
+		{
+			state->off++;
+		}
+		return 0;
+
+	case DIGIT_CANDIDATE:
+		if (key == state->key)
+		{
+			return digit_state_present(state, events);
+		}
+		if (key != DIGIT_STATE_NO_KEY)
+		{
+			/* A different key straight after: nothing was confirmed, keep validating the new one */
+			return digit_state_candidate(state, key, now, events);
+		}
+		/* Not long enough to be a digit: its frames and this one go on counting toward the pause */
+		state->phase = DIGIT_IDLE;
+		state->key = DIGIT_STATE_NO_KEY;
+		state->off += state->on + 1;
+		if (state->off > state->config.min_off)
+		{
+			state->off = state->config.min_off;
+		}
+		return 0;
+
+	case DIGIT_CONFIRMED:
+		if (key == state->key)
+		{
+			return 0;
+		}
+		state->digit.end = now;
+		state->phase = DIGIT_RELEASE;
+		state->off = 0;
+		/* Falls through - this is the first frame without the key */
+
+	case DIGIT_RELEASE:
+		if (key == state->key)
+		{
+			/* Short break inside the digit */
+			state->phase = DIGIT_CONFIRMED;
+			return 0;
+		}
+		if (key != DIGIT_STATE_NO_KEY)
+		{
+			/* Another key ends the digit, its frames count toward the pause before it can be confirmed */
+			count = digit_state_end(state, state->off, &events[0]);
+			return count + digit_state_candidate(state, key, now, &events[count]);
+		}
+		state->off++;
+		if (state->off > state->config.hysteresis)
+		{
+			return digit_state_end(state, state->off, events);
+		}
+		return 0;
+	}
+
+	return 0;
+}
@@ -0,0 +1,118 @@
+/*! \file digit_state.h
+* \brief Frame to frame digit state machine: validates tone duration and pauses before a key becomes a digit
+*
+* Each frame the detector reports one key or none. A key has to be seen in min_on consecutive frames before it is
+* confirmed as a digit, so a single noisy frame cannot produce one. Once confirmed, up to hysteresis frames without
+* the key are bridged and the digit goes on. A longer absence ends the digit. The next digit is only confirmed min_off
+* frames after the last frame of the previous one. The frames of the next key count toward that pause, as a frame of
+* 64 ms holding the tail of one tone often holds the head of the next one too: a key that comes back early, the same
+* or a different one, is held back until min_off frames have gone by and then confirmed if it is still there.
+*
+* The timings are counted in frames, the unit the detectors resolve: with the defaults a digit needs a tone in two
+* frames in a row, about 100 ms, and the same key twice needs a pause of two frames. The start and end of a digit are
+* given in samples, from the step between frames. Each channel has its own digit_state_t.
+*/
+
+#ifndef DIGIT_STATE_H_
+#define DIGIT_STATE_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+
+/*! \def DIGIT_STATE_NO_KEY
+* \brief Key passed for a frame without a valid DTMF tone pair
+*/
+#define DIGIT_STATE_NO_KEY 'N'
+
+/*! \def DIGIT_STATE_MAX_EVENTS
+* \brief Most events one frame can produce: the release of a digit and the press of the key that replaces it
+*/
+#define DIGIT_STATE_MAX_EVENTS 2
+
+/* Default timings in frames: a key in two frames in a row is a digit, a single missed frame is bridged, and the next
+ * digit comes at least one frame after the previous one */
+#define DIGIT_STATE_MIN_ON_FRAMES 2
+#define DIGIT_STATE_MIN_OFF_FRAMES 1
+#define DIGIT_STATE_HYSTERESIS_FRAMES 1
+
+/*! \typedef digit_phase_t
+* \brief Phases of the state machine
+*/
+typedef enum digit_phase_t
+{
+	DIGIT_IDLE,	/*!< No digit, the pause before the next one is validated */
+	DIGIT_CANDIDATE,	/*!< A key is present but not confirmed yet */
+	DIGIT_CONFIRMED,	/*!< The digit has been reported and the key is still present */
+	DIGIT_RELEASE	/*!< The key is gone: within the hysteresis the digit can resume, then the pause is validated */
+} digit_phase_t;
+
+/*! \typedef digit_event_type_t
+* \brief Events reported by digit_state_update()
+*/
+typedef enum digit_event_type_t
+{
+	DIGIT_EVENT_NONE,	/*!< Nothing to report */
+	DIGIT_EVENT_PRESS,	/*!< A digit has been confirmed, the end time is not known yet */
+	DIGIT_EVENT_RELEASE	/*!< A confirmed digit has ended */
+} digit_event_type_t;
+
+/*! \typedef digit_event_t
+* \brief A digit with its timestamps, in samples since digit_state_init()
+*/
+typedef struct digit_event_t
+{
+	digit_event_type_t type;	/*!< Kind of event */
+	char key;	/*!< Key of the digit */
+	uint32_t start;	/*!< First sample of the first frame the key was seen in */
+	uint32_t end;	/*!< First sample of the first frame without the key, for DIGIT_EVENT_RELEASE */
+} digit_event_t;
+
+/*! \typedef digit_state_config_t
+* \brief Timings of the state machine, in frames
+*/
+typedef struct digit_state_config_t
+{
+	uint32_t min_on;	/*!< Consecutive frames with the key needed to confirm a digit, at least 1 */
+	uint32_t min_off;	/*!< Frames from the last frame of a digit to the frame confirming the next one */
+	uint32_t hysteresis;	/*!< Frames without the key bridged inside a confirmed digit */
+	uint32_t step;	/*!< Samples between the starts of two consecutive frames, for the timestamps */
+} digit_state_config_t;
+
+/*! \typedef digit_state_t
+* \brief State of one channel
+*/
+typedef struct digit_state_t
+{
+	digit_state_config_t config;	/*!< Timings in use */
+	digit_phase_t phase;	/*!< Current phase */
+	char key;	/*!< Key being tracked, DIGIT_STATE_NO_KEY in DIGIT_IDLE */
+	uint32_t now;	/*!< First sample of the next frame */
+	uint32_t on;	/*!< Frames the key has been present, in DIGIT_CANDIDATE */
+	uint32_t off;	/*!< Frames without the key in DIGIT_RELEASE and DIGIT_IDLE, before it in DIGIT_CANDIDATE */
+	digit_event_t digit;	/*!< Digit being tracked, start and end filled as they become known */
+} digit_state_t;
+
+/*! \fn void digit_state_default_config(digit_state_config_t *config)
+* \param config Filled with the default timings and a step of G_ARRAY_SIZE
+*/
+void digit_state_default_config(digit_state_config_t *config);
+
+/*! \fn void digit_state_init(digit_state_t *state, const digit_state_config_t *config)
+* \param state State to reset, its clock starts at 0
+* \param config Timings to use, copied
+*/
+void digit_state_init(digit_state_t *state, const digit_state_config_t *config);
+
+/*! \fn int digit_state_update(digit_state_t *state, char key, digit_event_t *events)
+* \param state State of the channel
+* \param key Key found in the frame, or DIGIT_STATE_NO_KEY
+* \param events Array of DIGIT_STATE_MAX_EVENTS entries, filled with the events of this frame in time order
+* \returns The number of events reported
+* \brief Advances the state machine by one frame
+*/
+int digit_state_update(digit_state_t *state, char key, digit_event_t *events);
+
+#endif
@@ -0,0 +1,30 @@
+/*! \file dtmf_table.c
+* \brief Functions for dtmf_table.h
+*/
+
+/* Header */
+#include "dtmf_table.h"
+
+const char dtmf_key_table[DTMF_GROUP_TONES][DTMF_GROUP_TONES] = {
+	{'1', '2', '3', 'A'},
+	{'4', '5', '6', 'B'},
+	{'7', '8', '9', 'C'},
+	{'*', '0', '#', 'D'}
+};
+
+const int dtmf_low_freqs[DTMF_GROUP_TONES] = {697, 770, 852, 941};
+const int dtmf_high_freqs[DTMF_GROUP_TONES] = {1209, 1336, 1477, 1633};
+
+int dtmf_key_index(char key)
+{
+	int i;
+
+	for (i = 0; i < DTMF_GROUP_TONES * DTMF_GROUP_TONES; i++)
+	{
+		if (dtmf_key_table[i / DTMF_GROUP_TONES][i % DTMF_GROUP_TONES] == key)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
@@ -0,0 +1,41 @@
+/*! \file dtmf_table.h
+* \brief The DTMF keypad: its keys and the frequencies of its rows and columns
+*
+* The detectors report a key as the index of its low group tone, the row, and of its high group tone, the column
+* (struct_tone_frequencies), and the generators go the other way. Every module maps between the two with these
+* tables, so the keypad is written down once.
+*/
+
+#ifndef DTMF_TABLE_H_
+#define DTMF_TABLE_H_
+
+/* Our Headers */
+#include "global_parameters.h"
+
+/*! \def DTMF_GROUP_TONES
+* \brief Tones of each group, rows and columns of the keypad
+*/
+#define DTMF_GROUP_TONES 4
+
+/*! \var dtmf_key_table
+* \brief Key of row r (low tone index) and column c (high tone index) at dtmf_key_table[r][c]
+*/
+extern const char dtmf_key_table[DTMF_GROUP_TONES][DTMF_GROUP_TONES];
+
+/*! \var dtmf_low_freqs
+* \brief Frequencies of the low group tones, in Hz, by row
+*/
+extern const int dtmf_low_freqs[DTMF_GROUP_TONES];
+
+/*! \var dtmf_high_freqs
+* \brief Frequencies of the high group tones, in Hz, by column
+*/
+extern const int dtmf_high_freqs[DTMF_GROUP_TONES];
+
+/*! \fn int dtmf_key_index(char key)
+* \param key Any of 0-9, *, #, A-D
+* \returns row * DTMF_GROUP_TONES + column of the key, or -1 for any other character
+*/
+int dtmf_key_index(char key);
+
+#endif
@@ -2,37 +2,225 @@
 * \brief Functions for eeprom_g3.h
 */
 
+#include <stddef.h>
+#include <string.h>
+
 #include "eeprom_g3.h"
-#include "lpc_types.h"
-#include "eeprom.h"
 
-/**
- * \brief Writes a value to the EEPROM
- * \param value The value to be written to the EEPROM
- * \returns void
- * 
- * This function simplifies writing to EEPROM, it takes an integer value and before writing Erases the EEPROM page we are writing to.
- * Then it writes to a predefined page and address in EEPROM.
- */
-void write_eeprom_g3 (int value)
+/* Record layout: magic (2), version (1), payload length (1), sequence (4), payload, CRC-16 of everything before it (2) */
+#define EEPROM_G3_HEADER_SIZE 8
+#define EEPROM_G3_PAYLOAD_SIZE 25
+#define EEPROM_G3_RECORD_SIZE (EEPROM_G3_HEADER_SIZE + EEPROM_G3_PAYLOAD_SIZE + 2)
+
+/* Algorithm byte of the format used before the versioned record */
+#define EEPROM_G3_LEGACY_FFT 2
+#define EEPROM_G3_LEGACY_GTZL 3
+
+static const eeprom_g3_backend_t *backend = NULL;	/* Set by eeprom_g3_init() */
+
+/* Position and contents of the newest record in the ring, to pick the next page and to skip identical writes */
+static int have_current = 0;
+static uint16_t current_page = EEPROM_G3_FIRST_PAGE;
+static uint32_t current_sequence = 0;
+static uint8_t current_payload[EEPROM_G3_PAYLOAD_SIZE];
+
+/* CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF), bitwise since it only runs at boot and on a write */
+static uint16_t crc16_g3(const uint8_t *data, uint32_t count)
+{
+	uint16_t crc = 0xFFFF;
+	uint32_t i;
+	int bit;
+
+	for (i = 0; i < count; i++)
+	{
+		crc ^= (uint16_t)data[i] << 8;
+		for (bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+		}
+	}
+	return crc;
+}
+
+static uint8_t *put16(uint8_t *p, uint16_t v)
 {
-	uint8_t data = value & 0xFF;	/* Ensure the value is within 8-bit range */
+	p[0] = (uint8_t)(v & 0xFF);
+	p[1] = (uint8_t)(v >> 8);
+	return p + 2;
+}
 
-	EEPROM_Erase(0);
-	EEPROM_Write(0, 0, &data, MODE_8_BIT, 1);
+static uint8_t *put32(uint8_t *p, uint32_t v)
+{
+	p[0] = (uint8_t)(v & 0xFF);
+	p[1] = (uint8_t)((v >> 8) & 0xFF);
+	p[2] = (uint8_t)((v >> 16) & 0xFF);
+	p[3] = (uint8_t)(v >> 24);
+	return p + 4;
 }
 
-/**
- * \brief Reads a value from the EEPROM
- * \returns The value read from the EEPROM
- * 
- * This function also simplifies reading from EEPROM as it just reads the value we care about from a predefined page and address in EEPROM.
- */
-int read_eeprom_g3 (void)
+static uint8_t *putf(uint8_t *p, float v)
 {
-    uint8_t data;
+	uint32_t bits;
+
+	memcpy(&bits, &v, sizeof(bits));
+	return put32(p, bits);
+}
+
+static const uint8_t *get16(const uint8_t *p, uint16_t *v)
+{
+	*v = (uint16_t)(p[0] | (p[1] << 8));
+	return p + 2;
+}
+
+static const uint8_t *get32(const uint8_t *p, uint32_t *v)
+{
+	*v = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+	return p + 4;
+}
+
+static const uint8_t *getf(const uint8_t *p, float *v)
+{
+	uint32_t bits;
+
+	p = get32(p, &bits);
+	memcpy(v, &bits, sizeof(bits));
+	return p;
+}
+
+static void serialise_payload(const config_g3_t *config, uint8_t *p)
+{
+	*p++ = config->algorithm;
+	p = put16(p, config->dc_offset);
+	p = putf(p, config->scale);
+	p = putf(p, config->gtzl_threshold);
+	p = putf(p, config->fft_threshold_low);
+	p = putf(p, config->fft_threshold_high);
+	p = put16(p, config->fft_freq_tolerance);
+	p = put16(p, config->sample_rate);
+	put16(p, config->frame_size);
+}
+
+static void parse_payload(const uint8_t *p, config_g3_t *config)
+{
+	config->algorithm = *p++;
+	p = get16(p, &config->dc_offset);
+	p = getf(p, &config->scale);
+	p = getf(p, &config->gtzl_threshold);
+	p = getf(p, &config->fft_threshold_low);
+	p = getf(p, &config->fft_threshold_high);
+	p = get16(p, &config->fft_freq_tolerance);
+	p = get16(p, &config->sample_rate);
+	get16(p, &config->frame_size);
+}
+
+/* Returns 1 and the sequence number if the page holds a record of this version with a matching CRC */
+static int record_valid(const uint8_t *record, uint32_t *sequence)
+{
+	uint16_t magic, crc;
+
+	get16(record, &magic);
+	if (magic != EEPROM_G3_MAGIC || record[2] != EEPROM_G3_VERSION || record[3] != EEPROM_G3_PAYLOAD_SIZE)
+	{
+		return 0;
+	}
+	get16(record + EEPROM_G3_HEADER_SIZE + EEPROM_G3_PAYLOAD_SIZE, &crc);
+	if (crc != crc16_g3(record, EEPROM_G3_HEADER_SIZE + EEPROM_G3_PAYLOAD_SIZE))
+	{
+		return 0;
+	}
+	get32(record + 4, sequence);
+	return 1;
+}
+
+void eeprom_g3_init(const eeprom_g3_backend_t *storage)
+{
+	backend = storage;
+	have_current = 0;
+}
+
+int write_eeprom_g3(const config_g3_t *config)
+{
+	uint8_t record[EEPROM_G3_RECORD_SIZE];
+	uint8_t *p = record;
+	uint16_t page;
+
+	if (backend == NULL)
+	{
+		return 0;
+	}
+
+	serialise_payload(config, record + EEPROM_G3_HEADER_SIZE);
+
+	if (have_current && memcmp(current_payload, record + EEPROM_G3_HEADER_SIZE, EEPROM_G3_PAYLOAD_SIZE) == 0)
+	{
+		/* Same contents as the newest record: no erase/program cycle spent */
+		return 0;
+	}
+
+	page = have_current ? (uint16_t)(EEPROM_G3_FIRST_PAGE + ((current_page - EEPROM_G3_FIRST_PAGE + 1) % EEPROM_G3_PAGES))
+		: (uint16_t)EEPROM_G3_FIRST_PAGE;
+
+	p = put16(p, EEPROM_G3_MAGIC);
+	*p++ = EEPROM_G3_VERSION;
+	*p++ = EEPROM_G3_PAYLOAD_SIZE;
+	put32(p, current_sequence + 1);
+	put16(record + EEPROM_G3_HEADER_SIZE + EEPROM_G3_PAYLOAD_SIZE,
+		crc16_g3(record, EEPROM_G3_HEADER_SIZE + EEPROM_G3_PAYLOAD_SIZE));
+
+	backend->write(page, record, EEPROM_G3_RECORD_SIZE);
+
+	have_current = 1;
+	current_page = page;
+	current_sequence++;
+	memcpy(current_payload, record + EEPROM_G3_HEADER_SIZE, EEPROM_G3_PAYLOAD_SIZE);
+
+	return 1;
+}
+
+int read_eeprom_g3(config_g3_t *config)
+{
+	uint8_t record[EEPROM_G3_RECORD_SIZE];
+	uint32_t sequence;
+	uint16_t page;
+
+	have_current = 0;
+	current_sequence = 0;
+
+	if (backend == NULL)
+	{
+		config_g3_defaults(config, 0);
+		return 0;
+	}
+
+	for (page = EEPROM_G3_FIRST_PAGE; page < EEPROM_G3_FIRST_PAGE + EEPROM_G3_PAGES; page++)
+	{
+		backend->read(page, record, EEPROM_G3_RECORD_SIZE);
+
+		/* The signed difference keeps the comparison right across a wrap of the sequence counter */
+		if (record_valid(record, &sequence) && (!have_current || (int32_t)(sequence - current_sequence) > 0))
+		{
+			have_current = 1;
+			current_page = page;
+			current_sequence = sequence;
+			memcpy(current_payload, record + EEPROM_G3_HEADER_SIZE, EEPROM_G3_PAYLOAD_SIZE);
+		}
+	}
 
-    EEPROM_Read(0, 0, &data, MODE_8_BIT, 1);	/* Reading from page offset 0, page address 0 */
+	if (have_current)
+	{
+		parse_payload(current_payload, config);
+		return 1;
+	}
 
-    return data;	/* Return the read value */
+	/* No record: keep the algorithm chosen with the previous single byte format, if any */
+	backend->read(EEPROM_G3_FIRST_PAGE, record, 1);
+	if (record[0] == EEPROM_G3_LEGACY_FFT || record[0] == EEPROM_G3_LEGACY_GTZL)
+	{
+		config_g3_defaults(config, record[0]);
+	}
+	else
+	{
+		config_g3_defaults(config, 0);
+	}
+	return 0;
 }
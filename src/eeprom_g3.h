@@ -1,28 +1,66 @@
 /*! \file eeprom_g3.h
-* \brief Custom interface for communicating with the board's EEPROM 
-* This was adpated from NXP MCU SW Application Team's EEPROM firmware library this firmware library was adapted 
+* \brief Custom interface for communicating with the board's EEPROM
+* This was adpated from NXP MCU SW Application Team's EEPROM firmware library this firmware library was adapted
 * slightly to work with the given LPC_4088 board and the custom interface was created to simplify the usage.
+*
+* The configuration is kept as a versioned record protected by a CRC. Successive writes rotate over
+* EEPROM_G3_PAGES pages to spread the wear, each record carrying a sequence number so that the newest valid one
+* wins at read time. A write is skipped when the record is unchanged. The page storage itself goes through a
+* backend, the LPC4088 EEPROM on the board or a file on the host build.
 */
 
 #ifndef __EEPROM3_H_
 #define __EEPROM3_H_
 
+#include <platform.h>
+#include "config_g3.h"
+
+#define EEPROM_G3_PAGE_SIZE 64	/* Bytes per EEPROM page */
+#define EEPROM_G3_FIRST_PAGE 0	/* First page of the wear levelling ring */
+#define EEPROM_G3_PAGES 8	/* Number of pages in the wear levelling ring */
+
+#define EEPROM_G3_MAGIC 0x4733	/* "G3" */
+#define EEPROM_G3_VERSION 1
+
+/*! \typedef eeprom_g3_backend_t
+* \brief Page storage used by the configuration record
+*/
+typedef struct eeprom_g3_backend_t
+{
+	void (*read)(uint16_t page, uint8_t *data, uint32_t count);	/*!< Reads \p count bytes from the start of a page */
+	void (*write)(uint16_t page, const uint8_t *data, uint32_t count);	/*!< Programs \p count bytes at the start of a page */
+} eeprom_g3_backend_t;
+
+/*! \var eeprom_g3_lpc_backend
+* \brief Backend using the on-chip EEPROM of the LPC4088
+*/
+extern const eeprom_g3_backend_t eeprom_g3_lpc_backend;
+
 /**
- * \brief Writes a value to the EEPROM
- * \param value The value to be written to the EEPROM
+ * \brief Selects the page storage
+ * \param backend Backend to use for every following read and write
  * \returns void
- * 
- * This function simplifies writing to EEPROM, it takes an integer value and before writing Erases the EEPROM page we are writing to.
- * Then it writes to a predefined page and address in EEPROM.
  */
-void write_eeprom_g3(int value);
+void eeprom_g3_init(const eeprom_g3_backend_t *backend);
+
+/**
+ * \brief Writes the configuration record to the EEPROM
+ * \param config The record to be written
+ * \returns 1 if the record was written, 0 if it was identical to the stored one and nothing was programmed
+ *
+ * The record goes to the page after the current one in the ring, with the next sequence number, in a single page
+ * program operation.
+ */
+int write_eeprom_g3(const config_g3_t *config);
 
 /**
- * \brief Reads a value from the EEPROM
- * \returns The value read from the EEPROM
- * 
- * This function also simplifies reading from EEPROM as it just reads the value we care about from a predefined page and address in EEPROM.
+ * \brief Reads the configuration record from the EEPROM
+ * \param config Filled with the newest valid record
+ * \returns 1 if a valid record was found, 0 otherwise
+ *
+ * Pages with a wrong magic, version or CRC are ignored. A board that still carries the single algorithm byte of the
+ * previous format at page 0 gets that algorithm back with default thresholds, and 0 is returned.
  */
-int read_eeprom_g3(void);
+int read_eeprom_g3(config_g3_t *config);
 
-#endif 
+#endif
@@ -0,0 +1,20 @@
+/*! \file eeprom_g3_lpc.c
+* \brief EEPROM backend of eeprom_g3.h for the LPC4088 on-chip EEPROM
+*/
+
+#include "eeprom_g3.h"
+#include "lpc_types.h"
+#include "eeprom.h"
+
+static void lpc_read(uint16_t page, uint8_t *data, uint32_t count)
+{
+	EEPROM_Read(0, page, data, MODE_8_BIT, count);	/* Reading from page offset 0 */
+}
+
+/* EEPROM_Write() fills the page register and runs one erase/program of the page, no separate EEPROM_Erase() is needed */
+static void lpc_write(uint16_t page, const uint8_t *data, uint32_t count)
+{
+	EEPROM_Write(0, page, (void *)data, MODE_8_BIT, count);
+}
+
+const eeprom_g3_backend_t eeprom_g3_lpc_backend = {lpc_read, lpc_write};
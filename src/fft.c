@@ -6,111 +6,247 @@
 /* Header */
 #include "fft.h"
 
-complex_g3_t out[NN];	/* Output array for FFT results */
-complex_g3_t scratch[NN];	/* Scratch space for FFT computation */
-complex_g3_t twiddles[NN];	/* Twiddle factors */
+/* Hann and Blackman tables of 128 and 256 points, in flash */
+#include "fft_windows.h"
+
+/* Twiddle factors and bit-reversal permutation for every size up to NN, in flash */
+#include "fft_tables.h"
+
+#if FFT_TABLES_SIZE != NN
+	#error "fft_tables.h does not match G_ARRAY_SIZE, run python3 tools/gen_fft_tables.py"
+#endif
+
+complex_g3_t out[NN];	/* Output array for FFT results, the transform is computed in place in it */
+
+static double power[NN / 2];	/* Averaged power spectrum of FFT_power() */
 
 /**
- * \brief Calculates the twiddle factors for the FFT
- * \param N The number of samples in the FFT, which should be a power of two
+ * \brief Performs the butterflies of the FFT in place
+ * \param X Pointer to N complex numbers in bit-reversed order, replaced by their spectrum
+ * \param N The number of samples in the array, a power of two up to NN
  * \returns void
  * 
- * This function calculates the twiddle factors, which are complex exponentials used to 
- * reduce the number of computations in the Fast Fourier Transform (FFT). These factors 
- * are needed to efficiently combine the DFT results of subproblems in the FFT algorithm.
+ * Radix-2 decimation in time: each of the log2(N) stages combines pairs of DFTs of half the size with the twiddle factors 
+ * W_size^k, read as every (NN / size)th entry of the table of NN points.
 */
-void FFT_get_twiddle_factors (int N)
+static void FFT_butterflies (complex_g3_t *X, int N)
 {
-	int k;
+	int size, half, stride, start, k;
+	double tre, tim, dre, dim;
+	complex_g3_t *E, *D;
 
-	for (k = 0; k < N; ++k)
+	for (size = 2; size <= N; size <<= 1)
 	{
-		double angle = -2.0 * G_PI * k / N;
+		half = size >> 1;
+		stride = NN / size;
+
+		for (k = 0; k < half; k++)
+		{
+			tre = FFT_TWIDDLES[k * stride].re;
+			tim = FFT_TWIDDLES[k * stride].im;
 
-		twiddles[k].re = cos(angle);
-		twiddles[k].im = sin(angle);
+			for (start = k; start < N; start += size)
+			{
+				E = X + start;
+				D = E + half;
+				dre = D->re * tre - D->im * tim;
+				dim = D->re * tim + D->im * tre;
+
+				D->re = E->re - dre;
+				D->im = E->im - dim;
+				E->re += dre;
+				E->im += dim;
+			}
+		}
 	}
 }
 
+/**
+ * \brief Shift of the bit-reversal table entries for an N point FFT
+ * \param N The number of samples, a power of two up to NN
+ * \returns log2(NN / N)
+*/
+static int FFT_reverse_shift (int N)
+{
+	int shift = 0;
+
+	for (; N < NN; N <<= 1)
+	{
+		shift++;
+	}
+	return shift;
+}
 
 /**
  * \brief Performs the actual FFT on an array of complex numbers
  * \param x Pointer to a complex array of input data
+ * \param N The number of samples in the array, should be a power of two up to NN
+ * \param X Output pointer to an array where the frequency spectrum of the input signal will be stored, distinct from x
+ * \returns void
+ * 
+ * The input is copied to X in bit-reversed order and the butterflies run in place in X, so the only RAM used is the 
+ * output; the twiddle factors and the permutation are read from the tables of fft_tables.h.
+*/
+void FFT_calculate (const complex_g3_t *x, int N, complex_g3_t *X)
+{
+	int shift = FFT_reverse_shift(N);
+	int i;
+
+	for (i = 0; i < N; i++)
+	{
+		X[FFT_BIT_REVERSE[i] >> shift] = x[i];
+	}
+	FFT_butterflies(X, N);
+}
+
+/**
+ * \brief Simplified interface to perform FFT on a complex array of voltage levels
+ * \param x Pointer to a complex array of voltage levels
  * \param N The number of samples in the array, should be a power of two
- * \param X Output pointer to an array where the frequency spectrum of the input signal will be stored
- * \param scratch Scratch space used for intermediate calculations
- * \param twiddles Twiddle factors precomputed for the FFT size N
- * \returns A pointer to an array of complex numbers representing the frequency spectrum of the input signal
+ * \returns A pointer to a global array representing the frequency spectrum of the input signal, note that this is not thread-safe
  * 
- * This function performs the Cooley-Tukey FFT algorithm on a complex data array. It recursively divides the 
- * DFT into smaller DFTs, utilizing symmetry and periodicity properties of the DFT through the use of twiddle factors. 
- * This function uses an in-place algorithm where the results are computed directly in the input arrays using the `scratch` 
- * space for efficient memory usage.
+ * This function provides a simplified interface to perform the FFT, suitable for straightforward use cases. It runs the FFT into a global output array, managing all intermediate storage internally. This is ideal for single-threaded applications where ease of use is more critical than modularity.
+*/
+complex_g3_t* FFT_simple (complex_g3_t* x, int N)
+{
+	FFT_calculate(x, N, out);
+
+	return out;	/* Note: this returns a pointer to a global array */
+}
+
+/**
+ * \brief FFT_simple() of G.711 codes, expanded by the table while they are copied to their bit-reversed place
+ * \param codes Pointer to N G.711 codes
+ * \param table The expansion table of their law, from g711_table()
+ * \param N The number of codes, should be a power of two
+ * \returns A pointer to the same global array as FFT_simple()
 */
-void FFT_calculate (complex_g3_t *x, long N, complex_g3_t *X, complex_g3_t *scratch, complex_g3_t *twiddles)
+complex_g3_t* FFT_simple_g711 (const unsigned char* codes, const float* table, int N)
 {
-	int k, m, n;
-	int skip;
-	boolean evenIteration = N & 0x55555555;
-	complex_g3_t* E;
-	complex_g3_t* Xp, *Xp2, *Xstart;
+	int shift = FFT_reverse_shift(N);
+	int i;
 
-	if (N == 1)
+	for (i = 0; i < N; i++)
 	{
-		X[0] = x[0];
-		return;
+		out[FFT_BIT_REVERSE[i] >> shift].re = table[codes[i]];
+		out[FFT_BIT_REVERSE[i] >> shift].im = 0.0;
 	}
+	FFT_butterflies(out, N);
 
-	E = x;
+	return out;	/* Note: this returns a pointer to a global array */
+}
 
-	for (n = 1; n < N; n = n * 2)
+/**
+ * \brief Looks up the table of a window
+ * \param window A window other than the rectangular one
+ * \param N The number of points
+ * \returns The first N / 2 + 1 samples of the window, or NULL if it was not generated for N points
+*/
+static const float *FFT_window_table (fft_window_t window, int N)
+{
+	switch (N)
+	{
+		case 128:
+			return window == FFT_WINDOW_HANN ? FFT_WINDOW_HANN_128 : FFT_WINDOW_BLACKMAN_128;
+		case 256:
+			return window == FFT_WINDOW_HANN ? FFT_WINDOW_HANN_256 : FFT_WINDOW_BLACKMAN_256;
+		default:
+			return NULL;
+	}
+}
+
+/**
+ * \brief Coherent gain of a window, the mean of its samples
+ * \param window A window
+ * \returns The factor a tone peak is reduced by the window, 1 for the rectangular one
+*/
+double FFT_window_gain (fft_window_t window)
+{
+	switch (window)
 	{
-		Xstart = evenIteration ? scratch : X;
-		skip = N / (2 * n);
-		Xp = Xstart;
-		Xp2 = Xstart + N / 2;
+		case FFT_WINDOW_HANN:
+			return FFT_WINDOW_HANN_GAIN;
+		case FFT_WINDOW_BLACKMAN:
+			return FFT_WINDOW_BLACKMAN_GAIN;
+		default:
+			return 1.0;
+	}
+}
 
-		for (k = 0; k < n; k++)
+/**
+ * \brief Power spectrum of a frame, averaged over its consecutive windowed blocks of N samples
+ * \param x Pointer to a complex array of voltage levels, not read when codes is not NULL
+ * \param codes Pointer to G.711 codes read instead of x, or NULL
+ * \param table The expansion table of the codes
+ * \param length The number of samples in the array, a multiple of N
+ * \param N The number of points of each FFT, a power of two up to NN
+ * \param window The window applied to each block
+ * \returns A pointer to a global array of the N / 2 bin powers |X|^2, or NULL if there is no table of the window for N points
+ *
+ * Averaging the powers rather than keeping one block lets a digit that only fills part of the frame count as much as
+ * with the full size FFT.
+*/
+static double* FFT_power_frame (const complex_g3_t* x, const unsigned char* codes, const float* table, int length, int N,
+	fft_window_t window)
+{
+	const float *window_table = NULL;
+	double scale = (double)N / length;
+	double w;
+	int shift = FFT_reverse_shift(N);
+	int block, i;
+
+	if (window != FFT_WINDOW_RECTANGULAR)
+	{
+		window_table = FFT_window_table(window, N);
+		if (window_table == NULL)
 		{
-			double tim = twiddles[k * skip].im;
-			double tre = twiddles[k * skip].re;
+			return NULL;
+		}
+	}
+
+	for (i = 0; i < N / 2; i++)
+	{
+		power[i] = 0.0;
+	}
 
-			for (m = 0; m < skip; ++m)
+	for (block = 0; block < length; block += N)
+	{
+		/* The windowed block goes straight to its bit-reversed place in out[] */
+		for (i = 0; i < N; i++)
+		{
+			/* The periodic windows are symmetric, w[i] = w[N - i] */
+			w = window_table == NULL ? 1.0 : window_table[i <= N / 2 ? i : N - i];
+			if (codes != NULL)
 			{
-				complex_g3_t* D = E + skip;
-				double dre = D->re * tre - D->im * tim;
-				double dim = D->re * tim + D->im * tre;
-
-				Xp->re = E->re + dre;
-				Xp->im = E->im + dim;
-				Xp2->re = E->re - dre;
-				Xp2->im = E->im - dim;
-
-				++Xp;
-				++Xp2;
-				++E;
+				out[FFT_BIT_REVERSE[i] >> shift].re = table[codes[block + i]] * w;
+				out[FFT_BIT_REVERSE[i] >> shift].im = 0.0;
+			}
+			else
+			{
+				out[FFT_BIT_REVERSE[i] >> shift].re = x[block + i].re * w;
+				out[FFT_BIT_REVERSE[i] >> shift].im = x[block + i].im * w;
 			}
-
-			E += skip;
 		}
+		FFT_butterflies(out, N);
+		for (i = 0; i < N / 2; i++)
+		{
+			power[i] += out[i].re * out[i].re + out[i].im * out[i].im;
+		}
+	}
 
-		E = Xstart;
-		evenIteration = !evenIteration;
+	for (i = 0; i < N / 2; i++)
+	{
+		power[i] *= scale;
 	}
+	return power;	/* Note: this returns a pointer to a global array */
 }
 
-/**
- * \brief Simplified interface to perform FFT on a complex array of voltage levels
- * \param x Pointer to a complex array of voltage levels
- * \param N The number of samples in the array, should be a power of two
- * \returns A pointer to a global array representing the frequency spectrum of the input signal, note that this is not thread-safe
- * 
- * This function provides a simplified interface to perform the FFT, suitable for straightforward use cases. It wraps the operations of computing twiddle factors and executing the FFT into a single call, managing all intermediate storage internally. This is ideal for single-threaded applications where ease of use is more critical than modularity.
-*/
-complex_g3_t* FFT_simple (complex_g3_t* x, int N)
+double* FFT_power (const complex_g3_t* x, int length, int N, fft_window_t window)
 {
-	FFT_get_twiddle_factors(N);
-	FFT_calculate(x, N, out, scratch, twiddles);
+	return FFT_power_frame(x, NULL, NULL, length, N, window);
+}
 
-	return out;	/* Note: this returns a pointer to a global array */
+double* FFT_power_g711 (const unsigned char* codes, const float* table, int length, int N, fft_window_t window)
+{
+	return FFT_power_frame(NULL, codes, table, length, N, window);
 }
@@ -19,14 +19,63 @@
 
 #define NN G_ARRAY_SIZE  // Define the maximum FFT size, must be a power of 2
 
+/**
+ * \brief Windows of FFT_power(), the Hann and Blackman tables are generated by tools/gen_fft_windows.py for 128 and 256 points
+ */
+typedef enum fft_window_t
+{
+	FFT_WINDOW_RECTANGULAR,
+	FFT_WINDOW_HANN,
+	FFT_WINDOW_BLACKMAN
+} fft_window_t;
+
 /**
  * \brief Simplified interface to perform FFT on a complex array of voltage levels
  * \param x Pointer to a complex array of voltage levels
  * \param N The number of samples in the array, should be a power of two
  * \returns A pointer to a global array representing the frequency spectrum of the input signal, note that this is not thread-safe
  * 
- * This function provides a simplified interface to perform the FFT, suitable for straightforward use cases. It wraps the operations of computing twiddle factors and executing the FFT into a single call, managing all intermediate storage internally. This is ideal for single-threaded applications where ease of use is more critical than modularity.
+ * This function provides a simplified interface to perform the FFT, suitable for straightforward use cases. It runs the FFT into a global output array, managing all intermediate storage internally. This is ideal for single-threaded applications where ease of use is more critical than modularity.
 */
 complex_g3_t *FFT_simple(complex_g3_t *x, int N);
 
+/**
+ * \brief FFT_simple() of G.711 codes, each code is expanded by the table as it is copied into the transform
+ * \param codes Pointer to N G.711 codes
+ * \param table The expansion table of their law, from g711_table()
+ * \param N The number of codes, should be a power of two
+ * \returns A pointer to the same global array as FFT_simple()
+*/
+complex_g3_t *FFT_simple_g711(const unsigned char *codes, const float *table, int N);
+
+/**
+ * \brief Power spectrum of a frame, averaged over its consecutive windowed blocks of N samples
+ * \param x Pointer to a complex array of voltage levels
+ * \param length The number of samples in the array, a multiple of N
+ * \param N The number of points of each FFT, a power of two up to NN
+ * \param window The window applied to each block
+ * \returns A pointer to a global array of the N / 2 bin powers |X|^2 up to the Nyquist frequency, or NULL if there is no table of the window for N points
+ *
+ * Every sample of the frame is used, the smaller FFT only trades frequency resolution for cost, which the peak interpolation of decode_dtmf_power() wins back.
+*/
+double *FFT_power(const complex_g3_t *x, int length, int N, fft_window_t window);
+
+/**
+ * \brief FFT_power() of G.711 codes, each code is expanded by the table as its block is windowed
+ * \param codes Pointer to length G.711 codes
+ * \param table The expansion table of their law, from g711_table()
+ * \param length The number of codes, a multiple of N
+ * \param N The number of points of each FFT, a power of two up to NN
+ * \param window The window applied to each block
+ * \returns The same global array as FFT_power(), or NULL if there is no table of the window for N points
+*/
+double *FFT_power_g711(const unsigned char *codes, const float *table, int length, int N, fft_window_t window);
+
+/**
+ * \brief Coherent gain of a window, the mean of its samples
+ * \param window A window
+ * \returns The factor a tone peak is reduced by the window, 1 for the rectangular one
+*/
+double FFT_window_gain(fft_window_t window);
+
 #endif
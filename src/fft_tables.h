@@ -0,0 +1,309 @@
+/*! \file fft_tables.h
+* \brief FFT twiddle factor and bit-reversal tables, generated by tools/gen_fft_tables.py: do not edit
+*
+* Command: python3 tools/gen_fft_tables.py --size 512
+* Only included by fft.c.
+*/
+
+#ifndef FFT_TABLES_H_
+#define FFT_TABLES_H_
+
+#define FFT_TABLES_SIZE 512	/* Largest FFT size, the tables serve every power of two up to it */
+
+/* Twiddle factors e^(-j 2 pi k / FFT_TABLES_SIZE), k = 0 to FFT_TABLES_SIZE / 2 - 1 */
+static const complex_g3_t FFT_TWIDDLES[FFT_TABLES_SIZE / 2] = {
+	{1.0, 0.0},
+	{0.9999247018391445, -0.012271538285719925},
+	{0.9996988186962042, -0.024541228522912288},
+	{0.9993223845883495, -0.03680722294135883},
+	{0.9987954562051724, -0.049067674327418015},
+	{0.9981181129001492, -0.06132073630220858},
+	{0.9972904566786902, -0.07356456359966743},
+	{0.996312612182778, -0.0857973123444399},
+	{0.9951847266721969, -0.0980171403295606},
+	{0.9939069700023561, -0.11022220729388306},
+	{0.99247953459871, -0.1224106751992162},
+	{0.99090263542778, -0.13458070850712617},
+	{0.989176509964781, -0.14673047445536175},
+	{0.9873014181578584, -0.15885814333386145},
+	{0.9852776423889412, -0.17096188876030122},
+	{0.9831054874312163, -0.18303988795514095},
+	{0.9807852804032304, -0.19509032201612825},
+	{0.9783173707196277, -0.20711137619221856},
+	{0.9757021300385286, -0.2191012401568698},
+	{0.9729399522055602, -0.2310581082806711},
+	{0.970031253194544, -0.24298017990326387},
+	{0.9669764710448521, -0.25486565960451457},
+	{0.9637760657954398, -0.26671275747489837},
+	{0.9604305194155658, -0.27851968938505306},
+	{0.9569403357322088, -0.29028467725446233},
+	{0.9533060403541939, -0.3020059493192281},
+	{0.9495281805930367, -0.3136817403988915},
+	{0.9456073253805213, -0.3253102921622629},
+	{0.9415440651830208, -0.33688985339222005},
+	{0.937339011912575, -0.34841868024943456},
+	{0.932992798834739, -0.3598950365349881},
+	{0.9285060804732156, -0.37131719395183754},
+	{0.9238795325112867, -0.3826834323650898},
+	{0.9191138516900578, -0.3939920400610481},
+	{0.9142097557035307, -0.40524131400498986},
+	{0.9091679830905224, -0.41642956009763715},
+	{0.9039892931234433, -0.4275550934302821},
+	{0.8986744656939538, -0.43861623853852766},
+	{0.8932243011955153, -0.44961132965460654},
+	{0.8876396204028539, -0.46053871095824},
+	{0.881921264348355, -0.47139673682599764},
+	{0.8760700941954066, -0.4821837720791227},
+	{0.8700869911087115, -0.49289819222978404},
+	{0.8639728561215868, -0.5035383837257176},
+	{0.8577286100002721, -0.5141027441932217},
+	{0.8513551931052652, -0.524589682678469},
+	{0.8448535652497071, -0.5349976198870972},
+	{0.8382247055548381, -0.5453249884220465},
+	{0.8314696123025452, -0.5555702330196022},
+	{0.8245893027850253, -0.5657318107836131},
+	{0.8175848131515837, -0.5758081914178453},
+	{0.8104571982525948, -0.5857978574564389},
+	{0.8032075314806449, -0.5956993044924334},
+	{0.7958369046088836, -0.6055110414043255},
+	{0.7883464276266063, -0.6152315905806268},
+	{0.7807372285720945, -0.6248594881423863},
+	{0.773010453362737, -0.6343932841636455},
+	{0.765167265622459, -0.6438315428897914},
+	{0.7572088465064846, -0.6531728429537768},
+	{0.7491363945234594, -0.6624157775901718},
+	{0.7409511253549591, -0.6715589548470183},
+	{0.7326542716724128, -0.680600997795453},
+	{0.724247082951467, -0.6895405447370668},
+	{0.7157308252838186, -0.6983762494089729},
+	{0.7071067811865476, -0.7071067811865475},
+	{0.6983762494089729, -0.7157308252838186},
+	{0.6895405447370669, -0.7242470829514669},
+	{0.6806009977954531, -0.7326542716724128},
+	{0.6715589548470183, -0.7409511253549591},
+	{0.6624157775901718, -0.7491363945234593},
+	{0.6531728429537768, -0.7572088465064845},
+	{0.6438315428897915, -0.765167265622459},
+	{0.6343932841636455, -0.773010453362737},
+	{0.6248594881423865, -0.7807372285720944},
+	{0.6152315905806268, -0.7883464276266062},
+	{0.6055110414043255, -0.7958369046088835},
+	{0.5956993044924335, -0.8032075314806448},
+	{0.5857978574564389, -0.8104571982525948},
+	{0.5758081914178453, -0.8175848131515837},
+	{0.5657318107836132, -0.8245893027850253},
+	{0.5555702330196023, -0.8314696123025452},
+	{0.5453249884220465, -0.838224705554838},
+	{0.5349976198870973, -0.844853565249707},
+	{0.5245896826784688, -0.8513551931052652},
+	{0.5141027441932217, -0.8577286100002721},
+	{0.5035383837257176, -0.8639728561215867},
+	{0.4928981922297841, -0.8700869911087113},
+	{0.48218377207912283, -0.8760700941954066},
+	{0.4713967368259978, -0.8819212643483549},
+	{0.46053871095824, -0.8876396204028539},
+	{0.4496113296546066, -0.8932243011955153},
+	{0.4386162385385277, -0.8986744656939538},
+	{0.4275550934302822, -0.9039892931234433},
+	{0.4164295600976373, -0.9091679830905223},
+	{0.40524131400498986, -0.9142097557035307},
+	{0.3939920400610481, -0.9191138516900578},
+	{0.38268343236508984, -0.9238795325112867},
+	{0.3713171939518376, -0.9285060804732155},
+	{0.3598950365349883, -0.9329927988347388},
+	{0.3484186802494345, -0.937339011912575},
+	{0.33688985339222005, -0.9415440651830208},
+	{0.325310292162263, -0.9456073253805213},
+	{0.3136817403988916, -0.9495281805930367},
+	{0.3020059493192282, -0.9533060403541938},
+	{0.29028467725446233, -0.9569403357322089},
+	{0.27851968938505306, -0.9604305194155658},
+	{0.2667127574748984, -0.9637760657954398},
+	{0.2548656596045146, -0.9669764710448521},
+	{0.24298017990326398, -0.970031253194544},
+	{0.23105810828067128, -0.9729399522055601},
+	{0.21910124015686977, -0.9757021300385286},
+	{0.20711137619221856, -0.9783173707196277},
+	{0.19509032201612833, -0.9807852804032304},
+	{0.18303988795514106, -0.9831054874312163},
+	{0.17096188876030136, -0.9852776423889412},
+	{0.1588581433338614, -0.9873014181578584},
+	{0.14673047445536175, -0.989176509964781},
+	{0.13458070850712622, -0.99090263542778},
+	{0.12241067519921628, -0.99247953459871},
+	{0.11022220729388318, -0.9939069700023561},
+	{0.09801714032956077, -0.9951847266721968},
+	{0.08579731234443988, -0.996312612182778},
+	{0.07356456359966745, -0.9972904566786902},
+	{0.06132073630220865, -0.9981181129001492},
+	{0.049067674327418126, -0.9987954562051724},
+	{0.03680722294135899, -0.9993223845883495},
+	{0.024541228522912264, -0.9996988186962042},
+	{0.012271538285719944, -0.9999247018391445},
+	{0.0, -1.0},
+	{-0.012271538285719823, -0.9999247018391445},
+	{-0.024541228522912142, -0.9996988186962042},
+	{-0.036807222941358866, -0.9993223845883495},
+	{-0.04906767432741801, -0.9987954562051724},
+	{-0.06132073630220853, -0.9981181129001492},
+	{-0.07356456359966733, -0.9972904566786902},
+	{-0.08579731234443976, -0.996312612182778},
+	{-0.09801714032956065, -0.9951847266721969},
+	{-0.11022220729388306, -0.9939069700023561},
+	{-0.12241067519921615, -0.99247953459871},
+	{-0.1345807085071261, -0.99090263542778},
+	{-0.14673047445536164, -0.989176509964781},
+	{-0.15885814333386128, -0.9873014181578584},
+	{-0.17096188876030124, -0.9852776423889412},
+	{-0.18303988795514092, -0.9831054874312163},
+	{-0.1950903220161282, -0.9807852804032304},
+	{-0.20711137619221845, -0.9783173707196277},
+	{-0.21910124015686966, -0.9757021300385286},
+	{-0.23105810828067114, -0.9729399522055602},
+	{-0.24298017990326387, -0.970031253194544},
+	{-0.2548656596045145, -0.9669764710448521},
+	{-0.2667127574748983, -0.9637760657954398},
+	{-0.27851968938505295, -0.9604305194155659},
+	{-0.29028467725446216, -0.9569403357322089},
+	{-0.3020059493192281, -0.9533060403541939},
+	{-0.3136817403988914, -0.9495281805930367},
+	{-0.32531029216226287, -0.9456073253805214},
+	{-0.33688985339221994, -0.9415440651830208},
+	{-0.3484186802494344, -0.937339011912575},
+	{-0.35989503653498817, -0.9329927988347388},
+	{-0.3713171939518375, -0.9285060804732156},
+	{-0.3826834323650897, -0.9238795325112867},
+	{-0.393992040061048, -0.9191138516900578},
+	{-0.40524131400498975, -0.9142097557035307},
+	{-0.416429560097637, -0.9091679830905225},
+	{-0.42755509343028186, -0.9039892931234434},
+	{-0.4386162385385274, -0.8986744656939539},
+	{-0.4496113296546067, -0.8932243011955152},
+	{-0.46053871095824006, -0.8876396204028539},
+	{-0.4713967368259977, -0.881921264348355},
+	{-0.4821837720791227, -0.8760700941954066},
+	{-0.492898192229784, -0.8700869911087115},
+	{-0.5035383837257175, -0.8639728561215868},
+	{-0.5141027441932217, -0.8577286100002721},
+	{-0.5245896826784687, -0.8513551931052652},
+	{-0.534997619887097, -0.8448535652497072},
+	{-0.5453249884220462, -0.8382247055548382},
+	{-0.555570233019602, -0.8314696123025455},
+	{-0.5657318107836132, -0.8245893027850252},
+	{-0.5758081914178453, -0.8175848131515837},
+	{-0.5857978574564389, -0.8104571982525948},
+	{-0.5956993044924334, -0.8032075314806449},
+	{-0.6055110414043254, -0.7958369046088836},
+	{-0.6152315905806267, -0.7883464276266063},
+	{-0.6248594881423862, -0.7807372285720946},
+	{-0.6343932841636454, -0.7730104533627371},
+	{-0.6438315428897913, -0.7651672656224591},
+	{-0.6531728429537765, -0.7572088465064847},
+	{-0.6624157775901719, -0.7491363945234593},
+	{-0.6715589548470184, -0.740951125354959},
+	{-0.680600997795453, -0.7326542716724128},
+	{-0.6895405447370669, -0.7242470829514669},
+	{-0.6983762494089728, -0.7157308252838187},
+	{-0.7071067811865475, -0.7071067811865476},
+	{-0.7157308252838186, -0.6983762494089729},
+	{-0.7242470829514668, -0.689540544737067},
+	{-0.7326542716724127, -0.6806009977954532},
+	{-0.7409511253549589, -0.6715589548470186},
+	{-0.7491363945234591, -0.662415777590172},
+	{-0.7572088465064846, -0.6531728429537766},
+	{-0.765167265622459, -0.6438315428897914},
+	{-0.773010453362737, -0.6343932841636455},
+	{-0.7807372285720945, -0.6248594881423863},
+	{-0.7883464276266062, -0.6152315905806269},
+	{-0.7958369046088835, -0.6055110414043257},
+	{-0.8032075314806448, -0.5956993044924335},
+	{-0.8104571982525947, -0.585797857456439},
+	{-0.8175848131515836, -0.5758081914178454},
+	{-0.8245893027850251, -0.5657318107836135},
+	{-0.8314696123025453, -0.5555702330196022},
+	{-0.8382247055548381, -0.5453249884220464},
+	{-0.8448535652497071, -0.5349976198870972},
+	{-0.8513551931052652, -0.524589682678469},
+	{-0.857728610000272, -0.5141027441932218},
+	{-0.8639728561215867, -0.5035383837257177},
+	{-0.8700869911087113, -0.49289819222978415},
+	{-0.8760700941954065, -0.4821837720791229},
+	{-0.8819212643483549, -0.47139673682599786},
+	{-0.8876396204028538, -0.4605387109582402},
+	{-0.8932243011955152, -0.4496113296546069},
+	{-0.8986744656939539, -0.43861623853852755},
+	{-0.9039892931234433, -0.42755509343028203},
+	{-0.9091679830905224, -0.41642956009763715},
+	{-0.9142097557035307, -0.4052413140049899},
+	{-0.9191138516900578, -0.39399204006104815},
+	{-0.9238795325112867, -0.3826834323650899},
+	{-0.9285060804732155, -0.3713171939518377},
+	{-0.9329927988347388, -0.35989503653498833},
+	{-0.9373390119125748, -0.3484186802494348},
+	{-0.9415440651830207, -0.33688985339222033},
+	{-0.9456073253805212, -0.32531029216226326},
+	{-0.9495281805930367, -0.3136817403988914},
+	{-0.9533060403541939, -0.30200594931922803},
+	{-0.9569403357322088, -0.2902846772544624},
+	{-0.9604305194155658, -0.27851968938505317},
+	{-0.9637760657954398, -0.2667127574748985},
+	{-0.9669764710448521, -0.2548656596045147},
+	{-0.970031253194544, -0.24298017990326407},
+	{-0.9729399522055601, -0.23105810828067133},
+	{-0.9757021300385285, -0.21910124015687005},
+	{-0.9783173707196275, -0.20711137619221884},
+	{-0.9807852804032304, -0.1950903220161286},
+	{-0.9831054874312163, -0.1830398879551409},
+	{-0.9852776423889412, -0.17096188876030122},
+	{-0.9873014181578584, -0.15885814333386147},
+	{-0.989176509964781, -0.1467304744553618},
+	{-0.99090263542778, -0.13458070850712628},
+	{-0.99247953459871, -0.12241067519921635},
+	{-0.9939069700023561, -0.11022220729388324},
+	{-0.9951847266721968, -0.09801714032956083},
+	{-0.996312612182778, -0.08579731234444016},
+	{-0.9972904566786902, -0.07356456359966773},
+	{-0.9981181129001492, -0.06132073630220849},
+	{-0.9987954562051724, -0.049067674327417966},
+	{-0.9993223845883495, -0.03680722294135883},
+	{-0.9996988186962042, -0.024541228522912326},
+	{-0.9999247018391445, -0.012271538285720007}
+};
+
+/* i with its 9 bits reversed */
+static const unsigned short FFT_BIT_REVERSE[FFT_TABLES_SIZE] = {
+	0, 256, 128, 384, 64, 320, 192, 448, 32, 288, 160, 416, 96, 352, 224, 480,
+	16, 272, 144, 400, 80, 336, 208, 464, 48, 304, 176, 432, 112, 368, 240, 496,
+	8, 264, 136, 392, 72, 328, 200, 456, 40, 296, 168, 424, 104, 360, 232, 488,
+	24, 280, 152, 408, 88, 344, 216, 472, 56, 312, 184, 440, 120, 376, 248, 504,
+	4, 260, 132, 388, 68, 324, 196, 452, 36, 292, 164, 420, 100, 356, 228, 484,
+	20, 276, 148, 404, 84, 340, 212, 468, 52, 308, 180, 436, 116, 372, 244, 500,
+	12, 268, 140, 396, 76, 332, 204, 460, 44, 300, 172, 428, 108, 364, 236, 492,
+	28, 284, 156, 412, 92, 348, 220, 476, 60, 316, 188, 444, 124, 380, 252, 508,
+	2, 258, 130, 386, 66, 322, 194, 450, 34, 290, 162, 418, 98, 354, 226, 482,
+	18, 274, 146, 402, 82, 338, 210, 466, 50, 306, 178, 434, 114, 370, 242, 498,
+	10, 266, 138, 394, 74, 330, 202, 458, 42, 298, 170, 426, 106, 362, 234, 490,
+	26, 282, 154, 410, 90, 346, 218, 474, 58, 314, 186, 442, 122, 378, 250, 506,
+	6, 262, 134, 390, 70, 326, 198, 454, 38, 294, 166, 422, 102, 358, 230, 486,
+	22, 278, 150, 406, 86, 342, 214, 470, 54, 310, 182, 438, 118, 374, 246, 502,
+	14, 270, 142, 398, 78, 334, 206, 462, 46, 302, 174, 430, 110, 366, 238, 494,
+	30, 286, 158, 414, 94, 350, 222, 478, 62, 318, 190, 446, 126, 382, 254, 510,
+	1, 257, 129, 385, 65, 321, 193, 449, 33, 289, 161, 417, 97, 353, 225, 481,
+	17, 273, 145, 401, 81, 337, 209, 465, 49, 305, 177, 433, 113, 369, 241, 497,
+	9, 265, 137, 393, 73, 329, 201, 457, 41, 297, 169, 425, 105, 361, 233, 489,
+	25, 281, 153, 409, 89, 345, 217, 473, 57, 313, 185, 441, 121, 377, 249, 505,
+	5, 261, 133, 389, 69, 325, 197, 453, 37, 293, 165, 421, 101, 357, 229, 485,
+	21, 277, 149, 405, 85, 341, 213, 469, 53, 309, 181, 437, 117, 373, 245, 501,
+	13, 269, 141, 397, 77, 333, 205, 461, 45, 301, 173, 429, 109, 365, 237, 493,
+	29, 285, 157, 413, 93, 349, 221, 477, 61, 317, 189, 445, 125, 381, 253, 509,
+	3, 259, 131, 387, 67, 323, 195, 451, 35, 291, 163, 419, 99, 355, 227, 483,
+	19, 275, 147, 403, 83, 339, 211, 467, 51, 307, 179, 435, 115, 371, 243, 499,
+	11, 267, 139, 395, 75, 331, 203, 459, 43, 299, 171, 427, 107, 363, 235, 491,
+	27, 283, 155, 411, 91, 347, 219, 475, 59, 315, 187, 443, 123, 379, 251, 507,
+	7, 263, 135, 391, 71, 327, 199, 455, 39, 295, 167, 423, 103, 359, 231, 487,
+	23, 279, 151, 407, 87, 343, 215, 471, 55, 311, 183, 439, 119, 375, 247, 503,
+	15, 271, 143, 399, 79, 335, 207, 463, 47, 303, 175, 431, 111, 367, 239, 495,
+	31, 287, 159, 415, 95, 351, 223, 479, 63, 319, 191, 447, 127, 383, 255, 511
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*! \file fft_windows.h
+* \brief Window tables of the windowed FFTs, generated by tools/gen_fft_windows.py: do not edit
+*
+* Command: python3 tools/gen_fft_windows.py --sizes 128,256
+* Only included by fft.c.
+*/
+
+#ifndef FFT_WINDOWS_H_
+#define FFT_WINDOWS_H_
+
+#define FFT_WINDOW_HANN_GAIN 0.5	/* Coherent gain of the Hann window */
+#define FFT_WINDOW_BLACKMAN_GAIN 0.42	/* Coherent gain of the Blackman window */
+
+/* Hann window of 128 points, w[0] to w[64] */
+static const float FFT_WINDOW_HANN_128[65] = {
+	0.000000000f, 0.000602272f, 0.002407637f, 0.005411745f, 0.009607360f, 0.014984373f, 0.021529832f, 0.029227967f,
+	0.038060234f, 0.048005353f, 0.059039368f, 0.071135695f, 0.084265194f, 0.098396234f, 0.113494773f, 0.129524437f,
+	0.146446609f, 0.164220523f, 0.182803358f, 0.202150348f, 0.222214883f, 0.242948628f, 0.264301632f, 0.286222453f,
+	0.308658284f, 0.331555073f, 0.354857661f, 0.378509910f, 0.402454839f, 0.426634763f, 0.450991430f, 0.475466163f,
+	0.500000000f, 0.524533837f, 0.549008570f, 0.573365237f, 0.597545161f, 0.621490090f, 0.645142339f, 0.668444927f,
+	0.691341716f, 0.713777547f, 0.735698368f, 0.757051372f, 0.777785117f, 0.797849652f, 0.817196642f, 0.835779477f,
+	0.853553391f, 0.870475563f, 0.886505227f, 0.901603766f, 0.915734806f, 0.928864305f, 0.940960632f, 0.951994647f,
+	0.961939766f, 0.970772033f, 0.978470168f, 0.985015627f, 0.990392640f, 0.994588255f, 0.997592363f, 0.999397728f,
+	1.000000000f
+};
+
+/* Blackman window of 128 points, w[0] to w[64] */
+static const float FFT_WINDOW_BLACKMAN_128[65] = {
+	0.000000000f, 0.000217050f, 0.000870459f, 0.001966972f, 0.003517722f, 0.005538075f, 0.008047401f, 0.011068804f,
+	0.014628776f, 0.018756816f, 0.023484986f, 0.028847434f, 0.034879868f, 0.041619008f, 0.049101999f, 0.057365809f,
+	0.066446609f, 0.076379151f, 0.087196132f, 0.098927574f, 0.111600209f, 0.125236889f, 0.139856013f, 0.155470991f,
+	0.172089741f, 0.189714237f, 0.208340092f, 0.227956209f, 0.248544476f, 0.270079536f, 0.292528607f, 0.315851385f,
+	0.340000000f, 0.364919059f, 0.390545748f, 0.416810010f, 0.443634798f, 0.470936389f, 0.498624770f, 0.526604090f,
+	0.554773174f, 0.583026084f, 0.611252750f, 0.639339633f, 0.667170442f, 0.694626878f, 0.721589416f, 0.747938106f,
+	0.773553391f, 0.798316934f, 0.822112452f, 0.844826540f, 0.866349481f, 0.886576044f, 0.905406251f, 0.922746109f,
+	0.938508309f, 0.952612869f, 0.964987737f, 0.975569328f, 0.984303003f, 0.991143482f, 0.996055186f, 0.999012506f,
+	1.000000000f
+};
+
+/* Hann window of 256 points, w[0] to w[128] */
+static const float FFT_WINDOW_HANN_256[129] = {
+	0.000000000f, 0.000150591f, 0.000602272f, 0.001354772f, 0.002407637f, 0.003760233f, 0.005411745f, 0.007361179f,
+	0.009607360f, 0.012148935f, 0.014984373f, 0.018111967f, 0.021529832f, 0.025235910f, 0.029227967f, 0.033503601f,
+	0.038060234f, 0.042895122f, 0.048005353f, 0.053387849f, 0.059039368f, 0.064956504f, 0.071135695f, 0.077573217f,
+	0.084265194f, 0.091207593f, 0.098396234f, 0.105826786f, 0.113494773f, 0.121395577f, 0.129524437f, 0.137876459f,
+	0.146446609f, 0.155229728f, 0.164220523f, 0.173413579f, 0.182803358f, 0.192384205f, 0.202150348f, 0.212095904f,
+	0.222214883f, 0.232501190f, 0.242948628f, 0.253550904f, 0.264301632f, 0.275194335f, 0.286222453f, 0.297379343f,
+	0.308658284f, 0.320052482f, 0.331555073f, 0.343159130f, 0.354857661f, 0.366643621f, 0.378509910f, 0.390449380f,
+	0.402454839f, 0.414519056f, 0.426634763f, 0.438794662f, 0.450991430f, 0.463217718f, 0.475466163f, 0.487729386f,
+	0.500000000f, 0.512270614f, 0.524533837f, 0.536782282f, 0.549008570f, 0.561205338f, 0.573365237f, 0.585480944f,
+	0.597545161f, 0.609550620f, 0.621490090f, 0.633356379f, 0.645142339f, 0.656840870f, 0.668444927f, 0.679947518f,
+	0.691341716f, 0.702620657f, 0.713777547f, 0.724805665f, 0.735698368f, 0.746449096f, 0.757051372f, 0.767498810f,
+	0.777785117f, 0.787904096f, 0.797849652f, 0.807615795f, 0.817196642f, 0.826586421f, 0.835779477f, 0.844770272f,
+	0.853553391f, 0.862123541f, 0.870475563f, 0.878604423f, 0.886505227f, 0.894173214f, 0.901603766f, 0.908792407f,
+	0.915734806f, 0.922426783f, 0.928864305f, 0.935043496f, 0.940960632f, 0.946612151f, 0.951994647f, 0.957104878f,
+	0.961939766f, 0.966496399f, 0.970772033f, 0.974764090f, 0.978470168f, 0.981888033f, 0.985015627f, 0.987851065f,
+	0.990392640f, 0.992638821f, 0.994588255f, 0.996239767f, 0.997592363f, 0.998645228f, 0.999397728f, 0.999849409f,
+	1.000000000f
+};
+
+/* Blackman window of 256 points, w[0] to w[128] */
+static const float FFT_WINDOW_BLACKMAN_256[129] = {
+	0.000000000f, 0.000054227f, 0.000217050f, 0.000488892f, 0.000870459f, 0.001362733f, 0.001966972f, 0.002684704f,
+	0.003517722f, 0.004468078f, 0.005538075f, 0.006730256f, 0.008047401f, 0.009492512f, 0.011068804f, 0.012779691f,
+	0.014628776f, 0.016619839f, 0.018756816f, 0.021043794f, 0.023484986f, 0.026084724f, 0.028847434f, 0.031777625f,
+	0.034879868f, 0.038158782f, 0.041619008f, 0.045265201f, 0.049101999f, 0.053134015f, 0.057365809f, 0.061801872f,
+	0.066446609f, 0.071304314f, 0.076379151f, 0.081675141f, 0.087196132f, 0.092945790f, 0.098927574f, 0.105144716f,
+	0.111600209f, 0.118296783f, 0.125236889f, 0.132422684f, 0.139856013f, 0.147538391f, 0.155470991f, 0.163654627f,
+	0.172089741f, 0.180776392f, 0.189714237f, 0.198902527f, 0.208340092f, 0.218025332f, 0.227956209f, 0.238130236f,
+	0.248544476f, 0.259195530f, 0.270079536f, 0.281192162f, 0.292528607f, 0.304083597f, 0.315851385f, 0.327825749f,
+	0.340000000f, 0.352366978f, 0.364919059f, 0.377648161f, 0.390545748f, 0.403602837f, 0.416810010f, 0.430157419f,
+	0.443634798f, 0.457231477f, 0.470936389f, 0.484738090f, 0.498624770f, 0.512584268f, 0.526604090f, 0.540671428f,
+	0.554773174f, 0.568895941f, 0.583026084f, 0.597149720f, 0.611252750f, 0.625320877f, 0.639339633f, 0.653294402f,
+	0.667170442f, 0.680952907f, 0.694626878f, 0.708177381f, 0.721589416f, 0.734847984f, 0.747938106f, 0.760844858f,
+	0.773553391f, 0.786048955f, 0.798316934f, 0.810342861f, 0.822112452f, 0.833611628f, 0.844826540f, 0.855743595f,
+	0.866349481f, 0.876631190f, 0.886576044f, 0.896171715f, 0.905406251f, 0.914268095f, 0.922746109f, 0.930829594f,
+	0.938508309f, 0.945772489f, 0.952612869f, 0.959020693f, 0.964987737f, 0.970506322f, 0.975569328f, 0.980170208f,
+	0.984303003f, 0.987962346f, 0.991143482f, 0.993842268f, 0.996055186f, 0.997779349f, 0.999012506f, 0.999753046f,
+	1.000000000f
+};
+
+#endif
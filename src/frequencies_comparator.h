@@ -2,7 +2,8 @@
  * \author Gioele Giunta
  * \version 1.0
  * \since 21<sup>st</sup> March 2024
- * \brief Function that identifies a key, handles noise, multitone and overflow; and manages a sequence of characters to be projected in print.
+ * \brief Function that identifies a key, handles noise and multitone; and appends the digits to the log projected in print.
+ * Repetitions, short tones and short pauses are sorted out by the digit state machine of digit_state.h.
  */
 
 #ifndef _FREQUENCIES_COMPARATOR_H_
@@ -17,19 +18,22 @@
 #include <lcd.h>
 #include "global_parameters.h"
 #include "errorm.h"
+#include "digit_state.h"
+#include "digit_log.h"
 
-/*! \fn int frequencies_comparator(struct_tone_frequencies tone_frequencies, char *last_char, char *sequence)
-* \param tone_frequencies The struct containing the high and low frequencies
-* \param *last_char The pointer to the last_char, used to determine if there is a repetition or not
-* \param *sequence The char Array where character will be saved
-* \returns The status of operation 1 -> Tone detected, 0 -> Noise Detected/No operation by main required, <0 -> Error detected Operations from main Required
-* \brief Compares the input frequencies to the DTMF frequency matrix and determines the corresponding key.
+/*! \fn int frequencies_comparator(struct_tone_frequencies tone_frequencies, digit_state_t *state, digit_log_t *log)
+* \param tone_frequencies The struct containing the indices of the high and low frequencies
+* \param *state The digit state machine of the channel, fed with the key of every frame
+* \param *log The digit log where characters will be saved
+* \returns The status of operation 1 -> Tone detected, 0 -> Noise Detected/No operation by main required, -2 -> Multitone detected, error to be shown by main
+* \brief Looks up the key of the input tone indices in the DTMF matrix.
 *
-* This function takes in a struct containing the high and low frequencies of a DTMF signal, pointers to the last character detected and the character sequence. 
-* It then determines the key that corresponds to the input frequencies and adds it to the character sequence, if it is a new character, also handles the case where OVERFLOW is detected. 
-* The function also handles the case where no DTMF signal is detected or multiple DTMF signals are detected.
+* This function takes in a struct containing the indices of the high and low frequencies of a DTMF signal, the digit state machine and the digit log. 
+* The indices select the key in a single table access and the key is passed to the state machine, which validates the tone duration and the pause before it.
+* The key is added to the digit log only when the state machine confirms a new digit. A full log drops its oldest digit, so adding never fails. 
+* The function also handles the case where no DTMF signal is detected or multiple DTMF signals are detected, both count as a frame without key.
 */
-int frequencies_comparator(struct_tone_frequencies tone_frequencies, char *last_char, char *sequence);
+int frequencies_comparator(struct_tone_frequencies tone_frequencies, digit_state_t *state, digit_log_t *log);
 
 #endif
 
@@ -0,0 +1,310 @@
+/*! \file fsk_cid.c
+* \brief Functions for fsk_cid.h
+*/
+
+#include <string.h>
+
+#include "fsk_cid.h"
+
+#if (G_SAMPLE_RATE % 100) != 0
+#error "fsk_cid.c reads its references from a 100 Hz table and needs a multiple of 100 Hz as sample rate"
+#endif
+
+#define FSK_CID_BAUD 1200
+
+/* Samples of one period of the 100 Hz reference, plus a quarter so that the sine is read as a shifted cosine */
+#define FSK_CID_PERIOD (G_SAMPLE_RATE / 100)
+#define FSK_CID_QUARTER (FSK_CID_PERIOD / 4)
+
+/* Consecutive mark bits that arm the receiver, well below the 55 to 180 bits sent after the channel seizure */
+#define FSK_CID_PREAMBLE_BITS 10
+
+/* Samples without a carrier after which a message in progress is dropped, two bits */
+#define FSK_CID_CARRIER_LOSS (2 * G_SAMPLE_RATE / FSK_CID_BAUD)
+
+/* Smallest share of the window energy in the stronger tone for a carrier: 1 for a clean tone */
+#define FSK_CID_TONE_SHARE 0.5
+
+/* Receiver states */
+#define FSK_CID_HUNT 0	/* Waiting for the mark preamble */
+#define FSK_CID_IDLE 1	/* Mark between bytes, waiting for a start bit */
+#define FSK_CID_BYTE 2	/* Sampling the bits of a byte */
+
+/* Products kept in the rings */
+#define FSK_CID_MARK_I 0
+#define FSK_CID_MARK_Q 1
+#define FSK_CID_SPACE_I 2
+#define FSK_CID_SPACE_Q 3
+#define FSK_CID_ENERGY 4
+
+static double reference[FSK_CID_PERIOD + FSK_CID_QUARTER];	/* cos(2 pi 100 i / G_SAMPLE_RATE) */
+static int reference_ready = 0;
+
+void fsk_cid_init(fsk_cid_t *cid, fsk_cid_mode_t mode, double min_level)
+{
+	int i;
+
+	if (!reference_ready)
+	{
+		for (i = 0; i < FSK_CID_PERIOD + FSK_CID_QUARTER; i++)
+		{
+			reference[i] = cos(2.0 * G_PI * i / FSK_CID_PERIOD);
+		}
+		reference_ready = 1;
+	}
+
+	memset(cid, 0, sizeof(*cid));
+	cid->mark_step = (uint8_t)((mode == FSK_CID_V23 ? 1300 : 1200) / 100);
+	cid->space_step = (uint8_t)((mode == FSK_CID_V23 ? 2100 : 2200) / 100);
+	/* A tone of amplitude A correlates to A * FSK_CID_WINDOW / 2 */
+	cid->min_power = min_level * min_level * FSK_CID_WINDOW * FSK_CID_WINDOW / 4.0;
+	cid->rx_state = FSK_CID_HUNT;
+}
+
+/* Copies a field, cut to FSK_CID_FIELD_LENGTH */
+static void fsk_cid_copy(char *field, const uint8_t *data, int length)
+{
+	if (length > FSK_CID_FIELD_LENGTH)
+	{
+		length = FSK_CID_FIELD_LENGTH;
+	}
+	memcpy(field, data, (size_t)length);
+	field[length] = '\0';
+}
+
+/* Reads a number field, or its reason for absence when it is a single 'O' or 'P' */
+static void fsk_cid_number(fsk_cid_message_t *message, const uint8_t *data, int length)
+{
+	if (length == 1 && (data[0] == 'O' || data[0] == 'P'))
+	{
+		message->number_absent = (char)data[0];
+	}
+	else
+	{
+		fsk_cid_copy(message->number, data, length);
+	}
+}
+
+/* Fills cid->message from the checked message in cid->buffer */
+static void fsk_cid_parse(fsk_cid_t *cid)
+{
+	fsk_cid_message_t *message = &cid->message;
+	const uint8_t *body = cid->buffer + 2;
+	int length = cid->buffer[1];
+	int i, type, size;
+
+	memset(message, 0, sizeof(*message));
+	message->type = cid->buffer[0];
+
+	if (message->type == FSK_CID_SDMF)
+	{
+		/* Date and time, then the number */
+		if (length >= 8)
+		{
+			memcpy(message->date_time, body, 8);
+			fsk_cid_number(message, body + 8, length - 8);
+		}
+		return;
+	}
+
+	for (i = 0; i + 2 <= length; i += 2 + size)
+	{
+		type = body[i];
+		size = body[i + 1];
+		if (i + 2 + size > length)
+		{
+			break;
+		}
+		switch (type)
+		{
+			case FSK_CID_PARAM_DATE_TIME:
+				if (size == 8)
+				{
+					memcpy(message->date_time, body + i + 2, 8);
+				}
+				break;
+			case FSK_CID_PARAM_NUMBER:
+				fsk_cid_number(message, body + i + 2, size);
+				break;
+			case FSK_CID_PARAM_NUMBER_ABSENT:
+				message->number_absent = size > 0 ? (char)body[i + 2] : 0;
+				break;
+			case FSK_CID_PARAM_NAME:
+				fsk_cid_copy(message->name, body + i + 2, size);
+				break;
+			case FSK_CID_PARAM_NAME_ABSENT:
+				message->name_absent = size > 0 ? (char)body[i + 2] : 0;
+				break;
+			default:
+				/* Parameters this display has no use for */
+				break;
+		}
+	}
+}
+
+/* Drops the message in progress, if any, and goes back to hunting for a preamble */
+static void fsk_cid_abort(fsk_cid_t *cid)
+{
+	if (cid->length > 0)
+	{
+		cid->framing_errors++;
+	}
+	cid->length = 0;
+	cid->rx_state = FSK_CID_HUNT;
+	cid->mark_run = 0;
+}
+
+/* Adds a received byte to the message, returns 1 when it completes a message with a valid checksum */
+static int fsk_cid_byte(fsk_cid_t *cid, uint8_t byte)
+{
+	uint8_t checksum = 0;
+	int i;
+
+	if (cid->length == 0 && byte != FSK_CID_SDMF && byte != FSK_CID_MDMF)
+	{
+		/* Message waiting and other types are skipped */
+		fsk_cid_abort(cid);
+		return 0;
+	}
+	cid->buffer[cid->length++] = byte;
+	if (cid->length < 2 || cid->length < cid->buffer[1] + 3)
+	{
+		return 0;
+	}
+
+	/* Type, length, body and checksum add up to 0 modulo 256 */
+	for (i = 0; i < cid->length; i++)
+	{
+		checksum = (uint8_t)(checksum + cid->buffer[i]);
+	}
+	if (checksum == 0)
+	{
+		fsk_cid_parse(cid);
+		cid->messages++;
+	}
+	else
+	{
+		cid->checksum_errors++;
+	}
+	/* The next message comes with its own seizure and preamble */
+	cid->length = 0;
+	cid->rx_state = FSK_CID_HUNT;
+	cid->mark_run = 0;
+	return checksum == 0;
+}
+
+int fsk_cid_process(fsk_cid_t *cid, const complex_g3_t *samples, int count)
+{
+	double product[5];
+	double *old;
+	double x, mark_power, space_power, difference, peak;
+	int i, k, mark, mark_bit, carrier;
+	int completed = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		x = samples[i].re;
+
+		/* Correlations over the last FSK_CID_WINDOW samples, updated by the newest product minus the oldest */
+		product[FSK_CID_MARK_I] = x * reference[cid->mark_phase];
+		product[FSK_CID_MARK_Q] = x * reference[cid->mark_phase + FSK_CID_QUARTER];
+		product[FSK_CID_SPACE_I] = x * reference[cid->space_phase];
+		product[FSK_CID_SPACE_Q] = x * reference[cid->space_phase + FSK_CID_QUARTER];
+		product[FSK_CID_ENERGY] = x * x;
+		old = cid->ring[cid->slot];
+		for (k = 0; k < 5; k++)
+		{
+			cid->sum[k] += product[k] - old[k];
+			old[k] = product[k];
+		}
+		if (++cid->slot == FSK_CID_WINDOW)
+		{
+			cid->slot = 0;
+		}
+		cid->mark_phase = (uint8_t)(cid->mark_phase + cid->mark_step);
+		if (cid->mark_phase >= FSK_CID_PERIOD)
+		{
+			cid->mark_phase -= FSK_CID_PERIOD;
+		}
+		cid->space_phase = (uint8_t)(cid->space_phase + cid->space_step);
+		if (cid->space_phase >= FSK_CID_PERIOD)
+		{
+			cid->space_phase -= FSK_CID_PERIOD;
+		}
+
+		mark_power = cid->sum[FSK_CID_MARK_I] * cid->sum[FSK_CID_MARK_I] + cid->sum[FSK_CID_MARK_Q] * cid->sum[FSK_CID_MARK_Q];
+		space_power = cid->sum[FSK_CID_SPACE_I] * cid->sum[FSK_CID_SPACE_I] + cid->sum[FSK_CID_SPACE_Q] * cid->sum[FSK_CID_SPACE_Q];
+		mark = mark_power > space_power;
+		/* The bits are read from the difference summed over three samples, which makes a bit error in noise much rarer */
+		difference = mark_power - space_power;
+		mark_bit = difference + cid->difference[0] + cid->difference[1] > 0.0;
+		cid->difference[1] = cid->difference[0];
+		cid->difference[0] = difference;
+		peak = mark ? mark_power : space_power;
+		/* A clean tone of amplitude A gives a peak of (A N / 2)^2 and an energy of A^2 N / 2 */
+		carrier = peak >= cid->min_power && 2.0 * peak >= FSK_CID_TONE_SHARE * FSK_CID_WINDOW * cid->sum[FSK_CID_ENERGY];
+
+		if (carrier)
+		{
+			cid->carrier_lost = 0;
+		}
+		else if (++cid->carrier_lost > FSK_CID_CARRIER_LOSS && cid->rx_state != FSK_CID_HUNT)
+		{
+			fsk_cid_abort(cid);
+		}
+
+		switch (cid->rx_state)
+		{
+			case FSK_CID_HUNT:
+				/* The channel seizure alternates bits, only the mark that follows it arms the receiver */
+				cid->mark_run = (carrier && mark) ? cid->mark_run + 1 : 0;
+				if (cid->mark_run >= FSK_CID_PREAMBLE_BITS * G_SAMPLE_RATE / FSK_CID_BAUD)
+				{
+					cid->rx_state = FSK_CID_IDLE;
+				}
+				break;
+			case FSK_CID_IDLE:
+				if (carrier && !mark)
+				{
+					/* Start bit edge: the bits are sampled in their middle, half a bit from now and every bit after */
+					cid->rx_state = FSK_CID_BYTE;
+					cid->clock = (G_SAMPLE_RATE + FSK_CID_BAUD) / 2;
+					cid->bit = 0;
+					cid->shift = 0;
+				}
+				break;
+			default:
+				cid->clock += FSK_CID_BAUD;
+				if (cid->clock < G_SAMPLE_RATE)
+				{
+					break;
+				}
+				cid->clock -= G_SAMPLE_RATE;
+				if (cid->bit == 0)
+				{
+					if (mark_bit)
+					{
+						/* Not a start bit after all */
+						cid->rx_state = FSK_CID_IDLE;
+					}
+				}
+				else if (cid->bit <= 8)
+				{
+					cid->shift = (uint8_t)((cid->shift >> 1) | (mark_bit ? 0x80 : 0));
+				}
+				else if (mark_bit)
+				{
+					cid->rx_state = FSK_CID_IDLE;
+					completed |= fsk_cid_byte(cid, cid->shift);
+				}
+				else
+				{
+					/* No stop bit */
+					fsk_cid_abort(cid);
+				}
+				cid->bit++;
+				break;
+		}
+	}
+	return completed;
+}
@@ -0,0 +1,125 @@
+/*! \file fsk_cid.h
+* \brief Streaming Bell 202 / V.23 FSK caller ID demodulator, fed with the same frames as the DTMF detectors
+*
+* The demodulator correlates the input with the mark and space tones over a window of about one bit: the larger of
+* the two correlations is the bit, and the pair against the window energy tells a carrier from noise or speech. The
+* bits go through an asynchronous receiver (one start bit, eight data bits LSB first, one stop bit) that locks on the
+* mark preamble sent after the channel seizure, and the bytes through the SDMF/MDMF message parser. All the state is
+* kept between calls, so a message may be cut anywhere by the frame boundaries. The bits are sampled in their middle
+* on the mark minus space power summed over three samples, which rides out most of the noise spikes of a single one.
+*
+* The references are read from one table of a 100 Hz cosine, the four tones being multiples of 100 Hz: the cost is
+* four multiplications per sample for the correlations, plus the energy and the two powers.
+*/
+
+#ifndef FSK_CID_H_
+#define FSK_CID_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "complex_g3.h"
+
+/*! \def FSK_CID_WINDOW
+* \brief Correlator length in samples, one bit at 1200 baud is 6.7 samples at 8 kHz
+*/
+#define FSK_CID_WINDOW 7
+
+/*! \def FSK_CID_MAX_MESSAGE
+* \brief Longest message: type, length, up to 255 bytes of body and the checksum
+*/
+#define FSK_CID_MAX_MESSAGE 258
+
+/*! \def FSK_CID_FIELD_LENGTH
+* \brief Longest number or name kept, longer fields are cut
+*/
+#define FSK_CID_FIELD_LENGTH 32
+
+/*! \def FSK_CID_DEFAULT_LEVEL
+* \brief Default smallest carrier amplitude for fsk_cid_init(), 38 dB below G_MAX_AMPLITUDE
+*/
+#define FSK_CID_DEFAULT_LEVEL 100.0
+
+/* Message types */
+#define FSK_CID_SDMF 0x04	/* Single data message format caller ID */
+#define FSK_CID_MDMF 0x80	/* Multiple data message format caller ID */
+
+/* MDMF parameter types */
+#define FSK_CID_PARAM_DATE_TIME 0x01
+#define FSK_CID_PARAM_NUMBER 0x02
+#define FSK_CID_PARAM_NUMBER_ABSENT 0x04
+#define FSK_CID_PARAM_NAME 0x07
+#define FSK_CID_PARAM_NAME_ABSENT 0x08
+
+/*! \typedef fsk_cid_mode_t
+* \brief Modulation of the line
+*/
+typedef enum fsk_cid_mode_t
+{
+	FSK_CID_BELL202,	/*!< Mark 1200 Hz, space 2200 Hz */
+	FSK_CID_V23	/*!< Mark 1300 Hz, space 2100 Hz */
+} fsk_cid_mode_t;
+
+/*! \typedef fsk_cid_message_t
+* \brief A decoded caller ID message, empty strings for the fields it did not carry
+*/
+typedef struct fsk_cid_message_t
+{
+	uint8_t type;	/*!< FSK_CID_SDMF or FSK_CID_MDMF */
+	char date_time[9];	/*!< MMDDHHMM */
+	char number[FSK_CID_FIELD_LENGTH + 1];	/*!< Calling number */
+	char name[FSK_CID_FIELD_LENGTH + 1];	/*!< Calling name, MDMF only */
+	char number_absent;	/*!< 'O' out of area, 'P' private, or 0 when the number is given */
+	char name_absent;	/*!< 'O' out of area, 'P' private, or 0 when the name is given or not sent */
+} fsk_cid_message_t;
+
+/*! \typedef fsk_cid_t
+* \brief State of a demodulator
+*/
+typedef struct fsk_cid_t
+{
+	/* Correlator */
+	uint8_t mark_step, space_step;	/*!< Phase steps of the tones in the 100 Hz table */
+	uint8_t mark_phase, space_phase;	/*!< Current phases in the table */
+	int slot;	/*!< Oldest entry of the rings */
+	double ring[FSK_CID_WINDOW][5];	/*!< Last products: mark I/Q, space I/Q and x^2 */
+	double sum[5];	/*!< Sums of the rings */
+	double difference[2];	/*!< Mark minus space power of the two previous samples */
+	double min_power;	/*!< Smallest correlation power taken as a carrier */
+	int carrier_lost;	/*!< Samples since the last one with a carrier */
+	/* Receiver */
+	int rx_state;	/*!< Hunting for the preamble, idle between bytes, or in a byte */
+	int mark_run;	/*!< Consecutive mark samples while hunting */
+	uint32_t clock;	/*!< Bit clock, a bit is sampled each time it goes over G_SAMPLE_RATE */
+	int bit;	/*!< Bit of the byte being received, 0 for the start bit */
+	uint8_t shift;	/*!< Data bits received so far */
+	/* Message parser */
+	uint8_t buffer[FSK_CID_MAX_MESSAGE];	/*!< Bytes of the message being received */
+	int length;	/*!< Bytes in buffer */
+	fsk_cid_message_t message;	/*!< Last message decoded */
+	/* Statistics */
+	uint32_t messages;	/*!< Messages decoded */
+	uint32_t checksum_errors;	/*!< Messages dropped for a bad checksum */
+	uint32_t framing_errors;	/*!< Messages dropped for a missing stop bit or a lost carrier */
+} fsk_cid_t;
+
+/*! \fn void fsk_cid_init(fsk_cid_t *cid, fsk_cid_mode_t mode, double min_level)
+* \param cid The demodulator
+* \param mode Modulation of the line
+* \param min_level Smallest tone amplitude taken as a carrier, in the units of the reader samples
+* \brief Resets the demodulator, which starts hunting for a preamble
+*/
+void fsk_cid_init(fsk_cid_t *cid, fsk_cid_mode_t mode, double min_level);
+
+/*! \fn int fsk_cid_process(fsk_cid_t *cid, const complex_g3_t *samples, int count)
+* \param cid The demodulator
+* \param samples Centred samples at G_SAMPLE_RATE, only the real parts are read
+* \param count Number of samples
+* \returns 1 if a message was completed in these samples, then found in cid->message, 0 otherwise
+* \brief Demodulates a block of samples, carrying the state over to the next block
+*/
+int fsk_cid_process(fsk_cid_t *cid, const complex_g3_t *samples, int count);
+
+#endif // FSK_CID_H_
@@ -0,0 +1,94 @@
+/*! \file g711.c
+* \brief Functions for g711.h
+*/
+
+/* C Library Headers */
+#include <string.h>
+
+/* Header */
+#include "g711.h"
+
+/* mu-law and A-law to sample tables, in flash */
+#include "g711_tables.h"
+
+/* The preprocessor cannot compare floating constants, an array of negative size stops the build instead */
+typedef char g711_tables_check[(int)G711_TABLES_MAX_AMPLITUDE == (int)G_MAX_AMPLITUDE ? 1 : -1];
+
+const float *g711_table(g711_law_t law)
+{
+	return law == G711_ALAW ? G711_ALAW_TABLE : G711_ULAW_TABLE;
+}
+
+void g711_expand(const float *table, const unsigned char *codes, int count, complex_g3_t *samples)
+{
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		samples[i].re = table[codes[i]];
+		samples[i].im = 0.0;
+	}
+}
+
+struct_tone_frequencies g711_detect(const detector_t *detector, const float *table, const unsigned char *codes,
+	complex_g3_t *scratch)
+{
+	if (detector->process_g711 != NULL)
+	{
+		detector->process_g711(codes, table);
+	}
+	else
+	{
+		g711_expand(table, codes, G_ARRAY_SIZE, scratch);
+		detector->process_frame(scratch);
+	}
+	return detector->get_tones();
+}
+
+void g711_stream_init(g711_stream_t *stream, const detector_t *detector, g711_law_t law, complex_g3_t *scratch)
+{
+	memset(stream, 0, sizeof(*stream));
+	stream->detector = detector;
+	stream->table = g711_table(law);
+	stream->scratch = scratch;
+	detector->init();
+}
+
+void g711_stream_set_callback(g711_stream_t *stream, g711_callback_t function, void *context)
+{
+	stream->callback = function;
+	stream->context = context;
+}
+
+int g711_stream_push(g711_stream_t *stream, const unsigned char *codes, int count)
+{
+	struct_tone_frequencies tones;
+	int completed = 0;
+	int size;
+
+	while (count > 0)
+	{
+		size = G_ARRAY_SIZE - stream->count;
+		if (size > count)
+		{
+			size = count;
+		}
+		memcpy(stream->codes + stream->count, codes, (size_t)size);
+		stream->count += size;
+		codes += size;
+		count -= size;
+
+		if (stream->count == G_ARRAY_SIZE)
+		{
+			tones = g711_detect(stream->detector, stream->table, stream->codes, stream->scratch);
+			stream->count = 0;
+			stream->frames++;
+			completed++;
+			if (stream->callback != NULL)
+			{
+				stream->callback(stream->context, tones);
+			}
+		}
+	}
+	return completed;
+}
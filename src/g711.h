@@ -0,0 +1,104 @@
+/*! \file g711.h
+* \brief G.711 mu-law and A-law input for the DTMF detectors, without a linear copy of the signal
+*
+* Telephony trunks and recordings deliver 8 bit G.711 codes at G_SAMPLE_RATE. Expanding them into a frame of samples
+* before decoding writes and reads back 16 bytes per code; instead the Goertzel and FFT detectors read each code
+* through a 256 entry expansion table where their loops load the sample, and only the codes are buffered. The tables
+* are scaled so that a code reads the same level as the reader samples, and the detectors keep their thresholds.
+*
+* Detectors without a G.711 entry, the decimating and the stateful ones, get the codes expanded into a scratch frame
+* given by the caller, so every detector of g_detectors[] can be fed with codes.
+*/
+
+#ifndef G711_H_
+#define G711_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "complex_g3.h"
+#include "detector.h"
+
+/*! \typedef g711_law_t
+* \brief Companding law of the codes
+*/
+typedef enum g711_law_t
+{
+	G711_ULAW,	/*!< mu-law, North America and Japan */
+	G711_ALAW	/*!< A-law, Europe and the rest of the world */
+} g711_law_t;
+
+/*! \typedef g711_callback_t
+* \brief Receives the tones of each frame completed by g711_stream_push()
+*/
+typedef void (*g711_callback_t)(void *context, struct_tone_frequencies tones);
+
+/*! \typedef g711_stream_t
+* \brief Codes of the frame being filled, for input that arrives in packets of any size
+*/
+typedef struct g711_stream_t
+{
+	const detector_t *detector;	/*!< Detector fed with each full frame */
+	const float *table;	/*!< Expansion table of the law */
+	complex_g3_t *scratch;	/*!< G_ARRAY_SIZE samples for a detector without a G.711 entry, may be NULL otherwise */
+	unsigned char codes[G_ARRAY_SIZE];	/*!< Codes of the frame being filled */
+	int count;	/*!< Codes in codes[] */
+	uint32_t frames;	/*!< Frames given to the detector */
+	g711_callback_t callback;	/*!< Called with the tones of each frame, or NULL */
+	void *context;	/*!< Passed to the callback */
+} g711_stream_t;
+
+/*! \fn const float *g711_table(g711_law_t law)
+* \param law A companding law
+* \returns The 256 samples of the codes of the law, in flash
+*/
+const float *g711_table(g711_law_t law);
+
+/*! \fn void g711_expand(const float *table, const unsigned char *codes, int count, complex_g3_t *samples)
+* \param table Expansion table of the law
+* \param codes Codes to expand
+* \param count Number of codes
+* \param samples Receives count samples, with a zero imaginary part
+* \brief Converts codes to samples, for code that needs them as a frame
+*/
+void g711_expand(const float *table, const unsigned char *codes, int count, complex_g3_t *samples);
+
+/*! \fn struct_tone_frequencies g711_detect(const detector_t *detector, const float *table, const unsigned char *codes, complex_g3_t *scratch)
+* \param detector The detector, initialised by its init()
+* \param table Expansion table of the law
+* \param codes A frame of G_ARRAY_SIZE codes
+* \param scratch G_ARRAY_SIZE samples the codes are expanded into if the detector has no G.711 entry, may be NULL otherwise
+* \returns The tones of the frame, as get_tones() of the detector
+* \brief Analyses one frame of codes, the batch path
+*/
+struct_tone_frequencies g711_detect(const detector_t *detector, const float *table, const unsigned char *codes,
+	complex_g3_t *scratch);
+
+/*! \fn void g711_stream_init(g711_stream_t *stream, const detector_t *detector, g711_law_t law, complex_g3_t *scratch)
+* \param stream The stream
+* \param detector The detector, which is initialised here
+* \param law Companding law of the codes
+* \param scratch G_ARRAY_SIZE samples if the detector has no G.711 entry, may be NULL otherwise
+* \brief Starts a stream with an empty frame and no callback
+*/
+void g711_stream_init(g711_stream_t *stream, const detector_t *detector, g711_law_t law, complex_g3_t *scratch);
+
+/*! \fn void g711_stream_set_callback(g711_stream_t *stream, g711_callback_t function, void *context)
+* \param stream The stream
+* \param function Called with the tones of each frame, NULL for none
+* \param context Passed to the function
+*/
+void g711_stream_set_callback(g711_stream_t *stream, g711_callback_t function, void *context);
+
+/*! \fn int g711_stream_push(g711_stream_t *stream, const unsigned char *codes, int count)
+* \param stream The stream
+* \param codes Codes received, such as the payload of one RTP packet
+* \param count Number of codes
+* \returns Number of frames completed and analysed, the tones of the last one are those of get_tones() of the detector
+* \brief Appends codes to the frame being filled, the streaming path
+*/
+int g711_stream_push(g711_stream_t *stream, const unsigned char *codes, int count);
+
+#endif // G711_H_
@@ -0,0 +1,85 @@
+/*! \file g711_tables.h
+* \brief G.711 mu-law and A-law expansion tables, generated by tools/gen_g711_tables.py: do not edit
+*
+* Command: python3 tools/gen_g711_tables.py
+* Only included by g711.c.
+*/
+
+#ifndef G711_TABLES_H_
+#define G711_TABLES_H_
+
+#define G711_TABLES_MAX_AMPLITUDE 8000.0	/* G_MAX_AMPLITUDE the tables were scaled for */
+
+/* mu-law code to sample, 16 bit linear value times 0.244140625 */
+static const float G711_ULAW_TABLE[256] = {
+	-7842.7734375f, -7592.7734375f, -7342.7734375f, -7092.7734375f, -6842.7734375f, -6592.7734375f, -6342.7734375f, -6092.7734375f,
+	-5842.7734375f, -5592.7734375f, -5342.7734375f, -5092.7734375f, -4842.7734375f, -4592.7734375f, -4342.7734375f, -4092.7734375f,
+	-3905.2734375f, -3780.2734375f, -3655.2734375f, -3530.2734375f, -3405.2734375f, -3280.2734375f, -3155.2734375f, -3030.2734375f,
+	-2905.2734375f, -2780.2734375f, -2655.2734375f, -2530.2734375f, -2405.2734375f, -2280.2734375f, -2155.2734375f, -2030.2734375f,
+	-1936.5234375f, -1874.0234375f, -1811.5234375f, -1749.0234375f, -1686.5234375f, -1624.0234375f, -1561.5234375f, -1499.0234375f,
+	-1436.5234375f, -1374.0234375f, -1311.5234375f, -1249.0234375f, -1186.5234375f, -1124.0234375f, -1061.5234375f, -999.0234375f,
+	-952.1484375f, -920.8984375f, -889.6484375f, -858.3984375f, -827.1484375f, -795.8984375f, -764.6484375f, -733.3984375f,
+	-702.1484375f, -670.8984375f, -639.6484375f, -608.3984375f, -577.1484375f, -545.8984375f, -514.6484375f, -483.3984375f,
+	-459.9609375f, -444.3359375f, -428.7109375f, -413.0859375f, -397.4609375f, -381.8359375f, -366.2109375f, -350.5859375f,
+	-334.9609375f, -319.3359375f, -303.7109375f, -288.0859375f, -272.4609375f, -256.8359375f, -241.2109375f, -225.5859375f,
+	-213.8671875f, -206.0546875f, -198.2421875f, -190.4296875f, -182.6171875f, -174.8046875f, -166.9921875f, -159.1796875f,
+	-151.3671875f, -143.5546875f, -135.7421875f, -127.9296875f, -120.1171875f, -112.3046875f, -104.4921875f, -96.6796875f,
+	-90.8203125f, -86.9140625f, -83.0078125f, -79.1015625f, -75.1953125f, -71.2890625f, -67.3828125f, -63.4765625f,
+	-59.5703125f, -55.6640625f, -51.7578125f, -47.8515625f, -43.9453125f, -40.0390625f, -36.1328125f, -32.2265625f,
+	-29.296875f, -27.34375f, -25.390625f, -23.4375f, -21.484375f, -19.53125f, -17.578125f, -15.625f,
+	-13.671875f, -11.71875f, -9.765625f, -7.8125f, -5.859375f, -3.90625f, -1.953125f, 0.0f,
+	7842.7734375f, 7592.7734375f, 7342.7734375f, 7092.7734375f, 6842.7734375f, 6592.7734375f, 6342.7734375f, 6092.7734375f,
+	5842.7734375f, 5592.7734375f, 5342.7734375f, 5092.7734375f, 4842.7734375f, 4592.7734375f, 4342.7734375f, 4092.7734375f,
+	3905.2734375f, 3780.2734375f, 3655.2734375f, 3530.2734375f, 3405.2734375f, 3280.2734375f, 3155.2734375f, 3030.2734375f,
+	2905.2734375f, 2780.2734375f, 2655.2734375f, 2530.2734375f, 2405.2734375f, 2280.2734375f, 2155.2734375f, 2030.2734375f,
+	1936.5234375f, 1874.0234375f, 1811.5234375f, 1749.0234375f, 1686.5234375f, 1624.0234375f, 1561.5234375f, 1499.0234375f,
+	1436.5234375f, 1374.0234375f, 1311.5234375f, 1249.0234375f, 1186.5234375f, 1124.0234375f, 1061.5234375f, 999.0234375f,
+	952.1484375f, 920.8984375f, 889.6484375f, 858.3984375f, 827.1484375f, 795.8984375f, 764.6484375f, 733.3984375f,
+	702.1484375f, 670.8984375f, 639.6484375f, 608.3984375f, 577.1484375f, 545.8984375f, 514.6484375f, 483.3984375f,
+	459.9609375f, 444.3359375f, 428.7109375f, 413.0859375f, 397.4609375f, 381.8359375f, 366.2109375f, 350.5859375f,
+	334.9609375f, 319.3359375f, 303.7109375f, 288.0859375f, 272.4609375f, 256.8359375f, 241.2109375f, 225.5859375f,
+	213.8671875f, 206.0546875f, 198.2421875f, 190.4296875f, 182.6171875f, 174.8046875f, 166.9921875f, 159.1796875f,
+	151.3671875f, 143.5546875f, 135.7421875f, 127.9296875f, 120.1171875f, 112.3046875f, 104.4921875f, 96.6796875f,
+	90.8203125f, 86.9140625f, 83.0078125f, 79.1015625f, 75.1953125f, 71.2890625f, 67.3828125f, 63.4765625f,
+	59.5703125f, 55.6640625f, 51.7578125f, 47.8515625f, 43.9453125f, 40.0390625f, 36.1328125f, 32.2265625f,
+	29.296875f, 27.34375f, 25.390625f, 23.4375f, 21.484375f, 19.53125f, 17.578125f, 15.625f,
+	13.671875f, 11.71875f, 9.765625f, 7.8125f, 5.859375f, 3.90625f, 1.953125f, 0.0f
+};
+
+/* A-law code to sample, 16 bit linear value times 0.244140625 */
+static const float G711_ALAW_TABLE[256] = {
+	-1343.75f, -1281.25f, -1468.75f, -1406.25f, -1093.75f, -1031.25f, -1218.75f, -1156.25f,
+	-1843.75f, -1781.25f, -1968.75f, -1906.25f, -1593.75f, -1531.25f, -1718.75f, -1656.25f,
+	-671.875f, -640.625f, -734.375f, -703.125f, -546.875f, -515.625f, -609.375f, -578.125f,
+	-921.875f, -890.625f, -984.375f, -953.125f, -796.875f, -765.625f, -859.375f, -828.125f,
+	-5375.0f, -5125.0f, -5875.0f, -5625.0f, -4375.0f, -4125.0f, -4875.0f, -4625.0f,
+	-7375.0f, -7125.0f, -7875.0f, -7625.0f, -6375.0f, -6125.0f, -6875.0f, -6625.0f,
+	-2687.5f, -2562.5f, -2937.5f, -2812.5f, -2187.5f, -2062.5f, -2437.5f, -2312.5f,
+	-3687.5f, -3562.5f, -3937.5f, -3812.5f, -3187.5f, -3062.5f, -3437.5f, -3312.5f,
+	-83.984375f, -80.078125f, -91.796875f, -87.890625f, -68.359375f, -64.453125f, -76.171875f, -72.265625f,
+	-115.234375f, -111.328125f, -123.046875f, -119.140625f, -99.609375f, -95.703125f, -107.421875f, -103.515625f,
+	-21.484375f, -17.578125f, -29.296875f, -25.390625f, -5.859375f, -1.953125f, -13.671875f, -9.765625f,
+	-52.734375f, -48.828125f, -60.546875f, -56.640625f, -37.109375f, -33.203125f, -44.921875f, -41.015625f,
+	-335.9375f, -320.3125f, -367.1875f, -351.5625f, -273.4375f, -257.8125f, -304.6875f, -289.0625f,
+	-460.9375f, -445.3125f, -492.1875f, -476.5625f, -398.4375f, -382.8125f, -429.6875f, -414.0625f,
+	-167.96875f, -160.15625f, -183.59375f, -175.78125f, -136.71875f, -128.90625f, -152.34375f, -144.53125f,
+	-230.46875f, -222.65625f, -246.09375f, -238.28125f, -199.21875f, -191.40625f, -214.84375f, -207.03125f,
+	1343.75f, 1281.25f, 1468.75f, 1406.25f, 1093.75f, 1031.25f, 1218.75f, 1156.25f,
+	1843.75f, 1781.25f, 1968.75f, 1906.25f, 1593.75f, 1531.25f, 1718.75f, 1656.25f,
+	671.875f, 640.625f, 734.375f, 703.125f, 546.875f, 515.625f, 609.375f, 578.125f,
+	921.875f, 890.625f, 984.375f, 953.125f, 796.875f, 765.625f, 859.375f, 828.125f,
+	5375.0f, 5125.0f, 5875.0f, 5625.0f, 4375.0f, 4125.0f, 4875.0f, 4625.0f,
+	7375.0f, 7125.0f, 7875.0f, 7625.0f, 6375.0f, 6125.0f, 6875.0f, 6625.0f,
+	2687.5f, 2562.5f, 2937.5f, 2812.5f, 2187.5f, 2062.5f, 2437.5f, 2312.5f,
+	3687.5f, 3562.5f, 3937.5f, 3812.5f, 3187.5f, 3062.5f, 3437.5f, 3312.5f,
+	83.984375f, 80.078125f, 91.796875f, 87.890625f, 68.359375f, 64.453125f, 76.171875f, 72.265625f,
+	115.234375f, 111.328125f, 123.046875f, 119.140625f, 99.609375f, 95.703125f, 107.421875f, 103.515625f,
+	21.484375f, 17.578125f, 29.296875f, 25.390625f, 5.859375f, 1.953125f, 13.671875f, 9.765625f,
+	52.734375f, 48.828125f, 60.546875f, 56.640625f, 37.109375f, 33.203125f, 44.921875f, 41.015625f,
+	335.9375f, 320.3125f, 367.1875f, 351.5625f, 273.4375f, 257.8125f, 304.6875f, 289.0625f,
+	460.9375f, 445.3125f, 492.1875f, 476.5625f, 398.4375f, 382.8125f, 429.6875f, 414.0625f,
+	167.96875f, 160.15625f, 183.59375f, 175.78125f, 136.71875f, 128.90625f, 152.34375f, 144.53125f,
+	230.46875f, 222.65625f, 246.09375f, 238.28125f, 199.21875f, 191.40625f, 214.84375f, 207.03125f
+};
+
+#endif
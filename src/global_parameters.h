@@ -1,6 +1,6 @@
 /*! \file global_parameters.h
  * \author Gioele Giunta, Contributor: J E
- * \version 1.3
+ * \version 1.4
  * \since 21<sup>st</sup> April 2024
  * \brief Project wide variables and definitions
  */
@@ -18,25 +18,29 @@
 
 #define G_MAX_AMPLITUDE 8000.0
 
-#define G_SEQUENCE_LENGTH 100
+/* Digits kept by the digit log of digit_log.h, a power of two */
+#define G_SEQUENCE_LENGTH 128
 
 #define G_PI 3.14159265358979323846
 
 #define true 1
 #define false 0
 	
+/* Tone indices reported by the detectors: 0-3 is the row (low group) or the column (high group) of the DTMF keypad */
+#define G_TONE_NONE -1	/* No tone of the group above the threshold */
+#define G_TONE_MULTI -2	/* More than one tone of the group, not a DTMF signal */
 
  typedef struct struct_tone_frequencies
 {
-    int low;
-    int high;
+    int low;	/* Index of the low group tone, 697 770 852 941 Hz, or G_TONE_NONE / G_TONE_MULTI */
+    int high;	/* Index of the high group tone, 1209 1336 1477 1633 Hz, or G_TONE_NONE / G_TONE_MULTI */
 } struct_tone_frequencies;
 
 typedef int boolean;
 
 extern int g_scrolling;
-extern int g_scroll_offset; /* -> 2 for FFT, 3 for Goertzel */
+extern uint32_t g_scroll_offset; /* Digit log position just after the last digit shown on the LCD */
 
-extern volatile uint32_t g_systick_counter;
+extern volatile uint32_t g_systick_counter; /* Samples since reset, counted by the sample interrupt of reader.c */
 
 #endif
@@ -17,6 +17,10 @@
 
 extern const unsigned short DTMF_FRQS[DTMF_FREQ_AMT];
 
+/* Block length of goertzel(), GTZL_BLOCK_SIZE of gtzl_coeffs.h which only gtzl.c includes: the thresholds of the
+* other detectors are scaled from it */
+extern const unsigned short GTZL_BLOCK_LENGTH;
+
 /*! \fn int goertzel (complex_g3_t* signal, double amplitudes[DTMF_FREQ_AMT]);
 * \param *signal A pointer to an array of voltage levels
 * \param amplitudes An array of amplitudes for each DTMF frequency
@@ -29,4 +33,19 @@ goertzel
 complex_g3_t* signal,
 double amplitudes[DTMF_FREQ_AMT]
 );
+
+/*! \fn int goertzel_g711 (const unsigned char* codes, const float* table, double amplitudes[DTMF_FREQ_AMT]);
+* \param *codes A pointer to an array of G.711 codes
+* \param *table The expansion table of their law, from g711_table()
+* \param amplitudes An array of amplitudes for each DTMF frequency
+* \return The outcome of a run of the function: 0 indicates that no errors have occurred.
+* \brief Same as goertzel(), with each code expanded by the table as the recursions load it.
+*/
+int
+goertzel_g711
+(
+const unsigned char* codes,
+const float* table,
+double amplitudes[DTMF_FREQ_AMT]
+);
 #endif
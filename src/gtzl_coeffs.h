@@ -0,0 +1,33 @@
+/*! \file gtzl_coeffs.h
+* \brief Goertzel coefficient tables, generated by tools/gen_gtzl_coeffs.py: do not edit
+*
+* Command: python3 tools/gen_gtzl_coeffs.py --rate 8000 --frame 512 --block 508 --tones 697,770,852,941,1209,1336,1477,1633
+* Only included by gtzl.c.
+*/
+
+#ifndef GTZL_COEFFS_H_
+#define GTZL_COEFFS_H_
+
+#define GTZL_COEFFS_SAMPLE_RATE 8000	/* Sample rate the tables were generated for */
+#define GTZL_COEFFS_FRAME_SIZE 512	/* Frame size the tables were generated for */
+#define GTZL_TONE_AMT 8	/* Number of tones */
+
+/* Tone frequencies in Hz, initialiser of DTMF_FRQS[] */
+#define GTZL_TONES {697, 770, 852, 941, 1209, 1336, 1477, 1633}
+
+/* Tables for the sample rate (8000 Hz) */
+#define GTZL_BLOCK_SIZE 508	/* Samples of the frame used by the Goertzel algorithm */
+
+/* Coefficient of each tone: 2 * cos(2 * pi * k / GTZL_BLOCK_SIZE), with the bin k = round(GTZL_BLOCK_SIZE * f / fs) */
+static const double GTZL_COEFFS[GTZL_TONE_AMT] = {
+	1.711070144817032,	/* 697 Hz, k = 44, -0.2595 bin from the tone */
+	1.643802877955917,	/* 770 Hz, k = 49, +0.1050 bin from the tone */
+	1.5702509242797098,	/* 852 Hz, k = 54, -0.1020 bin from the tone */
+	1.474090363234728,	/* 941 Hz, k = 60, +0.2465 bin from the tone */
+	1.1595031278352148,	/* 1209 Hz, k = 77, +0.2285 bin from the tone */
+	0.9928505790200526,	/* 1336 Hz, k = 85, +0.1640 bin from the tone */
+	0.7938417079657742,	/* 1477 Hz, k = 94, +0.2105 bin from the tone */
+	0.5613070370601858	/* 1633 Hz, k = 104, +0.3045 bin from the tone */
+};
+
+#endif
@@ -0,0 +1,96 @@
+/*! \file input.c
+* \brief Functions for input.h shared by the board and the host, the board part is in input_lpc.c
+*/
+
+/* C Library Headers */
+#include <string.h>
+
+/* Header */
+#include "input.h"
+
+void input_init(input_t *input)
+{
+	memset(input, 0, sizeof(*input));
+}
+
+/* Queues an event, or counts it lost when the main loop has not kept up */
+static int input_queue(input_t *input, int key, input_event_type_t type, uint32_t time)
+{
+	uint32_t head = input->head;
+	input_event_t *event;
+
+	if (head - input->tail >= INPUT_QUEUE)
+	{
+		input->overruns++;
+		return 0;
+	}
+	event = &input->events[head % INPUT_QUEUE];
+	event->key = (uint8_t)key;
+	event->type = (uint8_t)type;
+	event->time = time;
+	input->head = head + 1;
+	return 1;
+}
+
+int input_sample(input_t *input, uint32_t pressed, uint32_t time)
+{
+	uint32_t changed = pressed ^ input->stable;
+	int queued = 0;
+	int key;
+
+	/* Idle: nothing pressed, nothing bouncing */
+	if ((changed | input->stable | input->bouncing) == 0)
+	{
+		return 0;
+	}
+	for (key = 0; key < INPUT_KEY_AMT; key++)
+	{
+		uint32_t bit = 1u << key;
+
+		if (changed & bit)
+		{
+			if (++input->count[key] < INPUT_DEBOUNCE_TICKS)
+			{
+				input->bouncing |= bit;
+				continue;
+			}
+			input->count[key] = 0;
+			input->bouncing &= ~bit;
+			input->stable ^= bit;
+			if (input->stable & bit)
+			{
+				input->held[key] = INPUT_REPEAT_DELAY;
+				queued += input_queue(input, key, INPUT_PRESS, time);
+			}
+			else
+			{
+				queued += input_queue(input, key, INPUT_RELEASE, time);
+			}
+		}
+		else
+		{
+			/* A bounce that did not last */
+			input->count[key] = 0;
+			input->bouncing &= ~bit;
+			if ((input->stable & bit) && --input->held[key] == 0)
+			{
+				input->held[key] = INPUT_REPEAT_TICKS;
+				queued += input_queue(input, key, INPUT_REPEAT, time);
+			}
+		}
+	}
+	return queued;
+}
+
+int input_get(input_t *input, input_event_t *event)
+{
+	uint32_t tail = input->tail;
+
+	if (tail == input->head)
+	{
+		return 0;
+	}
+	*event = input->events[tail % INPUT_QUEUE];
+	input->tail = tail + 1;
+	return 1;
+}
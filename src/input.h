@@ -0,0 +1,129 @@
+/*! \file input.h
+* \brief Input service: debounced key events of the joystick and the on-board switch, queued for the main loop
+*
+* The keys are sampled once per scheduler tick by input_sample(), from the sample interrupt of reader.c. A key changes state only
+* after it has read the same for INPUT_DEBOUNCE_TICKS ticks in a row, which filters the contact bounce, and each
+* change is queued as an event with the time it was confirmed. A key held for INPUT_REPEAT_DELAY ticks repeats its
+* press every INPUT_REPEAT_TICKS, marked as such, for the pages that scroll while the joystick is held.
+*
+* While no key is pressed a tick costs the comparison of the sampled mask with the debounced one, and the main loop is
+* not woken at all: only a queued event posts SCHED_EVENT_INPUT. The queue has a single producer and a single
+* consumer, so input_sample() runs in the interrupt while the main loop calls input_get().
+*/
+
+#ifndef INPUT_H_
+#define INPUT_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+
+/*! \def INPUT_DEBOUNCE_TICKS
+* \brief Ticks a key has to read the same before its change is taken, 30 ms
+*/
+#define INPUT_DEBOUNCE_TICKS 3
+
+/*! \def INPUT_REPEAT_DELAY
+* \brief Ticks a key is held before its press repeats, 500 ms
+*/
+#define INPUT_REPEAT_DELAY 50
+
+/*! \def INPUT_REPEAT_TICKS
+* \brief Ticks between two repeats of a held key, 333 ms as the scrolling had
+*/
+#define INPUT_REPEAT_TICKS 33
+
+/*! \def INPUT_QUEUE
+* \brief Events that can wait for the main loop, a power of two
+*/
+#define INPUT_QUEUE 8
+
+/*! \typedef input_key_t
+* \brief Keys of the board, the bit of each in the masks given to input_sample() is 1 << key
+*/
+typedef enum input_key_t
+{
+	INPUT_KEY_UP,	/*!< Joystick up */
+	INPUT_KEY_DOWN,	/*!< Joystick down */
+	INPUT_KEY_LEFT,	/*!< Joystick left */
+	INPUT_KEY_RIGHT,	/*!< Joystick right */
+	INPUT_KEY_CENTRE,	/*!< Joystick pushed */
+	INPUT_KEY_SWITCH,	/*!< On-board switch */
+	INPUT_KEY_AMT
+} input_key_t;
+
+/*! \typedef input_event_type_t
+* \brief What happened to a key
+*/
+typedef enum input_event_type_t
+{
+	INPUT_PRESS,	/*!< Pressed */
+	INPUT_REPEAT,	/*!< Still held, repeating its press */
+	INPUT_RELEASE	/*!< Released */
+} input_event_type_t;
+
+/*! \typedef input_event_t
+* \brief A key event
+*/
+typedef struct input_event_t
+{
+	uint8_t key;	/*!< input_key_t */
+	uint8_t type;	/*!< input_event_type_t */
+	uint32_t time;	/*!< Time given to input_sample() when it was confirmed */
+} input_event_t;
+
+/*! \typedef input_t
+* \brief Debouncing state and event queue
+*/
+typedef struct input_t
+{
+	uint32_t stable;	/*!< Debounced mask of the keys pressed */
+	uint32_t bouncing;	/*!< Mask of the keys whose count is not 0 */
+	uint8_t count[INPUT_KEY_AMT];	/*!< Ticks each key has read differently from stable */
+	uint8_t held[INPUT_KEY_AMT];	/*!< Ticks until the next repeat of each pressed key */
+	input_event_t events[INPUT_QUEUE];	/*!< Queued events */
+	volatile uint32_t head;	/*!< Events queued since input_init(), only written by input_sample() */
+	volatile uint32_t tail;	/*!< Events taken by input_get() */
+	uint32_t overruns;	/*!< Events lost because the queue was full */
+} input_t;
+
+/*! \fn void input_init(input_t *input)
+* \param input The input service
+* \brief Empties the queue, all the keys released
+*/
+void input_init(input_t *input);
+
+/*! \fn int input_sample(input_t *input, uint32_t pressed, uint32_t time)
+* \param input The input service
+* \param pressed Mask of the keys reading pressed at this tick
+* \param time Time of the tick, g_systick_counter on the board
+* \returns Number of events queued at this tick
+* \brief Debounces one sample of the keys, once per tick from the interrupt
+*/
+int input_sample(input_t *input, uint32_t pressed, uint32_t time);
+
+/*! \fn int input_get(input_t *input, input_event_t *event)
+* \param input The input service
+* \param event Receives the oldest event
+* \returns 1 if an event was taken, 0 if the queue is empty
+*/
+int input_get(input_t *input, input_event_t *event);
+
+/*! \var g_input
+* \brief Input service of the board, fed by input_lpc_tick()
+*/
+extern input_t g_input;
+
+/*! \fn void input_lpc_start(void)
+* \brief Sets up the joystick and the on-board switch, board only, before reader_init()
+*/
+void input_lpc_start(void);
+
+/*! \fn void input_lpc_tick(void)
+* \brief Samples the keys into g_input and posts SCHED_EVENT_INPUT for new events, from the sample interrupt at each tick, board only
+*/
+void input_lpc_tick(void);
+
+#endif // INPUT_H_
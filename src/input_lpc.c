@@ -0,0 +1,66 @@
+/*! \file input_lpc.c
+* \brief Board part of input.h: the on-board switch woken by its edge interrupt, the joystick sampled at each tick
+*
+* The LPC4088 only raises GPIO interrupts on ports 0 and 2. The on-board switch (P2.10) has one: its falling edge
+* starts the sampling, which goes on while the switch is pressed or bouncing and stops once it has settled released.
+* The joystick is on port 5, which has none, so its five lines are read at each tick with a single read of the port,
+* the cheapest way to watch them. The debouncing, and the events, are the same for both.
+*/
+
+/* Driver Headers */
+#include <platform.h>
+#include <gpio.h>
+#include <switches.h>
+
+/* Our Headers */
+#include "input.h"
+#include "scheduler.h"
+
+#define INPUT_SWITCH_BIT (1u << INPUT_KEY_SWITCH)
+
+input_t g_input;
+static volatile int switch_edge;	/* Set by the edge interrupt, taken by the next tick */
+
+/* Falling edge of the on-board switch, in the GPIO interrupt */
+static void input_switch_edge(int sources)
+{
+	switch_edge = 1;
+}
+
+void input_lpc_start(void)
+{
+	input_init(&g_input);
+	switch_edge = 0;
+	switches_init();
+	gpio_set_mode(P_SW, PullUp);
+	gpio_set_trigger(P_SW, Falling);
+	gpio_set_callback(P_SW, input_switch_edge);
+}
+
+void input_lpc_tick(void)
+{
+	/* The joystick lines are all on one port and read low when pushed */
+	uint32_t port = ~GET_GPIO_PORT(P_SW_LT)->PIN;
+	uint32_t pressed = 0;
+
+	pressed |= ((port >> GET_PIN_INDEX(P_SW_UP)) & 1u) << INPUT_KEY_UP;
+	pressed |= ((port >> GET_PIN_INDEX(P_SW_DN)) & 1u) << INPUT_KEY_DOWN;
+	pressed |= ((port >> GET_PIN_INDEX(P_SW_LT)) & 1u) << INPUT_KEY_LEFT;
+	pressed |= ((port >> GET_PIN_INDEX(P_SW_RT)) & 1u) << INPUT_KEY_RIGHT;
+	pressed |= ((port >> GET_PIN_INDEX(P_SW_CR)) & 1u) << INPUT_KEY_CENTRE;
+
+	/* The edge is taken before the line is read, so an edge arriving after the read is seen at the next tick */
+	if (switch_edge || ((g_input.stable | g_input.bouncing) & INPUT_SWITCH_BIT))
+	{
+		switch_edge = 0;
+		if (switch_get(P_SW))
+		{
+			pressed |= INPUT_SWITCH_BIT;
+		}
+	}
+
+	if (input_sample(&g_input, pressed, g_systick_counter))
+	{
+		sched_post(SCHED_EVENT_INPUT);
+	}
+}
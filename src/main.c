@@ -23,138 +23,388 @@
 /* + EEPROM Inclusions */
 #include "eeprom_g3.h"
 #include "eeprom.h"
+#include "config_g3.h"
 /* + Reader Inclusions */
 #include "reader.h"
-/* + FFT Inclusions */
-#include "fft.h"
-#include "decoder.h"
-/* + Goertzel Inclusions */
-#include "gtzl.h"
-#include "decoder_gtzl.h"
+#include "auto_calibrate.h"
+/* + Detector Inclusions */
+#include "detector.h"
+#include "detector_sdft.h"
 /* + Comparator Inclusions */
 #include "frequencies_comparator.h"
+/* + Caller ID Inclusions */
+#include "fsk_cid.h"
 /* + User Helper Interfaces Inclusions */
 #include "errorm.h"
 #include "algorithm_setter.h"
 #include "scroll_LCD.h"
+/* + Scheduler Inclusions */
+#include "scheduler.h"
+/* + Self-Test Inclusions */
+#include "self_test.h"
+/* + Capture Inclusions */
+#include "capture.h"
+/* + Input Inclusions */
+#include "input.h"
 
 /* Variable Declarations */
-char last_char;
-char sequence[G_SEQUENCE_LENGTH];
-int algorithm;
+digit_state_t digit_state;
+digit_log_t digit_log;
+fsk_cid_t caller_id;
+const detector_t *detector;
+const detector_t *detector_next; //Chosen on the settings page, switched to at the next frame boundary
+algorithm_setter_t settings;
+uint32_t settings_dropped; //reader_dropped when the settings page was opened
+config_g3_t config;
+int config_dirty; //The record changed, written after the next frame
 int g_scrolling;
-int g_scroll_offset;
+uint32_t g_scroll_offset;
+char barge_in_key = SDFT_NO_KEY; //Key held according to the decisions of the SDFT detector
+#if SELF_TEST_ENABLE
+self_test_t self_test;
+char barge_in_onset = SDFT_NO_KEY; //Last key decided by the SDFT detector and not scored yet
+uint32_t barge_in_time; //g_systick_counter when it was decided
+#endif
 
-void setting_interrupt(int sources) {
-	status_flag = 0;
-	algorithm = algorithm_setter(algorithm);
-	write_eeprom_g3(algorithm);
-	status_flag = 1;
+/* Key changes of the SDFT detector, called from the stride task or the rest of the frame in the frame task as soon as
+ * they are decided: the LEDs turn white while a key is held, the signal a voice prompt would stop on, without waiting for the end of the frame */
+void barge_in(void *context, char key, uint32_t sample) {
+	barge_in_key = key;
+	if(key != SDFT_NO_KEY)
+	{
+		leds_set(1, 1, 1);
+#if SELF_TEST_ENABLE
+		barge_in_onset = key;
+		barge_in_time = g_systick_counter;
+#endif
+	}
+	else
+	{
+		leds_set(detector->led_red, detector->led_green, detector->led_blue);
+	}
+}
+
+/* The SDFT detector is fed while the frame is read, the reader wakes the main loop at each of its decisions for it */
+void detector_stream(void) {
+	barge_in_key = SDFT_NO_KEY;
+	reader_stride = (detector == &detector_sdft) ? SDFT_DECISION_STRIDE : 0;
+}
+
+/* Opens the settings page, which the key events and the ticks then run: the reader and the decoder never stop for it */
+void settings_open(void) {
+	if(settings.state == ALGORITHM_SETTER_CLOSED)
+	{
+		settings_dropped = reader_dropped;
+	}
+	algorithm_setter_open(&settings, detector);
+}
+
+/* Steps the settings page, once it closes shows the detector in use and the frames dropped while it was open */
+void settings_tick(void) {
+	char text[48];
+	char line[17];
+
+	algorithm_setter_tick(&settings);
+	if(settings.state == ALGORITHM_SETTER_CLOSED)
+	{
+		sprintf(text, "%s DROP %lu", detector->name, (unsigned long)(reader_dropped - settings_dropped));
+		sprintf(line, "%-16.16s", text);
+		print_bottom(line);
+		sched_post(SCHED_EVENT_DISPLAY);
+	}
+}
+
+/* Switches to the detector chosen on the settings page, between two frames so that each frame is decoded whole by one */
+void detector_switch(void) {
+	detector = detector_next;
+	detector_next = NULL;
+	detector->init();
+	detector_stream();
+#if CAPTURE_ENABLE
+	capture_detector_init();
+#endif
+	config_g3_capture(&config, detector->id);
+	config_dirty = 1;
+}
+
+/* Shows on the top row the up to 16 digits of the log that end at position end */
+void print_digits(uint32_t end){
+	char window[17];
+
+	digit_log_window(&digit_log, end, 16, window);
+	print_top(window);
+}
+
+/* Shows the caller on the bottom row: the name if it was sent, else the number, else why neither is available */
+void print_caller_id(const fsk_cid_message_t *message){
+	char line[17];
+	const char *text = message->name[0] ? message->name : message->number;
+
+	if(text[0] == '\0')
+	{
+		text = (message->number_absent == 'P' || message->name_absent == 'P') ? "PRIVATE" : "UNAVAILABLE";
+	}
+	sprintf(line, "%-16.16s", text);
+	print_bottom(line);
 }
 
+#if SELF_TEST_ENABLE
+/* Scores the frame against the digits played on the DAC and shows the outcome of each digit on the bottom row:
+ * its latency or a miss, the misses so far and the duty cycle of the core */
+void self_test_frame(int comparator_return){
+	char text[48];
+	char line[17];
+	uint32_t now = g_systick_counter;
+	uint32_t duty = sched_stats()->duty_permille / 10;
+
+	if(self_test_expire(&self_test, now) > 0)
+	{
+		sprintf(text, "MISS M%lu C%lu%%", (unsigned long)self_test.missed, (unsigned long)duty);
+	}
+	else if(comparator_return != 1)
+	{
+		return;
+	}
+	/* With the SDFT detector the latency runs to its decision, the digit is still only scored once it is confirmed */
+	else if(self_test_detected(&self_test, digit_state.key, barge_in_onset == digit_state.key ? barge_in_time : now))
+	{
+		barge_in_onset = SDFT_NO_KEY;
+		sprintf(text, "%c %lums M%lu C%lu%%", digit_state.key,
+			(unsigned long)(self_test.latency_last * 1000 / G_SAMPLE_RATE), (unsigned long)self_test.missed, (unsigned long)duty);
+	}
+	else
+	{
+		sprintf(text, "%c ??? U%lu C%lu%%", digit_state.key, (unsigned long)self_test.unexpected, (unsigned long)duty);
+	}
+	sprintf(line, "%-16.16s", text);
+	if(settings.state == ALGORITHM_SETTER_CLOSED)
+	{
+		print_bottom(line);
+	}
+}
+#endif
+
 void decoder_operations(){
 	struct_tone_frequencies tone_frequencies;
-	/* FFT Variables */
-	complex_g3_t* out;
-	/* Goertzel Variables */
-	double amplitudes_gtzl[DTMF_FREQ_AMT];
 	/* Comparator Variables */
 	int comparator_return;
 
+	/* Track the input level, the DC offset is already removed sample by sample in the reader */
+	auto_calibrate_block(array_ready, G_ARRAY_SIZE);
+	if(g_calibration.frames == CONFIG_G3_SETTLE_FRAMES)
+	{
+		/* Save the settled calibration once per boot, the write is skipped if the record did not change */
+		config_g3_capture(&config, detector->id);
+		config_dirty = 1;
+	}
 	
-	if(algorithm == 2){
-		/* FFT Code */
-		out = FFT_simple(array_ready, G_ARRAY_SIZE); // Change this to out = FFT_simple(array_ready, G_ARRAY_SIZE);
-		tone_frequencies = decode_dtmf(out);
-		leds_set(0, 0, 1);
+	/* Caller ID arrives between the rings, before any DTMF, on the same frames */
+	if(fsk_cid_process(&caller_id, array_ready, G_ARRAY_SIZE) && settings.state == ALGORITHM_SETTER_CLOSED)
+	{
+		print_caller_id(&caller_id.message);
 	}
-	if(algorithm == 3){
-		/* Goertzel Code */
-		goertzel(array_ready, amplitudes_gtzl);
-		tone_frequencies = decoder_gtzl(amplitudes_gtzl);
-		leds_set(0, 1, 1);
+
+	detector->process_frame(array_ready);
+	tone_frequencies = detector->get_tones();
+	if(barge_in_key == SDFT_NO_KEY)
+	{
+		leds_set(detector->led_red, detector->led_green, detector->led_blue);
 	}
 
-	comparator_return = frequencies_comparator(tone_frequencies, &last_char, sequence);
+	/* The gain is calibrated on the frames that carry a key */
+	if(tone_frequencies.low >= 0 && tone_frequencies.high >= 0)
+	{
+		auto_calibrate_gain(array_ready_scale);
+		/* Saved again once it has moved by a tenth, not at every step, to spare the EEPROM */
+		if(g_calibration.scale_pending && fabs(g_calibration.next_scale - config.scale) > 0.1 * config.scale)
+		{
+			config_g3_capture(&config, detector->id);
+			config.scale = (float)g_calibration.next_scale;
+			config_dirty = 1;
+		}
+	}
+
+	comparator_return = frequencies_comparator(tone_frequencies, &digit_state, &digit_log);
 
 	if(comparator_return)
 	{
 		if(g_scrolling){
-			print_top(sequence);
-			g_scroll_offset = strlen(sequence);
+			g_scroll_offset = digit_log_end(&digit_log);
+			sched_post(SCHED_EVENT_DISPLAY);
 		}
 	}
-	if(comparator_return == -1)
-	/* Overflow detected */
+	if(comparator_return == -2 && settings.state == ALGORITHM_SETTER_CLOSED)
+	/* MultiTone detecting, not shown over the settings page */
 	{
-		status_flag = 0; //Stop the reader to give time to emptying the sequence
-		lcd_clear();
-		strcpy(sequence, ""); //Emptying string
-		status_flag = 1;
-		g_scroll_offset = 0;
 		printError();
 	}
-	if(comparator_return == -2)
-	/* MultiTone detecting */
+#if SELF_TEST_ENABLE
+	self_test_frame(comparator_return);
+#endif
+}
+
+void frame_task(uint32_t events) {
+#if CAPTURE_ENABLE
+	/* Before decoding, a slow frame could let the next one complete */
+	uint16_t frame = capture_ready_frame();
+#endif
+
+	/* Taken: a frame completing from here on is a new one */
+	data_ready = 0;
+	if(detector_next != NULL)
 	{
-		printError();
+		detector_switch();
+	}
+#if CAPTURE_ENABLE
+	decoder_operations();
+	capture_decided(frame, detector->id, detector->get_tones());
+#else
+	decoder_operations();
+#endif
+	/* Right after a frame, the furthest from the next one: the erase and program of the page block for a few ms,
+	 * far less than a frame, while the sampling interrupt keeps filling the other array */
+	if(config_dirty)
+	{
+		config_dirty = 0;
+		write_eeprom_g3(&config);
 	}
 }
 
+/* The samples of the frame being read, for the SDFT detector while reader_stride is set */
+void stride_task(uint32_t events) {
+	complex_g3_t *frame;
+	int stored;
+
+	if(detector == &detector_sdft)
+	{
+		stored = reader_stored(&frame);
+		detector_sdft_stream(frame, stored);
+	}
+}
+
+/* Key events of input.h: the on-board switch opens the settings page, the joystick goes to the page shown */
+void input_task(uint32_t events) {
+	input_event_t event;
+	const detector_t *chosen;
+	int scroll_LCD_value;
+
+	while(input_get(&g_input, &event))
+	{
+		if(event.key == INPUT_KEY_SWITCH)
+		{
+			if(event.type == INPUT_PRESS)
+			{
+				settings_open();
+			}
+		}
+		else if(settings.state != ALGORITHM_SETTER_CLOSED)
+		{
+			chosen = algorithm_setter_key(&settings, &event);
+			if(chosen != NULL)
+			{
+				detector_next = chosen;
+			}
+		}
+		else
+		{
+			scroll_LCD_value = scroll_LCD_key(&digit_log, &event);
+			if(scroll_LCD_value == 1)
+			{
+				lcd_clear();
+				sched_post(SCHED_EVENT_DISPLAY);
+			}
+			else if(scroll_LCD_value == -1)
+			{
+				//Out of Bounds detecting
+				printError();
+			}
+		}
+	}
+}
+
+/* Timeouts of the LCD pages, every tick */
+void tick_task(uint32_t events) {
+	if(settings.state != ALGORITHM_SETTER_CLOSED)
+	{
+		settings_tick();
+	}
+	else
+	{
+		scroll_LCD();
+	}
+}
+
+void display_task(uint32_t events) {
+	if(settings.state == ALGORITHM_SETTER_CLOSED)
+	{
+		print_digits(g_scroll_offset);
+	}
+}
+
+/* Tasks of the main loop, run in this order when their events are pending */
+static const sched_task_t tasks[] = {
+	{SCHED_EVENT_INPUT, input_task},
+	{SCHED_EVENT_FRAME, frame_task},
+	/* After the frame task, which finishes the frame whose last stride may be pending with it */
+	{SCHED_EVENT_STRIDE, stride_task},
+	{SCHED_EVENT_TICK, tick_task},
+	{SCHED_EVENT_DISPLAY, display_task}
+};
+
 int main (void)
 {
-	int scroll_LCD_value = 0;
+	digit_state_config_t digit_timing;
+#if SELF_TEST_ENABLE
+	tone_gen_config_t self_test_sequence;
+#endif
 	g_scroll_offset = 0;
 	g_scrolling = 1;
 	/* frequencesComparator Variables */
-	last_char = 'N';
-	strcpy(sequence, "");
+	digit_state_default_config(&digit_timing);
+	digit_state_init(&digit_state, &digit_timing);
+	digit_log_init(&digit_log);
+	fsk_cid_init(&caller_id, FSK_CID_BELL202, FSK_CID_DEFAULT_LEVEL);
 	/* Initializing output */
 	lcd_init();
 	lcd_clear();
 	leds_init();
-	/* Set up debug signals */
+	/* Set up debug signals, P_DBG_MAIN is high while the core is awake */
 	gpio_set_mode(P_DBG_ISR, Output);
 	gpio_set_mode(P_DBG_MAIN, Output);
-	/* Set up on-board switch */
-	gpio_set_mode(P_SW, PullUp);
-	gpio_set_trigger(P_SW, Falling);
-	gpio_set_callback(P_SW, setting_interrupt);
+	gpio_set(P_DBG_MAIN, 1);
+	/* Before any interrupt can post an event */
+	sched_init(&sched_lpc_backend, tasks, sizeof(tasks) / sizeof(tasks[0]));
+	/* Set up the joystick and the on-board switch, sampled from the first tick of the reader */
+	input_lpc_start();
 	__enable_irq();
 	/* Initializing the EEPROM */
 	EEPROM_Init();
-	algorithm = read_eeprom_g3();
-	if(algorithm != 2 && algorithm != 3){
-		algorithm = 2; //FFT
-		write_eeprom_g3(algorithm);
+	eeprom_g3_init(&eeprom_g3_lpc_backend);
+	if(read_eeprom_g3(&config))
+	{
+		/* Warm boot: thresholds and calibration come back from the record, the reader skips seeding */
+		config_g3_apply(&config);
+	}
+	detector = detector_find(config.algorithm);
+	if(detector == NULL){
+		detector = g_detectors[0]; //FFT
 	}
+	detector->init();
+	detector_sdft_set_callback(barge_in, NULL);
+	detector_stream();
+#if CAPTURE_ENABLE
+	/* Before the first sample, so that the capture starts with the first frame */
+	capture_lpc_start();
+#endif
 	/*Initializing Reader Thread*/
 	reader_init();
-	
-	while (1)
-	{
-		/* Scroll LCD call every cycle */
-		scroll_LCD_value = scroll_LCD(sequence);
-		if(scroll_LCD_value == 1)
-		{
-			lcd_clear();
-			print_top_dynamic(sequence, g_scroll_offset);
-		}
-		else if(scroll_LCD_value == -1)
-		{	
-			//Out of Bounds detecting
-			printError();
-		}
-		
-		
-		/* Array fill progress check */
-		if (data_ready)
-		/* Checks if the array swapper has switched the array to be used */
-		{
-			/* Disable data_ready to prevent the same array being sent to the decoder */
-			data_ready = 0;	
-			/* Call the Decoding Operations */
-			decoder_operations();
-		}
-	}
+#if SELF_TEST_ENABLE
+	/* Loopback: the DAC output is wired to the ADC input, the sequence plays for as long as the board runs */
+	tone_gen_default_config(&self_test_sequence, SELF_TEST_DIGITS);
+	self_test_sequence.loop = 1;
+	self_test_init(&self_test, SELF_TEST_DEFAULT_TIMEOUT);
+	self_test_lpc_start(&self_test, &self_test_sequence);
+#endif
+	/* From here the core sleeps between events */
+	sched_run();
 }
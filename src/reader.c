@@ -10,7 +10,10 @@
 
 /* Function Headers */
 void read(void);
+void store_sample(int value);
+void adc_sample(int value);
 void swap_array(void);
+void sample_clock(void);
 void SysTick_Handler(void);
 
 /* Variable Declarations */
@@ -20,89 +23,151 @@ int current_array;  // Even for main_array, Odd for secondary_array
 complex_g3_t main_array[ARRAY_ELEMENTS];
 complex_g3_t secondary_array[ARRAY_ELEMENTS];
 volatile double vadc;
+static double frame_scale; //Scale of the frame being filled, taken from the calibration at its first sample
+double array_ready_scale; //Scale array_ready was read with, for the gain step of the main loop
 volatile int res;
 int counter, current_array, status_flag, data_ready; //data_ready is the flag
+volatile uint32_t reader_dropped; //Frames overwritten before the main loop took them
+volatile int reader_stride; //Samples between two SCHED_EVENT_STRIDE, 0 for none
 volatile uint32_t g_systick_counter;
-double max_amplitude;
-double half_amplitude;
-int calibrated;
 
 /* Function Headers */
 void read(void);
 
 /*! \fn void reader_init(void)
-* \brief Initializes the ADC, LCD, SysTick, and sets the initial memory state.
+* \brief Initializes the ADC, LCD, the sample clock, and sets the initial memory state.
 *
-* This function initializes all the initial values of the reader.
-* By initializing the systick, it causes the read function to be called as a handler of the systick.
+* This function initializes all the initial values of the reader and seeds the DC calibration from the first conversions.
+* It then starts the timer triggered conversions, or with READER_HW_TRIGGER 0 the SysTick that starts them. Either way
+* a single interrupt per sample is left running.
 */
 void reader_init(void)
 {
+	int i;
+	int32_t seed = 0;
+
 	/* Initializing Variables */
 	current_array = 0;
 	counter = 0;
 	data_ready = 0;
+	reader_dropped = 0;
 	status_flag = 1;
 	g_systick_counter = 0;
-	calibrated = 0;
-	max_amplitude = G_MAX_AMPLITUDE;
-	half_amplitude = max_amplitude/2.0;
 	adc_init();
+	/* Seed the running mean so that the very first frame is already centred, unless a warm boot restored it */
+	if (!g_calibration.seeded)
+	{
+		for (i = 0; i < AUTO_CAL_SEED_SAMPLES; i++)
+		{
+			seed += adc_read();
+		}
+		auto_calibrate_init((int)(seed / AUTO_CAL_SEED_SAMPLES));
+	}
 	/* Set initial array to the main_array */
 	swap_array();
-	/* Initializing Systick -> Systick instead of Timer to reduce Code Complexity */
+#if READER_HW_TRIGGER
+	/* The conversions start on the timer edge, so the sample clock does not depend on the interrupt latency */
+	adc_start_triggered(SAMPLE_RATE, adc_sample);
+#else
+	/* Initializing Systick -> the sampling clock */
 	SysTick_Config(SystemCoreClock / SAMPLE_RATE);
+#endif
 }
 
+/*! \fn void sample_clock(void)
+* \brief Work of every sample that does not depend on its value, from the sample interrupt.
+*
+* It increments the g_systick_counter, samples the keys of input.h and posts the tick event every SCHED_TICK_SAMPLES
+* samples, and lights the red LED while reading is blocked.
+*/
+void sample_clock(void)
+{
+	g_systick_counter++;
+	/* Debounces the keys and wakes the main loop for the timeouts */
+	if(g_systick_counter % SCHED_TICK_SAMPLES == 0)
+	{
+		input_lpc_tick();
+		sched_post(SCHED_EVENT_TICK);
+	}
+	if(!status_flag)
+	{
+		leds_set(1, 0, 0);
+	}
+}
+
+#if READER_HW_TRIGGER
+/*! \fn void adc_sample(int value)
+* \brief Conversion complete callback of the timer triggered ADC, the only interrupt of the sample clock.
+*
+* It keeps the sample clock with sample_clock() and stores the sample unless reading is blocked.
+*/
+void adc_sample(int value)
+{
+	sample_clock();
+	if(status_flag)
+	{
+		store_sample(value);
+	}
+}
+#else
 /*! \fn void SysTick_Handler(void)
-* \brief Interrupt handler for the SysTick timer.
+* \brief Interrupt handler for the SysTick timer, the sample clock without READER_HW_TRIGGER.
 *
-* This function is the interrupt handler for the SysTick timer. 
-* It increments the g_systick_counter and calls the read() function. 
-* Prefer to use SysTick instead of Timer to reduce complexity of the assembly.
+* It keeps the sample clock with sample_clock() and calls the read() function unless reading is blocked.
 */
 void SysTick_Handler(void)
 {
-  g_systick_counter++;
+	sample_clock();
 	if(status_flag)
 	{
 		read();
 	}
-	else
-	{
-		leds_set(1, 0, 0);
-	}
 }
+#endif
 
 /*! \fn void read(void)
-* \brief Reads the analog value from the ADC, stores it in the current data array, and checks if the array is full.
+* \brief Starts a conversion, waits for it and stores the result with store_sample(), used without READER_HW_TRIGGER.
+*/
+void read(void)
+{
+	/* Read from adc.c */
+	store_sample(adc_read());
+}
+
+/*! \fn void store_sample(int value)
+* \brief Stores a conversion result in the current data array, and checks if the array is full.
 *
-* This function reads the analog value from the ADC, stores it in the current data array, and checks if the array is full. 
+* This function stores the conversion result in the current data array, and checks if the array is full. 
 * If so, it sets the global flag to true and the global array with the actual array. It also swaps the actual arrays and resets the counter.
-* If the mask is not calibrated, the function calls the mask_calibrate() function to calibrate the mask. 
-* Otherwise, it stores the analog value in the current data array.
+* The DC offset is removed by auto_calibrate_sample(), which also updates the running estimate, so every sample is stored
+* from power-on without any user interaction.
 * Using the SysTick timer can lead to a misalignment between the advancement of the reader function and the while reading of the caller function outside.
 * To avoid this issue, the function sets the data_ready flag to true, which will be disabled by the main function, and sets the array_ready pointer to the current array,
-* allowing the modification of current_data without affecting the main function.
+* allowing the modification of current_data without affecting the main function. A full array also posts SCHED_EVENT_FRAME.
+* A frame that completes while data_ready is still set means the previous one was never taken, it is counted in reader_dropped.
 */
-void read(void)
+void store_sample(int value)
 {
-	/* Read from adc.c */
-	res = adc_read(); 
-	vadc = (((double)res * (double)max_amplitude) / ADC_MASK)-half_amplitude; //Read Removed the mask to have more detailed data
-	
-	/*If Mask is not calibrated call mask_calibrate */
-	if(!calibrated)
+	if(counter == 0)
 	{
-		mask_calibrate(max_amplitude, half_amplitude, (double)res, (double)vadc);
-		leds_set(0, 1, 0);
+		/* A new gain only applies from the start of a frame */
+		frame_scale = auto_calibrate_frame_scale();
 	}
-	else
+#if CAPTURE_ENABLE
+	/* The raw code, before the calibration moves on, for a bit exact replay on the host */
+	capture_sample(value, counter);
+#endif
+	res = value;
+	vadc = (double)auto_calibrate_sample(res) * frame_scale; //Centred on the running DC estimate
+	
+	/* Push inside the linked current_data array */
+	current_data[counter].re = (double)vadc; 
+	current_data[counter].im = (double)0.0;
+	counter++;
+	if(reader_stride != 0 && counter % reader_stride == 0)
 	{
-		/* Push inside the linked current_data array */
-		current_data[counter].re = (double)vadc; 
-		current_data[counter].im = (double)0.0;
-		counter++;
+		/* The end of the frame posts it as well, a divisor of ARRAY_ELEMENTS lines the strides up with the frames */
+		sched_post(SCHED_EVENT_STRIDE);
 	}
 	  
 	if (counter >= ARRAY_ELEMENTS)
@@ -116,14 +181,34 @@ void read(void)
 		* array_ready points to the array referenced by current_data and remains set until current_data reaches the full state again,
 		* pointing then to the new array referenced by current_data.
 		*/
+		if(data_ready)
+		{
+			reader_dropped++;
+		}
 		data_ready = 1;
 		array_ready = current_data;
+		array_ready_scale = frame_scale;
+		sched_post(SCHED_EVENT_FRAME);
 		current_array++;
 		swap_array();
 		counter = 0;
     }
 }
 
+/*! \fn int reader_stored(complex_g3_t **frame)
+* \brief Takes the array being filled and its count with the sample interrupt masked.
+*/
+int reader_stored(complex_g3_t **frame)
+{
+	int stored;
+
+	__disable_irq();
+	*frame = current_data;
+	stored = counter;
+	__enable_irq();
+	return stored;
+}
+
 /*! \fn void swap_array(void)
 * \brief Swaps the main and secondary data arrays.
 *
@@ -8,8 +8,9 @@
 * 1. Periodically read the analog value from a specific pin (assumed to be pin 15).
 * 2. Store the read values in a global data array.
 * 3. Manage the swapping of the main and secondary data arrays to provide the latest data to the main application.
-* 4. Handle the calibration of the analog mask, if necessary.
-* 5. Provide a mechanism to synchronize the reading process with the main application.
+* 4. Remove the DC offset of the input circuit using the background calibration of auto_calibrate.h.
+* 5. Provide a mechanism to synchronize the reading process with the main application: a full array posts SCHED_EVENT_FRAME.
+* 6. Post SCHED_EVENT_STRIDE every reader_stride samples, for the detectors that read the frame while it is filled.
 */
 
 #ifndef READER_H_
@@ -30,7 +31,10 @@
 #include <switches.h>
 #include <leds.h>
 #include "complex_g3.h"
-#include "mask_calibrate.h"
+#include "auto_calibrate.h"
+#include "scheduler.h"
+#include "capture.h"
+#include "input.h"
 #include "global_parameters.h"
 
 #define ARRAY_ELEMENTS G_ARRAY_SIZE
@@ -39,18 +43,34 @@
 #define SAMPLE_RATE G_SAMPLE_RATE //In Hertz
 #define VREF (3.3) //Maximum Voltage
 
+/* 1: TIMER0 starts the conversions on MAT0.1 and the ADC interrupt stores them, 0: the SysTick handler starts each
+ * conversion and waits for it. The interrupt of the sample keeps g_systick_counter and the tick event, so there is
+ * one per sample either way. */
+#define READER_HW_TRIGGER 1
+
 /* Global Variable Declarations */
 extern int data_ready; //This is shared between the main and the reader.h is the flag to determine when an array is full 
 extern complex_g3_t *array_ready; //This is shared between the main and the reader.h is the previous Array compiled 
+extern double array_ready_scale; //Scale of the calibration array_ready was read with
 extern int status_flag; //To block the reading execution
-extern int calibrated; //Give information about the state of the calibration
+extern volatile uint32_t reader_dropped; //Frames completed while data_ready was still set, so never decoded
+extern volatile int reader_stride; //Samples between two SCHED_EVENT_STRIDE, a divisor of ARRAY_ELEMENTS, 0 for none
 
 /*! \fn void reader_init(void)
-* \brief Initializes the ADC, LCD, SysTick, and sets the initial memory state.
+* \brief Initializes the ADC, LCD, the sample clock, and sets the initial memory state.
 *
-* This function initializes all the initial values of the reader.
-* By initializing the systick, it causes the read function to be called as a handler of the systick.
+* This function initializes all the initial values of the reader and seeds the DC calibration from the first conversions.
+* It then starts the timer triggered conversions, or with READER_HW_TRIGGER 0 the SysTick that starts them.
 */
 void reader_init(void);
 
+/*! \fn int reader_stored(complex_g3_t **frame)
+* \param frame Set to the array being filled
+* \return The number of samples already stored in it
+* \brief Takes the array and its count together, so that a frame completing in between cannot mix them.
+*
+* The samples returned stay valid until the frame after this one starts, the array is then filled again.
+*/
+int reader_stored(complex_g3_t **frame);
+
 #endif // READER_H
@@ -0,0 +1,70 @@
+/*! \file resampler.c
+* \brief Functions for resampler.h
+*/
+
+/* C Library Headers */
+#include <string.h>
+
+/* Header */
+#include "resampler.h"
+
+/* Generated Tables */
+#include "resampler_taps.h"
+
+#if RESAMPLER_TAPS_OUTPUT_RATE != G_SAMPLE_RATE
+	#error "resampler_taps.h does not match global_parameters.h, run python3 tools/gen_resampler_taps.py"
+#endif
+#if RESAMPLER_HALFBAND_LENGTH > RESAMPLER_HALFBAND_MAX_LENGTH
+	#error "RESAMPLER_HALFBAND_MAX_LENGTH is too small for the generated table"
+#endif
+
+/* Offset of the centre tap of the half-band filter from the newest input, odd by construction */
+#define RESAMPLER_HALFBAND_CENTRE ((RESAMPLER_HALFBAND_LENGTH - 1) / 2)
+#define RESAMPLER_HALFBAND_PAIRS ((RESAMPLER_HALFBAND_LENGTH + 1) / 4)
+
+void resampler_halfband_init(resampler_halfband_t *halfband)
+{
+	memset(halfband->history, 0, sizeof(halfband->history));
+	halfband->position = 0;
+	halfband->odd = 0;
+}
+
+int resampler_halfband_process(resampler_halfband_t *halfband, const complex_g3_t *input, int count, complex_g3_t *output)
+{
+	uint16_t position = halfband->position;
+	uint8_t odd = halfband->odd;
+	int produced = 0;
+	int i, j;
+
+	for (i = 0; i < count; i++)
+	{
+		position = (position == 0) ? (uint16_t)(RESAMPLER_HALFBAND_LENGTH - 1) : (uint16_t)(position - 1);
+		halfband->history[position] = (float)input[i].re;
+		halfband->history[position + RESAMPLER_HALFBAND_LENGTH] = (float)input[i].re;
+
+		if (odd)
+		{
+			/* Taps at the same distance on each side of the centre are equal: add the samples, multiply once */
+			const float *centre = &halfband->history[position + RESAMPLER_HALFBAND_CENTRE];
+			float sum = 0.5f * centre[0];
+
+			for (j = 0; j < RESAMPLER_HALFBAND_PAIRS; j++)
+			{
+				sum += RESAMPLER_HALFBAND_TAPS[j] * (centre[-(2 * j + 1)] + centre[2 * j + 1]);
+			}
+			output[produced].re = sum;
+			output[produced].im = 0.0;
+			produced++;
+		}
+		odd = !odd;
+	}
+
+	halfband->position = position;
+	halfband->odd = odd;
+	return produced;
+}
+
+int resampler_halfband_mults(void)
+{
+	return RESAMPLER_HALFBAND_PAIRS + 1;
+}
@@ -0,0 +1,59 @@
+/*! \file resampler.h
+* \brief Decimate-by-2 stage in front of the detectors
+*
+* A half-band filter decimates G_SAMPLE_RATE frames by 2. All DTMF energy lies below 1.7 kHz, so a detector can work
+* at half the rate on half the samples: the FFT goes down to G_ARRAY_SIZE / 2 points with the same bin spacing.
+* The conversion of other input rates to G_SAMPLE_RATE is host only, in host/resampler_poly.h.
+*
+* The filter table is generated by tools/gen_resampler_taps.py.
+*/
+
+#ifndef RESAMPLER_H_
+#define RESAMPLER_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "complex_g3.h"
+
+/*! \def RESAMPLER_HALFBAND_MAX_LENGTH
+* \brief Capacity of the half-band delay line, in taps
+*/
+#define RESAMPLER_HALFBAND_MAX_LENGTH 64
+
+/*! \typedef resampler_halfband_t
+* \brief State of the decimate-by-2 stage, kept between frames
+*/
+typedef struct resampler_halfband_t
+{
+	float history[2 * RESAMPLER_HALFBAND_MAX_LENGTH];	/*!< Delay line, written twice so that the filter always reads it in one piece */
+	uint16_t position;	/*!< Position of the newest input in the delay line */
+	uint8_t odd;	/*!< Set when the next input completes a pair and produces an output */
+} resampler_halfband_t;
+
+/*! \fn void resampler_halfband_init(resampler_halfband_t *halfband)
+* \param halfband State to reset
+* \brief Clears the delay line of the decimate-by-2 stage
+*/
+void resampler_halfband_init(resampler_halfband_t *halfband);
+
+/*! \fn int resampler_halfband_process(resampler_halfband_t *halfband, const complex_g3_t *input, int count, complex_g3_t *output)
+* \param halfband State, updated
+* \param input Samples at G_SAMPLE_RATE, only the real part is used
+* \param count Number of input samples
+* \param output Output buffer of at least (count + 1) / 2 samples at G_SAMPLE_RATE / 2
+* \returns Number of output samples written, count / 2 for an even count
+* \brief Low-pass filters and decimates one block by 2
+*
+* The filter is symmetric and every other tap is zero, so an output costs one multiplication per pair of taps.
+*/
+int resampler_halfband_process(resampler_halfband_t *halfband, const complex_g3_t *input, int count, complex_g3_t *output);
+
+/*! \fn int resampler_halfband_mults(void)
+* \returns Multiplications per output sample of the decimate-by-2 stage
+*/
+int resampler_halfband_mults(void);
+
+#endif
@@ -0,0 +1,22 @@
+/*! \file resampler_taps.h
+* \brief Half-band filter table, generated by tools/gen_resampler_taps.py: do not edit
+*
+* Command: python3 tools/gen_resampler_taps.py --pass 2200 --atten 60 --halfband-pass 1700 --halfband-atten 50 --rates 16000,44100,48000
+* Only included by resampler.c.
+*/
+
+#ifndef RESAMPLER_TAPS_H_
+#define RESAMPLER_TAPS_H_
+
+#define RESAMPLER_TAPS_OUTPUT_RATE 8000	/* Output rate the table was generated for */
+
+/* Half-band filter at 8000 Hz: 43 taps, 0-1700 Hz protected by 50 dB, centre tap 1/2 */
+#define RESAMPLER_HALFBAND_LENGTH 43
+
+/* Taps at offsets 1, 3, 5... from the centre, the same on both sides */
+static const float RESAMPLER_HALFBAND_TAPS[(RESAMPLER_HALFBAND_LENGTH + 1) / 4] = {
+	0.316619523f, -0.101765625f, 0.0567210281f, -0.0361919302f, 0.0241061276f, -0.016114367f, 0.0105494675f, -0.00661850455f,
+	0.00387355633f, -0.00202046837f, 0.000841193273f
+};
+
+#endif
@@ -0,0 +1,190 @@
+/*! \file rfc4733.c
+* \brief Functions for rfc4733.h
+*/
+
+/* Header */
+#include "rfc4733.h"
+
+/* Longest duration of a segment, the size of the duration field */
+#define RFC4733_MAX_DURATION 0xffffu
+
+/* Flags of the second byte of the event */
+#define RFC4733_END 0x80
+
+void rfc4733_init(rfc4733_t *emitter, uint32_t ssrc, uint32_t timestamp_base, rfc4733_sink_t sink, void *context)
+{
+	emitter->ssrc = ssrc;
+	emitter->payload_type = RFC4733_DEFAULT_PAYLOAD_TYPE;
+	emitter->volume = RFC4733_DEFAULT_VOLUME;
+	emitter->seq = 0;
+	emitter->timestamp_base = timestamp_base;
+	emitter->update = RFC4733_DEFAULT_UPDATE;
+	emitter->sink = sink;
+	emitter->context = context;
+	emitter->event = 0;
+	emitter->active = 0;
+	emitter->end_copies = 0;
+	emitter->start = 0;
+	emitter->duration = 0;
+	emitter->last_sent = 0;
+	emitter->packets = 0;
+	emitter->events = 0;
+}
+
+int rfc4733_event_code(char key)
+{
+	if (key >= '0' && key <= '9')
+	{
+		return key - '0';
+	}
+	switch (key)
+	{
+		case '*':
+			return 10;
+		case '#':
+			return 11;
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+			return 12 + (key - 'A');
+		default:
+			return -1;
+	}
+}
+
+/* Builds and sends one packet of the current segment */
+static void rfc4733_send(rfc4733_t *emitter, int marker, int end, uint32_t now)
+{
+	uint8_t *p = emitter->packet;
+	uint32_t timestamp = emitter->timestamp_base + emitter->start;
+
+	/* RTP version 2, no padding, extension or CSRC */
+	p[0] = 0x80;
+	p[1] = (uint8_t)((marker ? 0x80 : 0x00) | (emitter->payload_type & 0x7f));
+	p[2] = (uint8_t)(emitter->seq >> 8);
+	p[3] = (uint8_t)emitter->seq;
+	p[4] = (uint8_t)(timestamp >> 24);
+	p[5] = (uint8_t)(timestamp >> 16);
+	p[6] = (uint8_t)(timestamp >> 8);
+	p[7] = (uint8_t)timestamp;
+	p[8] = (uint8_t)(emitter->ssrc >> 24);
+	p[9] = (uint8_t)(emitter->ssrc >> 16);
+	p[10] = (uint8_t)(emitter->ssrc >> 8);
+	p[11] = (uint8_t)emitter->ssrc;
+	/* Event, E and R bits with the volume, duration */
+	p[12] = emitter->event;
+	p[13] = (uint8_t)((end ? RFC4733_END : 0x00) | (emitter->volume & 0x3f));
+	p[14] = (uint8_t)(emitter->duration >> 8);
+	p[15] = (uint8_t)emitter->duration;
+
+	emitter->seq++;
+	emitter->packets++;
+	emitter->last_sent = now;
+	emitter->sink(emitter->context, p, RFC4733_PACKET_SIZE);
+}
+
+/* Sends the end packets still due, all of them when flush is set, otherwise one per update interval */
+static void rfc4733_send_ends(rfc4733_t *emitter, uint32_t now, int flush)
+{
+	if (!flush)
+	{
+		if (emitter->end_copies > 0 && now - emitter->last_sent >= emitter->update)
+		{
+			rfc4733_send(emitter, 0, 1, now);
+			emitter->end_copies--;
+		}
+		return;
+	}
+	while (emitter->end_copies > 0)
+	{
+		rfc4733_send(emitter, 0, 1, now);
+		emitter->end_copies--;
+	}
+}
+
+/* Brings the duration to now, closing the segments that fill the duration field on the way */
+static void rfc4733_extend(rfc4733_t *emitter, uint32_t now)
+{
+	while (now - emitter->start > RFC4733_MAX_DURATION)
+	{
+		emitter->duration = RFC4733_MAX_DURATION;
+		rfc4733_send(emitter, 0, 0, now);
+		emitter->start += RFC4733_MAX_DURATION;
+	}
+	emitter->duration = now - emitter->start;
+}
+
+/* Ends the current event at sample end, the first end packet goes at once */
+static void rfc4733_end(rfc4733_t *emitter, uint32_t end, uint32_t now)
+{
+	if (!emitter->active)
+	{
+		return;
+	}
+	rfc4733_extend(emitter, end);
+	emitter->active = 0;
+	emitter->end_copies = RFC4733_END_COPIES - 1;
+	rfc4733_send(emitter, 0, 1, now);
+}
+
+/* Starts an event at sample start, confirmed at now */
+static void rfc4733_start(rfc4733_t *emitter, char key, uint32_t start, uint32_t now)
+{
+	int code = rfc4733_event_code(key);
+
+	if (code < 0)
+	{
+		return;
+	}
+	/* The end of the previous event is not left behind the new one */
+	rfc4733_send_ends(emitter, now, 1);
+	emitter->event = (uint8_t)code;
+	emitter->active = 1;
+	emitter->start = start;
+	emitter->events++;
+	rfc4733_extend(emitter, now);
+	rfc4733_send(emitter, 1, 0, now);
+}
+
+void rfc4733_digit_events(rfc4733_t *emitter, const digit_state_t *state, const digit_event_t *events, int count)
+{
+	uint32_t now = state->now;
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		if (events[i].type == DIGIT_EVENT_RELEASE)
+		{
+			rfc4733_end(emitter, events[i].end, now);
+		}
+		else if (events[i].type == DIGIT_EVENT_PRESS)
+		{
+			rfc4733_start(emitter, events[i].key, events[i].start, now);
+		}
+	}
+	if (count > 0)
+	{
+		return;
+	}
+
+	if (emitter->active)
+	{
+		/* Durations only grow while the key is seen, a frame bridged by the hysteresis waits for the key to come back */
+		if (state->phase == DIGIT_CONFIRMED && now - emitter->last_sent >= emitter->update)
+		{
+			rfc4733_extend(emitter, now);
+			rfc4733_send(emitter, 0, 0, now);
+		}
+	}
+	else
+	{
+		rfc4733_send_ends(emitter, now, 0);
+	}
+}
+
+void rfc4733_flush(rfc4733_t *emitter, uint32_t now)
+{
+	rfc4733_end(emitter, now, now);
+	rfc4733_send_ends(emitter, now, 1);
+}
@@ -0,0 +1,110 @@
+/*! \file rfc4733.h
+* \brief RFC 4733 telephone-event emitter, turns the digits of the digit state machine into RTP event packets
+*
+* Each digit becomes one event: a first packet with the marker bit when the digit is confirmed, duration updates every
+* update interval while the key is held, and an end packet, sent three times, when it is released. All the packets of
+* an event carry the RTP timestamp of its first sample and the durations are counted in samples from the digit
+* timestamps of digit_state.c, so they are exact to the frame whatever the delay before the digit was confirmed. An
+* event longer than the 16 bit duration field is cut in segments, as in section 2.5.1.3 of the RFC.
+*
+* The packets are built in a buffer of the emitter and handed to a sink, which may write them to a socket, a file or
+* a serial line: nothing is allocated while decoding.
+*/
+
+#ifndef RFC4733_H_
+#define RFC4733_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "digit_state.h"
+
+/*! \def RFC4733_PACKET_SIZE
+* \brief RTP header without CSRC and one event, the size of every packet
+*/
+#define RFC4733_PACKET_SIZE 16
+
+/*! \def RFC4733_DEFAULT_PAYLOAD_TYPE
+* \brief Dynamic payload type commonly negotiated for telephone-event
+*/
+#define RFC4733_DEFAULT_PAYLOAD_TYPE 101
+
+/*! \def RFC4733_DEFAULT_UPDATE
+* \brief Samples between two packets of an event, 50 ms as recommended
+*/
+#define RFC4733_DEFAULT_UPDATE ((G_SAMPLE_RATE * 50) / 1000)
+
+/*! \def RFC4733_DEFAULT_VOLUME
+* \brief Power level reported in the events, in -dBm0
+*/
+#define RFC4733_DEFAULT_VOLUME 10
+
+/*! \def RFC4733_END_COPIES
+* \brief Times the end packet of an event is sent
+*/
+#define RFC4733_END_COPIES 3
+
+/*! \typedef rfc4733_sink_t
+* \brief Receives each packet, which is only valid during the call
+*/
+typedef void (*rfc4733_sink_t)(void *context, const uint8_t *packet, int length);
+
+/*! \typedef rfc4733_t
+* \brief State of an emitter, one per RTP stream
+*/
+typedef struct rfc4733_t
+{
+	uint32_t ssrc;	/*!< Synchronisation source of the event stream */
+	uint8_t payload_type;	/*!< Payload type of telephone-event */
+	uint8_t volume;	/*!< Power level of the events, 0 to 63 in -dBm0 */
+	uint16_t seq;	/*!< Sequence number of the next packet */
+	uint32_t timestamp_base;	/*!< RTP timestamp of sample 0 of the digit state machine */
+	uint32_t update;	/*!< Samples between two packets of an event */
+	rfc4733_sink_t sink;	/*!< Where the packets go */
+	void *context;	/*!< Passed to the sink */
+	uint8_t event;	/*!< Event code of the current or last digit */
+	int active;	/*!< 1 while an event is going on */
+	int end_copies;	/*!< End packets still to send for the last event */
+	uint32_t start;	/*!< First sample of the current segment */
+	uint32_t duration;	/*!< Duration of the last packet, in samples */
+	uint32_t last_sent;	/*!< Sample clock when the last packet was sent */
+	uint8_t packet[RFC4733_PACKET_SIZE];	/*!< Packet being sent */
+	uint32_t packets;	/*!< Packets sent */
+	uint32_t events;	/*!< Events started */
+} rfc4733_t;
+
+/*! \fn void rfc4733_init(rfc4733_t *emitter, uint32_t ssrc, uint32_t timestamp_base, rfc4733_sink_t sink, void *context)
+* \param emitter The emitter
+* \param ssrc Synchronisation source of the event stream
+* \param timestamp_base RTP timestamp of sample 0 of the digit state machine
+* \param sink Receives the packets
+* \param context Passed to the sink
+* \brief Resets the emitter with the default payload type, volume and update interval, which may be changed after
+*/
+void rfc4733_init(rfc4733_t *emitter, uint32_t ssrc, uint32_t timestamp_base, rfc4733_sink_t sink, void *context);
+
+/*! \fn int rfc4733_event_code(char key)
+* \param key A DTMF key
+* \returns The telephone-event code of the key, 0-9, 10 for '*', 11 for '#' and 12-15 for 'A'-'D', or -1
+*/
+int rfc4733_event_code(char key);
+
+/*! \fn void rfc4733_digit_events(rfc4733_t *emitter, const digit_state_t *state, const digit_event_t *events, int count)
+* \param emitter The emitter
+* \param state The digit state machine, after the frame
+* \param events The events digit_state_update() reported for the frame
+* \param count Number of events
+* \brief Sends the packets of a frame: ends, starts and duration updates, called after each digit_state_update()
+*/
+void rfc4733_digit_events(rfc4733_t *emitter, const digit_state_t *state, const digit_event_t *events, int count);
+
+/*! \fn void rfc4733_flush(rfc4733_t *emitter, uint32_t now)
+* \param emitter The emitter
+* \param now Sample clock of the digit state machine
+* \brief Ends the current event at now and sends every end packet still due, when the stream stops
+*/
+void rfc4733_flush(rfc4733_t *emitter, uint32_t now);
+
+#endif // RFC4733_H_
@@ -0,0 +1,114 @@
+/*! \file scheduler.c
+* \brief Functions for scheduler.h
+*/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "scheduler.h"
+
+static const sched_backend_t *backend = NULL;
+static const sched_task_t *task_table = NULL;
+static int task_count = 0;
+static volatile uint32_t pending = 0;
+static sched_stats_t stats;
+
+/* Duty cycle window, opened by the first step so that the time base may be started after sched_init() */
+static int window_open = 0;
+static uint32_t window_start = 0;
+static uint32_t window_asleep = 0;
+
+void sched_init(const sched_backend_t *platform, const sched_task_t *tasks, int count)
+{
+	uint32_t state;
+
+	backend = platform;
+	task_table = tasks;
+	task_count = count;
+	memset(&stats, 0, sizeof(stats));
+	stats.duty_permille = 1000;
+
+	state = backend->lock();
+	pending = 0;
+	window_open = 0;
+	backend->unlock(state);
+}
+
+void sched_post(uint32_t events)
+{
+	uint32_t state = backend->lock();
+
+	pending |= events;
+	backend->unlock(state);
+}
+
+/* Closes the duty cycle window once it is a second long, called locked */
+static void sched_window(uint32_t now)
+{
+	uint32_t elapsed = now - window_start;
+
+	if (elapsed < backend->cycles_per_second)
+	{
+		return;
+	}
+	/* Divided first, a second of cycles times 1000 does not fit in 32 bits */
+	stats.duty_permille = (elapsed - window_asleep) / (elapsed / 1000);
+	stats.windows++;
+	window_start = now;
+	window_asleep = 0;
+}
+
+uint32_t sched_step(void)
+{
+	uint32_t state, events, start;
+	int i;
+
+	state = backend->lock();
+	if (!window_open)
+	{
+		window_start = backend->now();
+		window_asleep = 0;
+		window_open = 1;
+	}
+	if (pending == 0)
+	{
+		start = backend->now();
+		backend->sleep();
+		window_asleep += backend->now() - start;
+		stats.wakeups++;
+	}
+	/* The handler that woke the core runs at unlock(), its event is taken on the next step */
+	events = pending;
+	pending = 0;
+	sched_window(backend->now());
+	backend->unlock(state);
+
+	for (i = 0; i < SCHED_EVENT_AMT; i++)
+	{
+		if (events & (1u << i))
+		{
+			stats.runs[i]++;
+		}
+	}
+	for (i = 0; i < task_count; i++)
+	{
+		if (events & task_table[i].events)
+		{
+			task_table[i].run(events & task_table[i].events);
+		}
+	}
+	return events;
+}
+
+void sched_run(void)
+{
+	while (1)
+	{
+		sched_step();
+	}
+}
+
+const sched_stats_t *sched_stats(void)
+{
+	return &stats;
+}
@@ -0,0 +1,98 @@
+/*! \file scheduler.h
+* \brief Event driven main loop: the core sleeps until an interrupt posts an event, then runs the tasks waiting for it
+*
+* Interrupt handlers post events with sched_post(). sched_step() takes all the pending events at once, or sleeps
+* until there is one, and runs the tasks of the table whose mask matches, in table order; events posted by the tasks
+* themselves are taken on the next step. An event posted several times before it is taken runs its tasks once.
+*
+* The time asleep is measured around each sleep and gives the duty cycle, the share of time the core is awake,
+* over windows of one second. The board backend also drives P_DBG_MAIN high while the core is awake.
+*/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Events */
+#define SCHED_EVENT_FRAME (1u << 0)	/* A frame of G_ARRAY_SIZE samples is ready, posted by the reader */
+#define SCHED_EVENT_INPUT (1u << 1)	/* A debounced key event of input.h is queued */
+#define SCHED_EVENT_TICK (1u << 2)	/* Every SCHED_TICK_SAMPLES samples, for the timeouts of the LCD pages */
+#define SCHED_EVENT_DISPLAY (1u << 3)	/* The LCD needs to be redrawn */
+#define SCHED_EVENT_STRIDE (1u << 4)	/* Every reader_stride samples of the frame being read, posted by the reader */
+#define SCHED_EVENT_AMT 5
+
+/*! \def SCHED_TICK_SAMPLES
+* \brief Samples between two tick events, 10 ms at 8 kHz
+*/
+#define SCHED_TICK_SAMPLES 80
+
+/*! \typedef sched_task_t
+* \brief A task and the events it runs on
+*/
+typedef struct sched_task_t
+{
+	uint32_t events;	/*!< Mask of the events the task runs on */
+	void (*run)(uint32_t events);	/*!< Called with the pending events of its mask */
+} sched_task_t;
+
+/*! \typedef sched_backend_t
+* \brief Time, interrupt masking and sleep of the platform
+*/
+typedef struct sched_backend_t
+{
+	uint32_t cycles_per_second;	/*!< Rate of now(), the length of a duty cycle window */
+	uint32_t (*now)(void);	/*!< Free running time in cycles, wrapping, only called with the interrupts masked */
+	uint32_t (*lock)(void);	/*!< Masks the interrupts that post events, returns the previous state for unlock() */
+	void (*unlock)(uint32_t state);	/*!< Restores the state returned by lock() */
+	void (*sleep)(void);	/*!< Called locked: sleeps until an interrupt is pending and returns, still locked */
+} sched_backend_t;
+
+/*! \typedef sched_stats_t
+* \brief Scheduler counters
+*/
+typedef struct sched_stats_t
+{
+	uint32_t wakeups;	/*!< Sleeps ended by an interrupt */
+	uint32_t runs[SCHED_EVENT_AMT];	/*!< Steps that took each event */
+	uint32_t duty_permille;	/*!< Share of the last complete window spent awake, in 1/1000, 1000 until one is complete */
+	uint32_t windows;	/*!< Windows completed */
+} sched_stats_t;
+
+/*! \var sched_lpc_backend
+* \brief Backend of the board: DWT cycle counter time base, PRIMASK and __WFI()
+*/
+extern const sched_backend_t sched_lpc_backend;
+
+/*! \fn void sched_init(const sched_backend_t *backend, const sched_task_t *tasks, int count)
+* \param backend Platform backend
+* \param tasks Table of the tasks, kept by the scheduler
+* \param count Number of entries of tasks
+* \brief Clears the pending events and the statistics
+*/
+void sched_init(const sched_backend_t *backend, const sched_task_t *tasks, int count);
+
+/*! \fn void sched_post(uint32_t events)
+* \param events Mask of SCHED_EVENT_ values
+* \brief Marks events as pending, from an interrupt handler or a task
+*/
+void sched_post(uint32_t events);
+
+/*! \fn uint32_t sched_step(void)
+* \returns The events handled
+* \brief Sleeps until an event is pending, unless one already is, then runs the tasks of the pending events
+*/
+uint32_t sched_step(void);
+
+/*! \fn void sched_run(void)
+* \brief Runs sched_step() forever
+*/
+void sched_run(void);
+
+/*! \fn const sched_stats_t *sched_stats(void)
+* \returns The counters, updated by sched_step()
+*/
+const sched_stats_t *sched_stats(void);
+
+#endif // SCHEDULER_H_
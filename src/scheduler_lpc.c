@@ -0,0 +1,54 @@
+/*! \file scheduler_lpc.c
+* \brief Backend of scheduler.h on the board
+*
+* The time base is the cycle counter of the DWT, free running at the core clock and wrapping like now() may, so the
+* time is read to the cycle without a timer interrupt. It is started by the first call, before the first step.
+*/
+
+/* Driver Headers */
+#include <platform.h>
+#include <gpio.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "scheduler.h"
+
+static uint32_t lpc_now(void)
+{
+	if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+	{
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CYCCNT = 0;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	}
+	return DWT->CYCCNT;
+}
+
+static uint32_t lpc_lock(void)
+{
+	uint32_t state = __get_PRIMASK();
+
+	__disable_irq();
+	return state;
+}
+
+static void lpc_unlock(uint32_t state)
+{
+	__set_PRIMASK(state);
+}
+
+/* With PRIMASK set, __WFI() still returns when an interrupt becomes pending, which closes the race with sched_post() */
+static void lpc_sleep(void)
+{
+	gpio_set(P_DBG_MAIN, 0);
+	__WFI();
+	gpio_set(P_DBG_MAIN, 1);
+}
+
+const sched_backend_t sched_lpc_backend = {
+	CLK_FREQ,
+	lpc_now,
+	lpc_lock,
+	lpc_unlock,
+	lpc_sleep
+};
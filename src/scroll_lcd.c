@@ -9,66 +9,75 @@
 #include "scroll_LCD.h"
 
 /* Variable Declarations */
-int last_tick_counter = 0;
+uint32_t last_tick_counter = 0;
 
-/*! \fn int scroll_LCD(void)
-* \param *sequence The char Array
-* \returns 1 if the scrolling operation was successful, -1 if an error occurred, 0 if auto-scrolling mode is enabled / Nothing has changed.
-* \brief Handles the scrolling of the LCD display based on user input.
+/*! \fn int scroll_LCD_key(const digit_log_t *log, const input_event_t *event)
+* \param *log The digit log shown on the LCD
+* \param *event A key event of input.h
+* \returns 1 if the scrolling operation was successful, -1 if an error occurred, 0 if the key does not scroll.
+* \brief Scrolls the LCD display by one digit for a left or right press, or repeat while the joystick is held.
 *
-* This function manages the scrolling of the LCD display when the left or right switch is pressed.
-* It updates the g_scroll_offset variable accordingly and ensures the value stays within the valid range.
-* If no switch is pressed for 3 seconds, the function enables the auto-scrolling mode.
+* It updates the g_scroll_offset variable accordingly and ensures the window stays within the digits retained by the log.
 */
-int scroll_LCD (char *sequence)
+int scroll_LCD_key (const digit_log_t *log, const input_event_t *event)
 {
-	/* In order to avoid continuos pushing of the switch, so switching too fast */
-	/* Considering a systick timed with 8000 hertz, g_systick_counter will be 8000 every second,*/
-	/* I want a break of 333ms between the pushings so systick need to be >= 2666 */
-	if((g_systick_counter - 2666) >= last_tick_counter)
+	/* Holding the joystick scrolls at the repeat rate of input.h, 333ms between two steps */
+	if(event->type == INPUT_RELEASE)
 	{
-		if (switch_get(P_SW_LT))
+		return 0;
+	}
+	if (event->key == INPUT_KEY_LEFT)
+	{
+		last_tick_counter = event->time;
+		
+		/* Keep a full window of retained digits, positions are compared by difference to survive their wrap */
+		if((int32_t)(g_scroll_offset - digit_log_first(log)) > 16)
 		{
-			last_tick_counter = g_systick_counter;
-			
-			if(g_scroll_offset > 16)
-			{
-				g_scrolling = 0;
-				g_scroll_offset--;
-				print_bottom("<-              ");
-				/* No errors occured case */
-				return 1; 
-			}
-			else
-			{
-				strcpy(error_text, "OUT BOUNDS!   ");
-				/* Errors occured case */
-				return -1;
-			}
+			g_scrolling = 0;
+			g_scroll_offset--;
+			print_bottom("<-              ");
+			/* No errors occured case */
+			return 1; 
 		}
-		if (switch_get(P_SW_RT))
+		else
 		{
-			
-			last_tick_counter = g_systick_counter;
-			
-			if(g_scroll_offset < (strlen(sequence)-1) && g_scroll_offset > 16)
-			{
-				g_scrolling = 0;
-				g_scroll_offset++; 
-				print_bottom("              ->");
-				/* No errors occured case */
-				return 1;
-			}
-			else
-			{
-				strcpy(error_text, "OUT BOUNDS!   ");
-				/* Errors occured case */
-				return -1;
-			}
+			strcpy(error_text, "OUT BOUNDS!   ");
+			/* Errors occured case */
+			return -1;
 		}
 	}
+	if (event->key == INPUT_KEY_RIGHT)
+	{
+		last_tick_counter = event->time;
+		
+		if((int32_t)(digit_log_end(log) - g_scroll_offset) > 0)
+		{
+			g_scrolling = 0;
+			g_scroll_offset++; 
+			print_bottom("              ->");
+			/* No errors occured case */
+			return 1;
+		}
+		else
+		{
+			strcpy(error_text, "OUT BOUNDS!   ");
+			/* Errors occured case */
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*! \fn int scroll_LCD(void)
+* \returns 0, auto-scrolling mode is enabled / Nothing has changed.
+* \brief Goes back to the auto-scrolling mode, called on every tick.
+*
+* If no key scrolled the display for 3 seconds, the function enables the auto-scrolling mode.
+*/
+int scroll_LCD (void)
+{
 	/* After 3 seconds so 24000 scrolling goes in AUTO scrolling mode */
-	if((g_systick_counter - 24000) >= last_tick_counter && g_scrolling == 0)
+	if((g_systick_counter - last_tick_counter) >= 24000 && g_scrolling == 0)
 	{
 		print_bottom("<-    AUTO    ->");
 		g_scrolling = 1;
@@ -24,16 +24,25 @@
 #include "lcd.h"
 #include "errorm.h"
 #include "switches.h"
+#include "digit_log.h"
+#include "input.h"
 
-/*! \fn int scroll_LCD(void)
-* \param *sequence The char Array
-* \returns 1 if the scrolling operation was successful, -1 if an error occurred, 0 if auto-scrolling mode is enabled / Nothing has changed.
-* \brief Handles the scrolling of the LCD display based on user input.
+/*! \fn int scroll_LCD_key(const digit_log_t *log, const input_event_t *event)
+* \param *log The digit log shown on the LCD
+* \param *event A key event of input.h
+* \returns 1 if the scrolling operation was successful, -1 if an error occurred, 0 if the key does not scroll.
+* \brief Scrolls the LCD display by one digit for a left or right press, or repeat while the joystick is held.
+*
+* It updates the g_scroll_offset variable accordingly and ensures the window stays within the digits retained by the log.
+*/
+int scroll_LCD_key (const digit_log_t *log, const input_event_t *event);
 
-* This function manages the scrolling of the LCD display when the left or right switch is pressed.
-* It updates the g_scroll_offset variable accordingly and ensures the value stays within the valid range.
-* If no switch is pressed for 3 seconds, the function enables the auto-scrolling mode.
+/*! \fn int scroll_LCD(void)
+* \returns 0, auto-scrolling mode is enabled / Nothing has changed.
+* \brief Goes back to the auto-scrolling mode, called on every tick.
+*
+* If no key scrolled the display for 3 seconds, the function enables the auto-scrolling mode.
 */
-int scroll_LCD (char *sequence);
+int scroll_LCD (void);
 
 #endif // SCROLL_LCD_H_
@@ -0,0 +1,228 @@
+/*! \file sdft.c
+* \brief Functions for sdft.h
+*/
+
+#include <string.h>
+
+#include "sdft.h"
+#include "dtmf_table.h"
+
+/* The twiddle factors are generated by tools/gen_sdft_tables.py for SDFT_WINDOW */
+#include "sdft_tables.h"
+
+#if SDFT_TABLES_WINDOW != SDFT_WINDOW
+	#error "sdft_tables.h does not match SDFT_WINDOW, run python3 tools/gen_sdft_tables.py"
+#endif
+
+/* Largest power ratio between the two tones of a key at its onset, 10 dB: 8 dB of twist plus the loss of a tone up to
+* 0.27 bin off its bin */
+#define SDFT_MAX_TWIST 10.0f
+
+/* Threshold divider while a key is held, 3 dB of hysteresis */
+#define SDFT_HOLD_RATIO 2.0f
+
+/* Drop of the pair power from its peak that releases a key, 6 dB: the digit has left half the window */
+#define SDFT_RELEASE_DROP 4.0f
+
+/* Power ratio to the strongest tone of its group above which a tone counts, 10 dB */
+#define SDFT_GROUP_RANGE 10.0f
+
+/* Smallest share of the window energy in the tone pair: 1 for a clean pair on its bins, 0.79 at 0.27 bin off. It also
+* waits for the tones to fill about two thirds of the window, past the onset click. */
+#define SDFT_TONE_SHARE 0.5f
+
+void sdft_init(sdft_t *sdft, double threshold)
+{
+	int i;
+	/* The thresholds are given for the Goertzel block of gtzl_coeffs.h */
+	double ratio = (double)SDFT_WINDOW / GTZL_BLOCK_LENGTH;
+
+	memset(sdft, 0, sizeof(*sdft));
+	for (i = 0; i < DTMF_FREQ_AMT; i++)
+	{
+		sdft->bin[i] = (unsigned short)((DTMF_FRQS[i] * SDFT_WINDOW + G_SAMPLE_RATE / 2) / G_SAMPLE_RATE);
+	}
+	/* A tone of amplitude A reaches (A N / 2)^2 over N samples */
+	sdft->threshold = (float)(threshold * ratio * ratio);
+	sdft->seed_count = -1;
+	sdft->tones.low = G_TONE_NONE;
+	sdft->tones.high = G_TONE_NONE;
+	sdft->key = SDFT_NO_KEY;
+}
+
+void sdft_set_callback(sdft_t *sdft, sdft_callback_t callback, void *context)
+{
+	sdft->callback = callback;
+	sdft->context = context;
+}
+
+void sdft_magnitudes(const sdft_t *sdft, float magnitudes[DTMF_FREQ_AMT])
+{
+	int k;
+
+	for (k = 0; k < DTMF_FREQ_AMT; k++)
+	{
+		magnitudes[k] = sdft->re[k] * sdft->re[k] + sdft->im[k] * sdft->im[k];
+	}
+}
+
+/* Index of the strongest tone of a group */
+static int sdft_strongest(const float *magnitudes)
+{
+	int strongest = 0;
+	int i;
+
+	for (i = 1; i < DTMF_FREQ_AMT / 2; i++)
+	{
+		if (magnitudes[i] > magnitudes[strongest])
+		{
+			strongest = i;
+		}
+	}
+	return strongest;
+}
+
+/* Index of the only tone of a group above the threshold and within SDFT_GROUP_RANGE of the strongest tone of the group,
+* G_TONE_NONE or G_TONE_MULTI. The window is too short for the plain rule of decoder_gtzl(): the leakage of a tone into
+* the next bin, 1.9 bins away, is only 15 dB down. */
+static int sdft_group(float threshold, const float *magnitudes)
+{
+	float strongest = magnitudes[sdft_strongest(magnitudes)];
+	int tone = G_TONE_NONE;
+	int i;
+
+	for (i = 0; i < DTMF_FREQ_AMT / 2; i++)
+	{
+		if (magnitudes[i] > threshold && magnitudes[i] * SDFT_GROUP_RANGE >= strongest)
+		{
+			if (tone != G_TONE_NONE)
+			{
+				return G_TONE_MULTI;
+			}
+			tone = i;
+		}
+	}
+	return tone;
+}
+
+/* Returns 1 if the held key goes on: its tones are still the strongest of their groups, above half the threshold, and
+* their power has not dropped by SDFT_RELEASE_DROP from its peak. Noise around the onset limits does not break a key
+* into several presses this way, and a loud digit is released as soon as it has left half the window. */
+static int sdft_hold(sdft_t *sdft, const float *magnitudes)
+{
+	float low = magnitudes[sdft->tones.low];
+	float high = magnitudes[DTMF_FREQ_AMT / 2 + sdft->tones.high];
+	float threshold = sdft->threshold / SDFT_HOLD_RATIO;
+
+	if (sdft_strongest(magnitudes) != sdft->tones.low || sdft_strongest(magnitudes + DTMF_FREQ_AMT / 2) != sdft->tones.high
+		|| low <= threshold || high <= threshold || SDFT_RELEASE_DROP * (low + high) < sdft->peak)
+	{
+		return 0;
+	}
+	if (low + high > sdft->peak)
+	{
+		sdft->peak = low + high;
+	}
+	return 1;
+}
+
+/* Classifies the current window and calls the callback when the key changes */
+static void sdft_decide(sdft_t *sdft)
+{
+	float magnitudes[DTMF_FREQ_AMT];
+	float low, high;
+	char key = SDFT_NO_KEY;
+
+	sdft_magnitudes(sdft, magnitudes);
+	if (sdft->key != SDFT_NO_KEY && sdft_hold(sdft, magnitudes))
+	{
+		return;
+	}
+
+	sdft->tones.low = sdft_group(sdft->threshold, magnitudes);
+	sdft->tones.high = sdft_group(sdft->threshold, magnitudes + DTMF_FREQ_AMT / 2);
+	if (sdft->tones.low >= 0 && sdft->tones.high >= 0)
+	{
+		low = magnitudes[sdft->tones.low];
+		high = magnitudes[DTMF_FREQ_AMT / 2 + sdft->tones.high];
+		/* A clean pair of amplitude A gives 2 (A N / 2)^2 against an energy of A^2 N */
+		if (low <= SDFT_MAX_TWIST * high && high <= SDFT_MAX_TWIST * low
+			&& low + high >= SDFT_TONE_SHARE * 0.5f * SDFT_WINDOW * sdft->energy)
+		{
+			key = dtmf_key_table[sdft->tones.low][sdft->tones.high];
+			sdft->peak = low + high;
+		}
+	}
+
+	if (key != sdft->key)
+	{
+		sdft->key = key;
+		if (sdft->callback != NULL)
+		{
+			sdft->callback(sdft->context, key, sdft->sample);
+		}
+	}
+}
+
+void sdft_process(sdft_t *sdft, const complex_g3_t *samples, int count)
+{
+	float x, difference, re;
+	int i, k, t;
+
+	for (i = 0; i < count; i++)
+	{
+		x = (float)samples[i].re;
+
+		/* X = (X + x[n] - x[n - N]) e^(j 2 pi k / N) */
+		difference = x - sdft->delay[sdft->head];
+		sdft->energy += x * x - sdft->delay[sdft->head] * sdft->delay[sdft->head];
+		sdft->delay[sdft->head] = x;
+		if (++sdft->head == SDFT_WINDOW)
+		{
+			sdft->head = 0;
+		}
+		for (k = 0; k < DTMF_FREQ_AMT; k++)
+		{
+			t = sdft->bin[k];
+			re = sdft->re[k] + difference;
+			sdft->re[k] = re * SDFT_COS[t] - sdft->im[k] * SDFT_SIN[t];
+			sdft->im[k] = re * SDFT_SIN[t] + sdft->im[k] * SDFT_COS[t];
+		}
+
+		/* Re-seeding: the window starting now is also transformed directly, sum of x[n0 + i] e^(-j 2 pi k i / N),
+		* which is what the recursion should hold after its last sample */
+		if (sdft->sample % (SDFT_RESEED_WINDOWS * SDFT_WINDOW) == 0)
+		{
+			sdft->seed_count = 0;
+			sdft->seed_energy = 0.0f;
+			memset(sdft->seed_phase, 0, sizeof(sdft->seed_phase));
+			memset(sdft->seed_re, 0, sizeof(sdft->seed_re));
+			memset(sdft->seed_im, 0, sizeof(sdft->seed_im));
+		}
+		if (sdft->seed_count >= 0)
+		{
+			sdft->seed_energy += x * x;
+			for (k = 0; k < DTMF_FREQ_AMT; k++)
+			{
+				t = sdft->seed_phase[k];
+				sdft->seed_re[k] += x * SDFT_COS[t];
+				sdft->seed_im[k] -= x * SDFT_SIN[t];
+				t += sdft->bin[k];
+				sdft->seed_phase[k] = (unsigned short)(t >= SDFT_WINDOW ? t - SDFT_WINDOW : t);
+			}
+			if (++sdft->seed_count == SDFT_WINDOW)
+			{
+				memcpy(sdft->re, sdft->seed_re, sizeof(sdft->re));
+				memcpy(sdft->im, sdft->seed_im, sizeof(sdft->im));
+				sdft->energy = sdft->seed_energy;
+				sdft->seed_count = -1;
+				sdft->reseeds++;
+			}
+		}
+
+		if (++sdft->sample % SDFT_DECISION_STRIDE == 0)
+		{
+			sdft_decide(sdft);
+		}
+	}
+}
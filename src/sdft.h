@@ -0,0 +1,107 @@
+/*! \file sdft.h
+* \brief Sliding DFT of the eight DTMF tones, with a decision at every few samples and a callback on each key change
+*
+* Each bin k of a window of SDFT_WINDOW samples is updated at every sample with X = (X + x[n] - x[n - N]) e^(j 2 pi k / N),
+* four multiplications, so the magnitudes always describe the last SDFT_WINDOW samples instead of a whole frame. Every
+* SDFT_DECISION_STRIDE samples the magnitudes are checked like decoder_gtzl() does, plus the twist and the share of
+* the window energy in the tone pair, and the callback is told as soon as the key changes.
+*
+* The recursion runs in single precision, for the floating point unit of the Cortex-M4, and its rounding errors do not
+* decay. Every SDFT_RESEED_WINDOWS windows the bins and the window energy are computed again directly over one window,
+* alongside the recursion, and replace its values at the end of that window.
+*/
+
+#ifndef SDFT_H_
+#define SDFT_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "complex_g3.h"
+#include "gtzl.h"
+
+/*! \def SDFT_WINDOW
+* \brief Window length, 25.6 ms: the DTMF tones are within 0.27 bin of the bins 18 20 22 24 31 34 38 42
+*/
+#define SDFT_WINDOW 205
+
+/*! \def SDFT_DECISION_STRIDE
+* \brief Samples between two decisions, 1 ms
+*/
+#define SDFT_DECISION_STRIDE 8
+
+/*! \def SDFT_RESEED_WINDOWS
+* \brief Windows between the start of two re-seedings
+*/
+#define SDFT_RESEED_WINDOWS 16
+
+/*! \def SDFT_NO_KEY
+* \brief Key passed to the callback when a key is released
+*/
+#define SDFT_NO_KEY 'N'
+
+/*! \typedef sdft_callback_t
+* \brief Called from sdft_process() when the key changes
+* \param context Pointer given to sdft_set_callback()
+* \param key The new key, or SDFT_NO_KEY
+* \param sample Number of the sample of the decision, counted from sdft_init()
+*/
+typedef void (*sdft_callback_t)(void *context, char key, uint32_t sample);
+
+/*! \typedef sdft_t
+* \brief State of a sliding DFT
+*/
+typedef struct sdft_t
+{
+	float delay[SDFT_WINDOW];	/*!< Last SDFT_WINDOW samples */
+	int head;	/*!< Oldest sample of delay[] */
+	unsigned short bin[DTMF_FREQ_AMT];	/*!< Bin of each tone */
+	float re[DTMF_FREQ_AMT], im[DTMF_FREQ_AMT];	/*!< Bins over the window */
+	float energy;	/*!< Sum of the squared samples of the window */
+	/* Re-seeding */
+	int seed_count;	/*!< Samples accumulated in the seed, -1 between re-seedings */
+	unsigned short seed_phase[DTMF_FREQ_AMT];	/*!< Index of the seed twiddle of each bin */
+	float seed_re[DTMF_FREQ_AMT], seed_im[DTMF_FREQ_AMT];	/*!< Bins being computed directly */
+	float seed_energy;	/*!< Energy being computed directly */
+	uint32_t reseeds;	/*!< Re-seedings done */
+	/* Decisions */
+	uint32_t sample;	/*!< Samples processed since sdft_init() */
+	float threshold;	/*!< Smallest magnitude squared of a tone */
+	struct_tone_frequencies tones;	/*!< Tone indices of the last decision */
+	char key;	/*!< Key of the last decision, or SDFT_NO_KEY */
+	float peak;	/*!< Highest power of the tone pair since the key was decided */
+	sdft_callback_t callback;	/*!< Called when key changes, may be NULL */
+	void *context;	/*!< Passed to the callback */
+} sdft_t;
+
+/*! \fn void sdft_init(sdft_t *sdft, double threshold)
+* \param sdft The sliding DFT
+* \param threshold Smallest magnitude squared of a tone over a window of GTZL_BLOCK_SIZE samples, as ampl_thrs
+* \brief Empties the window and clears the callback
+*/
+void sdft_init(sdft_t *sdft, double threshold);
+
+/*! \fn void sdft_set_callback(sdft_t *sdft, sdft_callback_t callback, void *context)
+* \param sdft The sliding DFT
+* \param callback Function called on each key change, NULL for none
+* \param context Passed to the callback
+*/
+void sdft_set_callback(sdft_t *sdft, sdft_callback_t callback, void *context);
+
+/*! \fn void sdft_process(sdft_t *sdft, const complex_g3_t *samples, int count)
+* \param sdft The sliding DFT
+* \param samples Centred samples at G_SAMPLE_RATE, only the real parts are read
+* \param count Number of samples
+* \brief Slides the window over the samples, deciding every SDFT_DECISION_STRIDE samples
+*/
+void sdft_process(sdft_t *sdft, const complex_g3_t *samples, int count);
+
+/*! \fn void sdft_magnitudes(const sdft_t *sdft, float magnitudes[DTMF_FREQ_AMT])
+* \param sdft The sliding DFT
+* \param magnitudes Filled with the magnitude squared of each tone over the last SDFT_WINDOW samples
+*/
+void sdft_magnitudes(const sdft_t *sdft, float magnitudes[DTMF_FREQ_AMT]);
+
+#endif // SDFT_H_
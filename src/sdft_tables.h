@@ -0,0 +1,431 @@
+/*! \file sdft_tables.h
+* \brief Sliding DFT twiddle factor tables, generated by tools/gen_sdft_tables.py: do not edit
+*
+* Command: python3 tools/gen_sdft_tables.py --window 205
+* Only included by sdft.c.
+*/
+
+#ifndef SDFT_TABLES_H_
+#define SDFT_TABLES_H_
+
+#define SDFT_TABLES_WINDOW 205	/* Window length the tables were generated for */
+
+/* cos(2 pi i / SDFT_TABLES_WINDOW) */
+static const float SDFT_COS[SDFT_TABLES_WINDOW] = {
+	1.0,
+	0.9995303351910931,
+	0.9981217819344379,
+	0.9957756633258265,
+	0.992494183143955,
+	0.9882804237803485,
+	0.9831383433439795,
+	0.9770727719432992,
+	0.9700894071491731,
+	0.9621948086429843,
+	0.9533963920549305,
+	0.9437024219983028,
+	0.9331220043062893,
+	0.9216650774785972,
+	0.9093424033459249,
+	0.8961655569610556,
+	0.8821469157260683,
+	0.8672996477658764,
+	0.8516376995590185,
+	0.8351757828373181,
+	0.8179293607667176,
+	0.7999146334222695,
+	0.7811485225709254,
+	0.7616486557764187,
+	0.7414333498411733,
+	0.7205215936007869,
+	0.6989330300872572,
+	0.6766879380776981,
+	0.6538072130458853,
+	0.630312347534518,
+	0.6062254109666381,
+	0.5815690289151657,
+	0.5563663618500301,
+	0.5306410833828534,
+	0.5044173580296264,
+	0.477719818512263,
+	0.4505735426203541,
+	0.42300402965485884,
+	0.39503717647585423,
+	0.3666992531768481,
+	0.3380168784085027,
+	0.30901699437494745,
+	0.27972684152616784,
+	0.25017393297024537,
+	0.22038602862947904,
+	0.19039110916466842,
+	0.16021734969205123,
+	0.12989309331758045,
+	0.09944682451340722,
+	0.06890714236157104,
+	0.03830273369003527,
+	0.007662346126301665,
+	-0.02298523890609054,
+	-0.05361123322280551,
+	-0.08418686892030677,
+	-0.1146834253984004,
+	-0.14507225633834475,
+	-0.17532481661118743,
+	-0.2054126890910499,
+	-0.2353076113481739,
+	-0.26498150219666156,
+	-0.2944064880719633,
+	-0.32355492921334233,
+	-0.35239944562672176,
+	-0.3809129428035227,
+	-0.4090686371713397,
+	-0.4368400812525431,
+	-0.46420118850717756,
+	-0.4911262578368233,
+	-0.5175899977263965,
+	-0.543567550001221,
+	-0.5690345131770473,
+	-0.5939669653810878,
+	-0.618341486822543,
+	-0.6421351817915025,
+	-0.6653257001655652,
+	-0.6878912584039696,
+	-0.7098106600095203,
+	-0.7310633154390838,
+	-0.7516292614439585,
+	-0.771489179821943,
+	-0.7906244155634979,
+	-0.8090169943749473,
+	-0.826649639562266,
+	-0.8435057882595883,
+	-0.8595696069872012,
+	-0.8748260065243983,
+	-0.8892606560832333,
+	-0.902859996769853,
+	-0.9156112543207674,
+	-0.9275024511020946,
+	-0.9385224173605068,
+	-0.94866080171531,
+	-0.957908080881803,
+	-0.9662555686167806,
+	-0.973695423877779,
+	-0.9802206581883992,
+	-0.98582514220279,
+	-0.9905036114631244,
+	-0.99425167134466,
+	-0.9970658011837404,
+	-0.9989433575848599,
+	-0.9998825769036815,
+	-0.9998825769036815,
+	-0.9989433575848599,
+	-0.9970658011837404,
+	-0.9942516713446599,
+	-0.9905036114631245,
+	-0.9858251422027902,
+	-0.9802206581883993,
+	-0.9736954238777791,
+	-0.9662555686167807,
+	-0.9579080808818031,
+	-0.9486608017153102,
+	-0.938522417360507,
+	-0.9275024511020945,
+	-0.9156112543207674,
+	-0.902859996769853,
+	-0.8892606560832335,
+	-0.8748260065243985,
+	-0.8595696069872013,
+	-0.8435057882595882,
+	-0.8266496395622659,
+	-0.8090169943749476,
+	-0.790624415563498,
+	-0.7714891798219432,
+	-0.7516292614439584,
+	-0.731063315439084,
+	-0.7098106600095204,
+	-0.6878912584039701,
+	-0.6653257001655657,
+	-0.6421351817915028,
+	-0.6183414868225431,
+	-0.5939669653810881,
+	-0.5690345131770476,
+	-0.5435675500012216,
+	-0.5175899977263962,
+	-0.4911262578368231,
+	-0.4642011885071778,
+	-0.4368400812525433,
+	-0.4090686371713401,
+	-0.38091294280352317,
+	-0.3523994456267214,
+	-0.3235549292133421,
+	-0.2944064880719631,
+	-0.26498150219666156,
+	-0.23530761134817393,
+	-0.2054126890910499,
+	-0.1753248166111879,
+	-0.14507225633834522,
+	-0.11468342539840087,
+	-0.08418686892030747,
+	-0.0536112332228062,
+	-0.022985238906090343,
+	0.0076623461263016415,
+	0.03830273369003525,
+	0.06890714236157057,
+	0.09944682451340676,
+	0.12989309331758087,
+	0.16021734969205143,
+	0.19039110916466861,
+	0.220386028629479,
+	0.25017393297024537,
+	0.27972684152616784,
+	0.30901699437494723,
+	0.3380168784085025,
+	0.3666992531768485,
+	0.3950371764758544,
+	0.42300402965485906,
+	0.4505735426203543,
+	0.477719818512263,
+	0.5044173580296264,
+	0.5306410833828533,
+	0.5563663618500299,
+	0.5815690289151654,
+	0.6062254109666376,
+	0.6303123475345176,
+	0.6538072130458853,
+	0.6766879380776981,
+	0.6989330300872572,
+	0.7205215936007869,
+	0.741433349841173,
+	0.7616486557764185,
+	0.781148522570925,
+	0.7999146334222692,
+	0.8179293607667173,
+	0.8351757828373176,
+	0.8516376995590185,
+	0.8672996477658763,
+	0.8821469157260682,
+	0.8961655569610555,
+	0.9093424033459246,
+	0.9216650774785969,
+	0.9331220043062891,
+	0.9437024219983025,
+	0.9533963920549303,
+	0.962194808642984,
+	0.9700894071491728,
+	0.9770727719432993,
+	0.9831383433439796,
+	0.9882804237803485,
+	0.9924941831439551,
+	0.9957756633258266,
+	0.9981217819344379,
+	0.9995303351910931
+};
+
+/* sin(2 pi i / SDFT_TABLES_WINDOW) */
+static const float SDFT_SIN[SDFT_TABLES_WINDOW] = {
+	0.0,
+	0.030644885915615216,
+	0.061260986182255374,
+	0.09181954219015805,
+	0.12229184938258741,
+	0.1526492842188745,
+	0.1828633310613567,
+	0.2129056089609609,
+	0.24274789831626936,
+	0.2723621673810273,
+	0.30172059859519235,
+	0.3307956147147923,
+	0.3595599047160478,
+	0.38798644944942523,
+	0.4160485470195244,
+	0.4437198378669597,
+	0.470974329528675,
+	0.4977864210534341,
+	0.5241309270495521,
+	0.5499831013422802,
+	0.5753186602186207,
+	0.6001138052377366,
+	0.6243452455855337,
+	0.6479902199524114,
+	0.6710265179136339,
+	0.6934325007922417,
+	0.7151871219849008,
+	0.7362699467316002,
+	0.7566611713106286,
+	0.7763416416407952,
+	0.7952928712734264,
+	0.8134970587572343,
+	0.8309371043597472,
+	0.8475966261295944,
+	0.8634599752845592,
+	0.8785122509109423,
+	0.8927393139604326,
+	0.906127800531333,
+	0.9186651344216699,
+	0.9303395389423916,
+	0.9411400479795616,
+	0.9510565162951535,
+	0.9600796290567747,
+	0.9682009105873631,
+	0.9754127323266426,
+	0.9817083199968549,
+	0.98708175996604,
+	0.9915280048028852,
+	0.9950428780179272,
+	0.9976230779866523,
+	0.99926618105081,
+	0.999970643795027,
+	0.999735804496583,
+	0.9985618837469864,
+	0.9964499842447664,
+	0.993402089759675,
+	0.9894210632692745,
+	0.9845106442696562,
+	0.9786754452628224,
+	0.9719209474240262,
+	0.964253495453141,
+	0.9556802916148961,
+	0.9462093889735765,
+	0.9358496838285405,
+	0.9246109073576626,
+	0.9125036164765501,
+	0.8995391839221188,
+	0.8857297875698456,
+	0.8710883989947278,
+	0.8556287712867006,
+	0.83936542613195,
+	0.8223136401722646,
+	0.8044894306552334,
+	0.7859095403887695,
+	0.766591422014096,
+	0.7465532216119628,
+	0.7258137616574951,
+	0.7043925233396854,
+	0.6823096282621364,
+	0.6595858195422409,
+	0.6362424423265597,
+	0.6123014237406911,
+	0.5877852522924732,
+	0.5627169567478625,
+	0.5371200844993329,
+	0.5110186794471103,
+	0.4844372594140271,
+	0.45740079311520365,
+	0.4299346767041956,
+	0.4020647099176337,
+	0.37381707184076884,
+	0.34521829631667955,
+	0.3162952470222488,
+	0.28707509223431626,
+	0.25758527930971103,
+	0.22785350890313777,
+	0.19790770894712897,
+	0.16777600841851248,
+	0.13748671091602988,
+	0.10706826807392718,
+	0.0765492528364955,
+	0.045958332618652974,
+	0.015324242377796414,
+	-0.015324242377796168,
+	-0.045958332618653175,
+	-0.07654925283649569,
+	-0.10706826807392739,
+	-0.1374867109160292,
+	-0.16777600841851179,
+	-0.19790770894712828,
+	-0.22785350890313752,
+	-0.2575852793097108,
+	-0.28707509223431565,
+	-0.31629524702224815,
+	-0.34521829631667894,
+	-0.37381707184076907,
+	-0.4020647099176339,
+	-0.4299346767041954,
+	-0.45740079311520343,
+	-0.4844372594140269,
+	-0.5110186794471101,
+	-0.537120084499333,
+	-0.5627169567478627,
+	-0.587785252292473,
+	-0.6123014237406909,
+	-0.6362424423265596,
+	-0.659585819542241,
+	-0.6823096282621361,
+	-0.7043925233396852,
+	-0.7258137616574947,
+	-0.7465532216119624,
+	-0.7665914220140959,
+	-0.7859095403887694,
+	-0.8044894306552333,
+	-0.8223136401722645,
+	-0.8393654261319496,
+	-0.8556287712867007,
+	-0.8710883989947279,
+	-0.8857297875698454,
+	-0.8995391839221187,
+	-0.9125036164765499,
+	-0.9246109073576625,
+	-0.9358496838285406,
+	-0.9462093889735765,
+	-0.9556802916148962,
+	-0.964253495453141,
+	-0.9719209474240262,
+	-0.9786754452628224,
+	-0.9845106442696561,
+	-0.9894210632692744,
+	-0.993402089759675,
+	-0.9964499842447663,
+	-0.9985618837469864,
+	-0.999735804496583,
+	-0.999970643795027,
+	-0.99926618105081,
+	-0.9976230779866524,
+	-0.9950428780179272,
+	-0.9915280048028852,
+	-0.98708175996604,
+	-0.9817083199968549,
+	-0.9754127323266426,
+	-0.9682009105873631,
+	-0.9600796290567748,
+	-0.9510565162951536,
+	-0.9411400479795616,
+	-0.9303395389423915,
+	-0.9186651344216699,
+	-0.9061278005313329,
+	-0.8927393139604326,
+	-0.8785122509109423,
+	-0.8634599752845592,
+	-0.8475966261295946,
+	-0.8309371043597473,
+	-0.8134970587572345,
+	-0.7952928712734267,
+	-0.7763416416407956,
+	-0.7566611713106285,
+	-0.7362699467316002,
+	-0.7151871219849008,
+	-0.6934325007922418,
+	-0.6710265179136341,
+	-0.6479902199524117,
+	-0.6243452455855343,
+	-0.600113805237737,
+	-0.5753186602186212,
+	-0.549983101342281,
+	-0.5241309270495521,
+	-0.49778642105343424,
+	-0.47097432952867524,
+	-0.44371983786696,
+	-0.4160485470195248,
+	-0.3879864494494258,
+	-0.3595599047160485,
+	-0.33079561471479313,
+	-0.3017205985951932,
+	-0.2723621673810283,
+	-0.24274789831627047,
+	-0.2129056089609604,
+	-0.1828633310613563,
+	-0.1526492842188742,
+	-0.12229184938258723,
+	-0.09181954219015798,
+	-0.0612609861822554,
+	-0.030644885915615355
+};
+
+#endif
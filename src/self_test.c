@@ -0,0 +1,83 @@
+/*! \file self_test.c
+* \brief Functions for self_test.h, the board part is in self_test_lpc.c
+*/
+
+/* C Library Headers */
+#include <string.h>
+
+/* Header */
+#include "self_test.h"
+
+void self_test_init(self_test_t *test, uint32_t timeout)
+{
+	memset(test, 0, sizeof(*test));
+	test->timeout = timeout;
+}
+
+void self_test_played(self_test_t *test, char key, uint32_t time)
+{
+	uint32_t head = test->head;
+
+	if (head - test->tail >= SELF_TEST_QUEUE)
+	{
+		test->overruns++;
+		return;
+	}
+	test->keys[head % SELF_TEST_QUEUE] = key;
+	test->starts[head % SELF_TEST_QUEUE] = time;
+	/* The entry is written before the consumer can see it */
+	test->head = head + 1;
+}
+
+int self_test_detected(self_test_t *test, char key, uint32_t time)
+{
+	uint32_t head = test->head;
+	uint32_t tail = test->tail;
+	uint32_t i, latency;
+
+	/* The oldest digit of the key that had started by then, the times wrap so they are compared by difference */
+	for (i = tail; i != head; i++)
+	{
+		if ((int32_t)(time - test->starts[i % SELF_TEST_QUEUE]) < 0)
+		{
+			break;
+		}
+		if (test->keys[i % SELF_TEST_QUEUE] != key)
+		{
+			continue;
+		}
+		latency = time - test->starts[i % SELF_TEST_QUEUE];
+		test->missed += i - tail;
+		test->detected++;
+		test->latency_last = latency;
+		if (test->detected == 1 || latency < test->latency_min)
+		{
+			test->latency_min = latency;
+		}
+		if (latency > test->latency_max)
+		{
+			test->latency_max = latency;
+		}
+		test->latency_sum += latency;
+		test->tail = i + 1;
+		return 1;
+	}
+	test->unexpected++;
+	return 0;
+}
+
+int self_test_expire(self_test_t *test, uint32_t now)
+{
+	uint32_t head = test->head;
+	uint32_t tail = test->tail;
+	int missed = 0;
+
+	while (tail != head && (int32_t)(now - test->starts[tail % SELF_TEST_QUEUE]) > (int32_t)test->timeout)
+	{
+		tail++;
+		missed++;
+	}
+	test->missed += missed;
+	test->tail = tail;
+	return missed;
+}
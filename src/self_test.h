@@ -0,0 +1,104 @@
+/*! \file self_test.h
+* \brief Loopback self-test: scores the digits decoded from the ADC against the digits the tone generator played
+*
+* The board plays a looping sequence of tone_gen.h on the DAC, wired back to the ADC input, and the main loop runs its
+* usual decoding on what comes back. Each digit the generator starts is queued with its time, each digit the state
+* machine confirms is matched with the oldest queued digit of the same key: the difference of the two times is the end
+* to end detection latency, which includes the frame length, the confirmation time of digit_state.c and the wait for
+* the main loop. A queued digit that is not matched within the timeout is a miss, a confirmed digit that matches none
+* is unexpected.
+*
+* The times are in any unit common to both ends, the samples of g_systick_counter on the board and the sample index
+* of the generator on the host. The queue has a single producer and a single consumer, so self_test_played() can be
+* called from the DAC interrupt while the main loop calls the other functions.
+*/
+
+#ifndef SELF_TEST_H_
+#define SELF_TEST_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "tone_gen.h"
+
+/*! \def SELF_TEST_ENABLE
+* \brief 1: the firmware plays SELF_TEST_DIGITS on the DAC and shows the result of each digit on the bottom row
+*/
+#define SELF_TEST_ENABLE 0
+
+/*! \def SELF_TEST_DIGITS
+* \brief Sequence played in a loop by the board
+*/
+#define SELF_TEST_DIGITS "1234567890*#ABCD"
+
+/*! \def SELF_TEST_QUEUE
+* \brief Digits played and not matched yet that can be queued, a power of two
+*/
+#define SELF_TEST_QUEUE 16
+
+/*! \def SELF_TEST_DEFAULT_TIMEOUT
+* \brief Samples after the start of a digit after which it is counted as missed, 500 ms
+*/
+#define SELF_TEST_DEFAULT_TIMEOUT ((G_SAMPLE_RATE * 500) / 1000)
+
+/*! \typedef self_test_t
+* \brief Queue of the digits played and the scores
+*/
+typedef struct self_test_t
+{
+	char keys[SELF_TEST_QUEUE];	/*!< Keys played */
+	uint32_t starts[SELF_TEST_QUEUE];	/*!< Times they started at */
+	volatile uint32_t head;	/*!< Digits queued since self_test_init(), only written by self_test_played() */
+	volatile uint32_t tail;	/*!< Digits taken out of the queue, matched or missed */
+	uint32_t timeout;	/*!< Time after which a digit is missed */
+	uint32_t overruns;	/*!< Digits played while the queue was full, not queued */
+	uint32_t detected;	/*!< Digits matched */
+	uint32_t missed;	/*!< Digits not matched in time */
+	uint32_t unexpected;	/*!< Digits confirmed that matched none played */
+	uint32_t latency_last;	/*!< Latency of the last digit matched */
+	uint32_t latency_min;	/*!< Smallest latency, 0 until a digit is matched */
+	uint32_t latency_max;	/*!< Largest latency */
+	uint32_t latency_sum;	/*!< Sum of the latencies, for the mean */
+} self_test_t;
+
+/*! \fn void self_test_init(self_test_t *test, uint32_t timeout)
+* \param test The test, emptied
+* \param timeout Time after which a digit played is missed, SELF_TEST_DEFAULT_TIMEOUT in samples
+*/
+void self_test_init(self_test_t *test, uint32_t timeout);
+
+/*! \fn void self_test_played(self_test_t *test, char key, uint32_t time)
+* \param test The test
+* \param key Key the generator started
+* \param time Time of its first sample
+* \brief Queues a digit played, may be called from an interrupt
+*/
+void self_test_played(self_test_t *test, char key, uint32_t time);
+
+/*! \fn int self_test_detected(self_test_t *test, char key, uint32_t time)
+* \param test The test
+* \param key Key of the digit confirmed
+* \param time Time it was confirmed at
+* \returns 1 if it matched a digit played, whose latency is then in latency_last, 0 if it is unexpected
+* \brief Scores a digit confirmed, the digits played before the one it matches are missed
+*/
+int self_test_detected(self_test_t *test, char key, uint32_t time);
+
+/*! \fn int self_test_expire(self_test_t *test, uint32_t now)
+* \param test The test
+* \param now Current time
+* \returns The number of digits that became missed
+* \brief Counts the digits played longer than the timeout ago as missed, called once per frame
+*/
+int self_test_expire(self_test_t *test, uint32_t now);
+
+/*! \fn void self_test_lpc_start(self_test_t *test, const tone_gen_config_t *config)
+* \param test Initialised test, fed from the DAC interrupt with the digits played
+* \param config Sequence to play
+* \brief Starts the generator on the DAC, one sample per G_SAMPLE_RATE period of timer 1, board only
+*/
+void self_test_lpc_start(self_test_t *test, const tone_gen_config_t *config);
+
+#endif // SELF_TEST_H_
@@ -0,0 +1,54 @@
+/*! \file self_test_lpc.c
+* \brief Board part of self_test.h: the tone generator on the DAC, fed by timer 1
+*
+* Timer 0 already starts the ADC conversions, so the DAC runs on timer 1 at the same rate from the same peripheral
+* clock, and the two cannot drift apart. The interrupt takes the next sample of the generator, queues a digit as it
+* starts with the time of g_systick_counter, the same clock the main loop reads when a digit is confirmed, and writes
+* the sample centred on mid-scale of the DAC.
+*/
+
+/* Driver Headers */
+#include <platform.h>
+#include <dac.h>
+#include <timer.h>
+
+/* Our Headers */
+#include "self_test.h"
+
+/* Mid-scale code of the DAC, and the shift from a tone_gen_next() sample to DAC codes */
+#define SELF_TEST_DAC_MID (1 << (DAC_BITS - 1))
+#define SELF_TEST_DAC_SHIFT (16 - DAC_BITS)
+
+static tone_gen_t generator;
+static self_test_t *loopback;
+static uint32_t digits_queued;
+
+static void self_test_dac_sample(void)
+{
+	int32_t code = SELF_TEST_DAC_MID + (tone_gen_next(&generator) >> SELF_TEST_DAC_SHIFT);
+
+	if (generator.digits != digits_queued)
+	{
+		digits_queued = generator.digits;
+		self_test_played(loopback, generator.key, g_systick_counter);
+	}
+	if (code < 0)
+	{
+		code = 0;
+	}
+	else if (code > (int32_t)DAC_MASK)
+	{
+		code = DAC_MASK;
+	}
+	dac_set((int)code);
+}
+
+void self_test_lpc_start(self_test_t *test, const tone_gen_config_t *config)
+{
+	loopback = test;
+	digits_queued = 0;
+	tone_gen_init(&generator, config);
+	dac_init();
+	dac_set(SELF_TEST_DAC_MID);
+	timer_start_periodic(G_SAMPLE_RATE, self_test_dac_sample);
+}
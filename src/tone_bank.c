@@ -0,0 +1,313 @@
+/*! \file tone_bank.c
+* \brief Functions for tone_bank.h
+*/
+
+/* Header */
+#include "tone_bank.h"
+
+/* Our Headers */
+#include "decoder_gtzl.h"
+#include "gtzl.h"
+
+/* The bins are generated by tools/gen_tone_bank.py with the block length of gtzl_coeffs.h */
+#include "tone_bank_coeffs.h"
+
+#if TONE_BANK_SAMPLE_RATE != G_SAMPLE_RATE || TONE_BANK_FRAME_SIZE != G_ARRAY_SIZE
+	#error "tone_bank_coeffs.h does not match global_parameters.h, run python3 tools/gen_tone_bank.py"
+#endif
+#if TONE_BANK_BINS != TONE_BANK_MAX_BINS
+	#error "TONE_BANK_MAX_BINS does not match tone_bank_coeffs.h"
+#endif
+#if TONE_BANK_DTMF_TONES != DTMF_FREQ_AMT
+	#error "tone_bank_coeffs.h was generated for a different number of DTMF tones"
+#endif
+
+/* Power ratio to the strongest tone of a family below which a tone is not present, 10 dB */
+#define TONE_BANK_RELATIVE 0.1
+
+/* MF R1 digit of each pair of tones, indexed by the lower and the higher tone */
+static const char MF_KEYS[TONE_BANK_MF_TONES][TONE_BANK_MF_TONES] = {
+	/*        700  900  1100 1300 1500 1700 */
+	/* 700 */ {'N', '1', '2', '4', '7', 'c'},
+	/* 900 */ {'N', 'N', '3', '5', '8', 'a'},
+	/* 1100 */ {'N', 'N', 'N', '6', '9', 'K'},
+	/* 1300 */ {'N', 'N', 'N', 'N', '0', 'b'},
+	/* 1500 */ {'N', 'N', 'N', 'N', 'N', 'S'},
+	/* 1700 */ {'N', 'N', 'N', 'N', 'N', 'N'}
+};
+
+/* Bins of each family, in tone_family_t order */
+static const unsigned char *const FAMILY_BINS[TONE_FAMILY_AMT] = {
+	TONE_BANK_DTMF_BINS, TONE_BANK_CP_BINS, TONE_BANK_FAX_BINS, TONE_BANK_MF_BINS
+};
+static const int FAMILY_TONES[TONE_FAMILY_AMT] = {
+	TONE_BANK_DTMF_TONES, TONE_BANK_CP_TONES, TONE_BANK_FAX_TONES, TONE_BANK_MF_TONES
+};
+
+void tone_bank_init(tone_bank_t *bank, uint32_t families)
+{
+	int used[TONE_BANK_BINS];
+	int family, i;
+
+	bank->families = families & TONE_BANK_ALL_FAMILIES;
+	bank->bin_count = 0;
+	for (i = 0; i < TONE_BANK_BINS; i++)
+	{
+		used[i] = 0;
+		bank->power[i] = 0.0;
+	}
+
+	/* A bin shared by several families is listed once */
+	for (family = 0; family < TONE_FAMILY_AMT; family++)
+	{
+		if (!(bank->families & TONE_BANK_FAMILY(family)))
+		{
+			continue;
+		}
+		for (i = 0; i < FAMILY_TONES[family]; i++)
+		{
+			int bin = FAMILY_BINS[family][i];
+
+			if (!used[bin])
+			{
+				used[bin] = 1;
+				bank->bins[bank->bin_count++] = (unsigned char)bin;
+			}
+		}
+	}
+
+	/* Pad with the last bin, computed twice, so that the tail runs four bins at a time */
+	for (i = bank->bin_count; i % 4 != 0; i++)
+	{
+		bank->bins[i] = bank->bins[i - 1];
+	}
+
+	bank->result.dtmf.low = G_TONE_NONE;
+	bank->result.dtmf.high = G_TONE_NONE;
+	bank->result.call_progress = CALL_PROGRESS_NONE;
+	bank->result.fax = FAX_TONE_NONE;
+	bank->result.mf = 'N';
+}
+
+/* Eight recursions sharing each sample load, the bins are bins[0..7] */
+static void tone_bank_run8(tone_bank_t *bank, const unsigned char *bins, const complex_g3_t *signal)
+{
+	const double c0 = TONE_BANK_COEFFS[bins[0]],
+		c1 = TONE_BANK_COEFFS[bins[1]],
+		c2 = TONE_BANK_COEFFS[bins[2]],
+		c3 = TONE_BANK_COEFFS[bins[3]],
+		c4 = TONE_BANK_COEFFS[bins[4]],
+		c5 = TONE_BANK_COEFFS[bins[5]],
+		c6 = TONE_BANK_COEFFS[bins[6]],
+		c7 = TONE_BANK_COEFFS[bins[7]];
+	double q0_0, q0_1, q0_2, q0_3, q0_4, q0_5, q0_6, q0_7;
+	double q1_0 = 0, q1_1 = 0, q1_2 = 0, q1_3 = 0, q1_4 = 0, q1_5 = 0, q1_6 = 0, q1_7 = 0;
+	double q2_0 = 0, q2_1 = 0, q2_2 = 0, q2_3 = 0, q2_4 = 0, q2_5 = 0, q2_6 = 0, q2_7 = 0;
+	unsigned short n;
+
+	for (n = 0; n < TONE_BANK_BLOCK_SIZE; n++)
+	{
+		double x = signal[n].re;
+
+		q0_0 = c0 * q1_0 - q2_0 + x;
+		q0_1 = c1 * q1_1 - q2_1 + x;
+		q0_2 = c2 * q1_2 - q2_2 + x;
+		q0_3 = c3 * q1_3 - q2_3 + x;
+		q0_4 = c4 * q1_4 - q2_4 + x;
+		q0_5 = c5 * q1_5 - q2_5 + x;
+		q0_6 = c6 * q1_6 - q2_6 + x;
+		q0_7 = c7 * q1_7 - q2_7 + x;
+		q2_0 = q1_0;
+		q2_1 = q1_1;
+		q2_2 = q1_2;
+		q2_3 = q1_3;
+		q2_4 = q1_4;
+		q2_5 = q1_5;
+		q2_6 = q1_6;
+		q2_7 = q1_7;
+		q1_0 = q0_0;
+		q1_1 = q0_1;
+		q1_2 = q0_2;
+		q1_3 = q0_3;
+		q1_4 = q0_4;
+		q1_5 = q0_5;
+		q1_6 = q0_6;
+		q1_7 = q0_7;
+	}
+
+	bank->power[bins[0]] = q1_0 * q1_0 + q2_0 * q2_0 - q1_0 * q2_0 * c0;
+	bank->power[bins[1]] = q1_1 * q1_1 + q2_1 * q2_1 - q1_1 * q2_1 * c1;
+	bank->power[bins[2]] = q1_2 * q1_2 + q2_2 * q2_2 - q1_2 * q2_2 * c2;
+	bank->power[bins[3]] = q1_3 * q1_3 + q2_3 * q2_3 - q1_3 * q2_3 * c3;
+	bank->power[bins[4]] = q1_4 * q1_4 + q2_4 * q2_4 - q1_4 * q2_4 * c4;
+	bank->power[bins[5]] = q1_5 * q1_5 + q2_5 * q2_5 - q1_5 * q2_5 * c5;
+	bank->power[bins[6]] = q1_6 * q1_6 + q2_6 * q2_6 - q1_6 * q2_6 * c6;
+	bank->power[bins[7]] = q1_7 * q1_7 + q2_7 * q2_7 - q1_7 * q2_7 * c7;
+}
+
+/* Four recursions sharing each sample load, the bins are bins[0..3] */
+static void tone_bank_run4(tone_bank_t *bank, const unsigned char *bins, const complex_g3_t *signal)
+{
+	const double c0 = TONE_BANK_COEFFS[bins[0]],
+		c1 = TONE_BANK_COEFFS[bins[1]],
+		c2 = TONE_BANK_COEFFS[bins[2]],
+		c3 = TONE_BANK_COEFFS[bins[3]];
+	double q0_0, q0_1, q0_2, q0_3;
+	double q1_0 = 0, q1_1 = 0, q1_2 = 0, q1_3 = 0;
+	double q2_0 = 0, q2_1 = 0, q2_2 = 0, q2_3 = 0;
+	unsigned short n;
+
+	for (n = 0; n < TONE_BANK_BLOCK_SIZE; n++)
+	{
+		double x = signal[n].re;
+
+		q0_0 = c0 * q1_0 - q2_0 + x;
+		q0_1 = c1 * q1_1 - q2_1 + x;
+		q0_2 = c2 * q1_2 - q2_2 + x;
+		q0_3 = c3 * q1_3 - q2_3 + x;
+		q2_0 = q1_0;
+		q2_1 = q1_1;
+		q2_2 = q1_2;
+		q2_3 = q1_3;
+		q1_0 = q0_0;
+		q1_1 = q0_1;
+		q1_2 = q0_2;
+		q1_3 = q0_3;
+	}
+
+	bank->power[bins[0]] = q1_0 * q1_0 + q2_0 * q2_0 - q1_0 * q2_0 * c0;
+	bank->power[bins[1]] = q1_1 * q1_1 + q2_1 * q2_1 - q1_1 * q2_1 * c1;
+	bank->power[bins[2]] = q1_2 * q1_2 + q2_2 * q2_2 - q1_2 * q2_2 * c2;
+	bank->power[bins[3]] = q1_3 * q1_3 + q2_3 * q2_3 - q1_3 * q2_3 * c3;
+}
+
+/* Mask of the tones of a family that are present, bit i for the i-th tone of the family */
+static unsigned tone_bank_present(const tone_bank_t *bank, int family)
+{
+	double strongest = 0.0;
+	double floor;
+	unsigned mask = 0;
+	int i;
+
+	for (i = 0; i < FAMILY_TONES[family]; i++)
+	{
+		if (bank->power[FAMILY_BINS[family][i]] > strongest)
+		{
+			strongest = bank->power[FAMILY_BINS[family][i]];
+		}
+	}
+	floor = strongest * TONE_BANK_RELATIVE;
+	if (floor < ampl_thrs)
+	{
+		floor = ampl_thrs;
+	}
+
+	for (i = 0; i < FAMILY_TONES[family]; i++)
+	{
+		if (bank->power[FAMILY_BINS[family][i]] > floor)
+		{
+			mask |= 1u << i;
+		}
+	}
+	return mask;
+}
+
+static call_progress_t tone_bank_call_progress(unsigned mask)
+{
+	/* Bits: 350, 440, 480, 620 Hz */
+	switch (mask)
+	{
+	case 0x3:
+		return CALL_PROGRESS_DIAL;
+	case 0x6:
+		return CALL_PROGRESS_RINGBACK;
+	case 0xC:
+		return CALL_PROGRESS_BUSY;
+	default:
+		return CALL_PROGRESS_NONE;
+	}
+}
+
+static char tone_bank_mf(unsigned mask)
+{
+	int low = -1, high = -1;
+	int i;
+
+	for (i = 0; i < TONE_BANK_MF_TONES; i++)
+	{
+		if (mask & (1u << i))
+		{
+			if (low < 0)
+			{
+				low = i;
+			}
+			else if (high < 0)
+			{
+				high = i;
+			}
+			else
+			{
+				/* More than two tones */
+				return 'N';
+			}
+		}
+	}
+	return high < 0 ? 'N' : MF_KEYS[low][high];
+}
+
+void tone_bank_process(tone_bank_t *bank, const complex_g3_t *frame)
+{
+	double dtmf[DTMF_FREQ_AMT];
+	unsigned mf_mask = 0;
+	int i;
+
+	for (i = 0; i + 8 <= bank->bin_count; i += 8)
+	{
+		tone_bank_run8(bank, &bank->bins[i], frame);
+	}
+	for (; i < bank->bin_count; i += 4)
+	{
+		/* The list is padded to a multiple of four by tone_bank_init() */
+		tone_bank_run4(bank, &bank->bins[i], frame);
+	}
+
+	if (bank->families & TONE_BANK_FAMILY(TONE_FAMILY_DTMF))
+	{
+		for (i = 0; i < DTMF_FREQ_AMT; i++)
+		{
+			dtmf[i] = bank->power[TONE_BANK_DTMF_BINS[i]];
+		}
+		bank->result.dtmf = decoder_gtzl(dtmf);
+	}
+	if (bank->families & TONE_BANK_FAMILY(TONE_FAMILY_CALL_PROGRESS))
+	{
+		bank->result.call_progress = tone_bank_call_progress(tone_bank_present(bank, TONE_FAMILY_CALL_PROGRESS));
+	}
+	if (bank->families & TONE_BANK_FAMILY(TONE_FAMILY_MF))
+	{
+		mf_mask = tone_bank_present(bank, TONE_FAMILY_MF);
+		bank->result.mf = tone_bank_mf(mf_mask);
+	}
+	if (bank->families & TONE_BANK_FAMILY(TONE_FAMILY_FAX))
+	{
+		/* Bits: 1100, 2100 Hz. 1100 Hz (bit 2 of the MF tones) together with another MF tone is an MF digit, not CNG */
+		switch (tone_bank_present(bank, TONE_FAMILY_FAX))
+		{
+		case 0x1:
+			bank->result.fax = (mf_mask & ~(1u << 2)) ? FAX_TONE_NONE : FAX_TONE_CNG;
+			break;
+		case 0x2:
+			bank->result.fax = FAX_TONE_CED;
+			break;
+		default:
+			bank->result.fax = FAX_TONE_NONE;
+			break;
+		}
+	}
+}
+
+/* One multiplication per bin and sample, three per bin for the magnitude, padding bins included */
+uint32_t tone_bank_mults(const tone_bank_t *bank)
+{
+	return (uint32_t)((bank->bin_count + 3) & ~3) * (TONE_BANK_BLOCK_SIZE + 3);
+}
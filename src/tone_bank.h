@@ -0,0 +1,108 @@
+/*! \file tone_bank.h
+* \brief Multi-family Goertzel tone bank: DTMF, call progress, fax and MF R1 tones in one pass over the frame
+*
+* The tones of the enabled families are reduced to a list of distinct Goertzel bins, so a tone shared by two families
+* is computed once. The bins are run eight, then four, at a time over the frame, each sample being loaded once for
+* all the recursions of a group. The DTMF magnitudes are those of goertzel() and go through decoder_gtzl(). In the
+* other families a tone is present when it is above ampl_thrs and within 10 dB of the strongest tone of its family,
+* so that the leakage of a loud tone into the next bin is not taken for a second tone.
+*
+* Busy and reorder use the same tone pair and only differ by their cadence, which is left to the caller.
+*/
+
+#ifndef TONE_BANK_H_
+#define TONE_BANK_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "complex_g3.h"
+
+/*! \def TONE_BANK_MAX_BINS
+* \brief Distinct bins over all families, checked against the generated table by tone_bank.c
+*/
+#define TONE_BANK_MAX_BINS 18
+
+/*! \typedef tone_family_t
+* \brief Tone families of the bank
+*/
+typedef enum tone_family_t
+{
+	TONE_FAMILY_DTMF,	/*!< The 8 DTMF tones */
+	TONE_FAMILY_CALL_PROGRESS,	/*!< 350, 440, 480 and 620 Hz */
+	TONE_FAMILY_FAX,	/*!< 1100 Hz CNG and 2100 Hz CED */
+	TONE_FAMILY_MF,	/*!< MF R1, 700 to 1700 Hz in steps of 200 Hz */
+	TONE_FAMILY_AMT
+} tone_family_t;
+
+/* Family masks for tone_bank_init() */
+#define TONE_BANK_FAMILY(family) (1u << (family))
+#define TONE_BANK_ALL_FAMILIES ((1u << TONE_FAMILY_AMT) - 1)
+
+/*! \typedef call_progress_t
+* \brief Call progress tone pair of a frame
+*/
+typedef enum call_progress_t
+{
+	CALL_PROGRESS_NONE,
+	CALL_PROGRESS_DIAL,	/*!< 350 + 440 Hz */
+	CALL_PROGRESS_RINGBACK,	/*!< 440 + 480 Hz */
+	CALL_PROGRESS_BUSY	/*!< 480 + 620 Hz, busy or reorder depending on the cadence */
+} call_progress_t;
+
+/*! \typedef fax_tone_t
+* \brief Fax tone of a frame
+*/
+typedef enum fax_tone_t
+{
+	FAX_TONE_NONE,
+	FAX_TONE_CNG,	/*!< 1100 Hz calling tone */
+	FAX_TONE_CED	/*!< 2100 Hz answer tone */
+} fax_tone_t;
+
+/*! \typedef tone_bank_result_t
+* \brief What the bank found in the last frame, for the enabled families
+*/
+typedef struct tone_bank_result_t
+{
+	struct_tone_frequencies dtmf;	/*!< DTMF tone indices, as decoder_gtzl() */
+	call_progress_t call_progress;	/*!< Call progress pair */
+	fax_tone_t fax;	/*!< Fax tone */
+	char mf;	/*!< MF R1 digit 0-9, 'K' for KP, 'S' for ST and 'a'-'c' for ST' ST'' ST''', or 'N' */
+} tone_bank_result_t;
+
+/*! \typedef tone_bank_t
+* \brief State of a bank
+*/
+typedef struct tone_bank_t
+{
+	uint32_t families;	/*!< Mask of the enabled families */
+	int bin_count;	/*!< Number of bins computed for the enabled families */
+	unsigned char bins[TONE_BANK_MAX_BINS + 3];	/*!< Bins computed, indices in the generated table, padded to a multiple of 4 */
+	double power[TONE_BANK_MAX_BINS];	/*!< Magnitude squared of every bin of the table, 0 for those not computed */
+	tone_bank_result_t result;	/*!< Result of the last frame */
+} tone_bank_t;
+
+/*! \fn void tone_bank_init(tone_bank_t *bank, uint32_t families)
+* \param bank The bank
+* \param families Mask of TONE_BANK_FAMILY() values
+* \brief Selects the families and builds the list of distinct bins they need
+*/
+void tone_bank_init(tone_bank_t *bank, uint32_t families);
+
+/*! \fn void tone_bank_process(tone_bank_t *bank, const complex_g3_t *frame)
+* \param bank The bank
+* \param frame A frame of G_ARRAY_SIZE samples
+* \brief Runs every bin of the enabled families over the frame and classifies each family
+*/
+void tone_bank_process(tone_bank_t *bank, const complex_g3_t *frame);
+
+/*! \fn uint32_t tone_bank_mults(const tone_bank_t *bank)
+* \param bank The bank
+* \returns Multiplications per frame for the enabled families
+*/
+uint32_t tone_bank_mults(const tone_bank_t *bank);
+
+#endif // TONE_BANK_H_
@@ -0,0 +1,54 @@
+/*! \file tone_bank_coeffs.h
+* \brief Tone bank bins, generated by tools/gen_tone_bank.py: do not edit
+*
+* Command: python3 tools/gen_tone_bank.py --rate 8000 --block 508
+* Only included by tone_bank.c.
+*/
+
+#ifndef TONE_BANK_COEFFS_H_
+#define TONE_BANK_COEFFS_H_
+
+#define TONE_BANK_SAMPLE_RATE 8000	/* Sample rate the table was generated for */
+#define TONE_BANK_FRAME_SIZE 512	/* Frame size the table was generated for */
+#define TONE_BANK_BLOCK_SIZE 508	/* Samples of the frame used, GTZL_BLOCK_SIZE */
+#define TONE_BANK_BINS 18	/* Distinct bins over all families */
+
+/* Coefficient of each bin: 2 * cos(2 * pi * k / TONE_BANK_BLOCK_SIZE) */
+static const double TONE_BANK_COEFFS[TONE_BANK_BINS] = {
+	1.711070144817032,	/* k = 44: DTMF 697 Hz (-0.26 bin), MF 700 Hz (-0.45 bin) */
+	1.643802877955917,	/* k = 49: DTMF 770 Hz (+0.10 bin) */
+	1.5702509242797098,	/* k = 54: DTMF 852 Hz (-0.10 bin) */
+	1.474090363234728,	/* k = 60: DTMF 941 Hz (+0.25 bin) */
+	1.1595031278352148,	/* k = 77: DTMF 1209 Hz (+0.23 bin) */
+	0.9928505790200526,	/* k = 85: DTMF 1336 Hz (+0.16 bin) */
+	0.7938417079657742,	/* k = 94: DTMF 1477 Hz (+0.21 bin) */
+	0.5613070370601858,	/* k = 104: DTMF 1633 Hz (+0.30 bin) */
+	1.9264138041493142,	/* k = 22: CP 350 Hz (-0.23 bin) */
+	1.8812582592076879,	/* k = 28: CP 440 Hz (+0.06 bin) */
+	1.8638911886788692,	/* k = 30: CP 480 Hz (-0.48 bin) */
+	1.7717955445704547,	/* k = 39: CP 620 Hz (-0.37 bin) */
+	1.2960723442032105,	/* k = 70: FAX 1100 Hz (+0.15 bin), MF 1100 Hz (+0.15 bin) */
+	-0.1482855051032922,	/* k = 133: FAX 2100 Hz (-0.35 bin) */
+	1.523219117064776,	/* k = 57: MF 900 Hz (-0.15 bin) */
+	1.0354897196572361,	/* k = 83: MF 1300 Hz (+0.45 bin) */
+	0.771076687173215,	/* k = 95: MF 1500 Hz (-0.25 bin) */
+	0.46568796520128325	/* k = 108: MF 1700 Hz (+0.05 bin) */
+};
+
+/* DTMF, low then high group */
+#define TONE_BANK_DTMF_TONES 8
+static const unsigned char TONE_BANK_DTMF_BINS[TONE_BANK_DTMF_TONES] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+/* Call progress: dial 350+440, ringback 440+480, busy/reorder 480+620 */
+#define TONE_BANK_CP_TONES 4
+static const unsigned char TONE_BANK_CP_BINS[TONE_BANK_CP_TONES] = {8, 9, 10, 11};
+
+/* Fax calling (CNG) and answer (CED) tones */
+#define TONE_BANK_FAX_TONES 2
+static const unsigned char TONE_BANK_FAX_BINS[TONE_BANK_FAX_TONES] = {12, 13};
+
+/* MF R1, two of six */
+#define TONE_BANK_MF_TONES 6
+static const unsigned char TONE_BANK_MF_BINS[TONE_BANK_MF_TONES] = {0, 14, 12, 15, 16, 17};
+
+#endif
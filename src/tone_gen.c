@@ -0,0 +1,138 @@
+/*! \file tone_gen.c
+* \brief Functions for tone_gen.h
+*/
+
+/* C Library Headers */
+#include <string.h>
+
+/* Header */
+#include "tone_gen.h"
+#include "dtmf_table.h"
+
+/* Sine table and phase steps, in flash */
+#include "tone_gen_table.h"
+
+#if TONE_GEN_TABLE_SAMPLE_RATE != G_SAMPLE_RATE
+#error "tone_gen_table.h was generated for another G_SAMPLE_RATE, run tools/gen_tone_gen_table.py"
+#endif
+
+/* Bits of the phase below the table index, the top 16 of them interpolate */
+#define TONE_GEN_FRACTION_BITS (32 - TONE_GEN_TABLE_BITS)
+
+void tone_gen_default_config(tone_gen_config_t *config, const char *digits)
+{
+	config->digits = digits;
+	config->tone_ms = TONE_GEN_DEFAULT_TONE_MS;
+	config->gap_ms = TONE_GEN_DEFAULT_GAP_MS;
+	config->level_low = TONE_GEN_DEFAULT_LEVEL;
+	config->level_high = TONE_GEN_DEFAULT_LEVEL;
+	config->loop = 0;
+}
+
+void tone_gen_init(tone_gen_t *gen, const tone_gen_config_t *config)
+{
+	memset(gen, 0, sizeof(*gen));
+	gen->config = *config;
+	/* A digit lasts at least a sample, so that a sequence always moves on */
+	gen->tone_samples = ((uint32_t)config->tone_ms * G_SAMPLE_RATE) / 1000;
+	if (gen->tone_samples == 0)
+	{
+		gen->tone_samples = 1;
+	}
+	gen->gap_samples = ((uint32_t)config->gap_ms * G_SAMPLE_RATE) / 1000;
+	gen->remaining = gen->gap_samples;
+	gen->key = TONE_GEN_SILENCE;
+}
+
+/* Starts the digit at gen->position, the phases restart at zero so that every digit begins the same way */
+static void tone_gen_start_digit(tone_gen_t *gen)
+{
+	char key = gen->config.digits[gen->position++];
+	/* Row and column of a key are the index of its low and high group tone */
+	int index = dtmf_key_index(key);
+
+	gen->in_tone = 1;
+	gen->remaining = gen->tone_samples;
+	gen->key = TONE_GEN_SILENCE;
+	gen->phase_low = 0;
+	gen->phase_high = 0;
+	if (index >= 0)
+	{
+		gen->key = key;
+		gen->step_low = TONE_GEN_STEP_LOW[index / DTMF_GROUP_TONES];
+		gen->step_high = TONE_GEN_STEP_HIGH[index % DTMF_GROUP_TONES];
+		gen->digit_start = gen->sample;
+		gen->digits++;
+	}
+}
+
+/* Moves to the next digit or gap once the current one is over, returns 0 when the sequence has ended */
+static int tone_gen_advance(tone_gen_t *gen)
+{
+	while (gen->remaining == 0)
+	{
+		if (gen->in_tone)
+		{
+			gen->in_tone = 0;
+			gen->key = TONE_GEN_SILENCE;
+			gen->remaining = gen->gap_samples;
+		}
+		else if (gen->config.digits[gen->position] != '\0')
+		{
+			tone_gen_start_digit(gen);
+		}
+		else if (gen->config.loop && gen->position > 0)
+		{
+			gen->position = 0;
+		}
+		else
+		{
+			gen->done = 1;
+			gen->key = TONE_GEN_SILENCE;
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* Interpolated Q15 sine of a phase */
+static int32_t tone_gen_sine(uint32_t phase)
+{
+	uint32_t index = phase >> TONE_GEN_FRACTION_BITS;
+	int32_t fraction = (int32_t)((phase >> (TONE_GEN_FRACTION_BITS - 16)) & 0xFFFF);
+	int32_t value = TONE_GEN_SINE[index];
+
+	return value + (((TONE_GEN_SINE[index + 1] - value) * fraction) >> 16);
+}
+
+int32_t tone_gen_next(tone_gen_t *gen)
+{
+	int32_t value = 0;
+
+	if (gen->remaining == 0 && !tone_gen_advance(gen))
+	{
+		gen->sample++;
+		return 0;
+	}
+	if (gen->key != TONE_GEN_SILENCE)
+	{
+		value = (tone_gen_sine(gen->phase_low) * gen->config.level_low
+			+ tone_gen_sine(gen->phase_high) * gen->config.level_high) >> 15;
+		gen->phase_low += gen->step_low;
+		gen->phase_high += gen->step_high;
+	}
+	gen->remaining--;
+	gen->sample++;
+	return value;
+}
+
+void tone_gen_render(tone_gen_t *gen, complex_g3_t *samples, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		samples[i].re = tone_gen_next(gen) * (G_MAX_AMPLITUDE / 65536.0);
+		samples[i].im = 0.0;
+	}
+}
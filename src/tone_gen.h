@@ -0,0 +1,99 @@
+/*! \file tone_gen.h
+* \brief Table driven DTMF tone generator, plays a digit sequence one sample at a time
+*
+* Each tone is a direct digital synthesiser: a 32 bit phase accumulator advanced by a fixed step every sample, whose
+* top bits index a sine table in flash and whose next bits interpolate between two entries. The steps of the eight DTMF
+* frequencies are in the table as well, so a sample costs two table reads, two multiplications per tone and no
+* floating point, which lets the board call tone_gen_next() from the DAC timer interrupt. On the host the same
+* generator renders frames in the units of the reader, as a synthetic source for the decoders.
+*
+* A sequence is a gap of silence before each digit and after the last one, like the signals of dtmf_gen.c. The
+* generator records the sample each digit starts on, which is what the loopback self-test of self_test.h measures
+* the detection latency from.
+*/
+
+#ifndef TONE_GEN_H_
+#define TONE_GEN_H_
+
+/* Driver Headers */
+#include <platform.h>
+
+/* Our Headers */
+#include "global_parameters.h"
+#include "complex_g3.h"
+
+/*! \def TONE_GEN_SILENCE
+* \brief Key reported while no digit is sounding
+*/
+#define TONE_GEN_SILENCE 'N'
+
+/*! \def TONE_GEN_FULL_SCALE
+* \brief Largest magnitude of a sample of tone_gen_next(), a Q15 sine at unit level
+*/
+#define TONE_GEN_FULL_SCALE 32767
+
+/* Defaults of tone_gen_default_config() */
+#define TONE_GEN_DEFAULT_TONE_MS 100
+#define TONE_GEN_DEFAULT_GAP_MS 100
+#define TONE_GEN_DEFAULT_LEVEL 8192	/* Peak of each tone, a quarter of full scale, 1000 in the units of the reader */
+
+/*! \typedef tone_gen_config_t
+* \brief What to play
+*/
+typedef struct tone_gen_config_t
+{
+	const char *digits;	/*!< Digits to play, any of 0-9, *, #, A-D, other characters are played as silence, kept by the generator */
+	uint16_t tone_ms;	/*!< Duration of each digit */
+	uint16_t gap_ms;	/*!< Silence before each digit and after the last one */
+	int16_t level_low;	/*!< Peak of the low group tone, out of TONE_GEN_FULL_SCALE */
+	int16_t level_high;	/*!< Peak of the high group tone, a different level than the low one gives twist */
+	int loop;	/*!< 1 to start the sequence over after the last gap, 0 to stay silent */
+} tone_gen_config_t;
+
+/*! \typedef tone_gen_t
+* \brief State of a generator
+*/
+typedef struct tone_gen_t
+{
+	tone_gen_config_t config;	/*!< Sequence being played */
+	uint32_t tone_samples;	/*!< Length of a digit */
+	uint32_t gap_samples;	/*!< Length of a gap */
+	uint32_t phase_low, phase_high;	/*!< Phase accumulators, a full turn is 2^32 */
+	uint32_t step_low, step_high;	/*!< Phase steps of the digit sounding */
+	int position;	/*!< Next character of config.digits */
+	int in_tone;	/*!< 1 during a digit, 0 during a gap */
+	int done;	/*!< 1 once the sequence has ended, without config.loop */
+	uint32_t remaining;	/*!< Samples left in the current digit or gap */
+	char key;	/*!< Key sounding, TONE_GEN_SILENCE in the gaps */
+	uint32_t sample;	/*!< Samples generated since tone_gen_init() */
+	uint32_t digit_start;	/*!< First sample of the last digit started */
+	uint32_t digits;	/*!< Digits started since tone_gen_init(), characters played as silence are not counted */
+} tone_gen_t;
+
+/*! \fn void tone_gen_default_config(tone_gen_config_t *config, const char *digits)
+* \param config Filled with the default timings and level, without loop
+* \param digits Digits to play
+*/
+void tone_gen_default_config(tone_gen_config_t *config, const char *digits);
+
+/*! \fn void tone_gen_init(tone_gen_t *gen, const tone_gen_config_t *config)
+* \param gen The generator
+* \param config Sequence to play, copied, its digits are not
+* \brief Starts the sequence with the gap before its first digit
+*/
+void tone_gen_init(tone_gen_t *gen, const tone_gen_config_t *config);
+
+/*! \fn int32_t tone_gen_next(tone_gen_t *gen)
+* \param gen The generator
+* \returns The next sample, within +-(level_low + level_high), 0 in the gaps and once the sequence has ended
+*/
+int32_t tone_gen_next(tone_gen_t *gen);
+
+/*! \fn void tone_gen_render(tone_gen_t *gen, complex_g3_t *samples, int count)
+* \param gen The generator
+* \param samples Receives count samples in the units of the reader, with a zero imaginary part: TONE_GEN_FULL_SCALE reads G_MAX_AMPLITUDE / 2, as a full scale DAC output wired to the ADC would
+* \param count Number of samples, G_ARRAY_SIZE for one frame
+*/
+void tone_gen_render(tone_gen_t *gen, complex_g3_t *samples, int count);
+
+#endif // TONE_GEN_H_
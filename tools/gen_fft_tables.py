@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Generates src/fft_tables.h, the twiddle factor and bit-reversal tables of the in-place FFT of src/fft.c.
+
+The FFT size is G_ARRAY_SIZE of src/global_parameters.h unless given on the command line, so after changing it the
+tables are regenerated with:
+
+    python3 tools/gen_fft_tables.py
+
+The tables are const, so they stay in flash instead of taking SRAM, and one pair serves every power of two up to the
+generated size: an N point FFT reads every (size / N)th twiddle factor, and the bit reversal of i over log2(N) bits is
+the entry of i shifted right by log2(size / N). The build refuses to compile fft.c if the size does not match NN.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def read_define(path, name):
+    with open(path) as f:
+        match = re.search(r'^\s*#define\s+%s\s+(\d+)' % name, f.read(), re.M)
+    if match is None:
+        sys.exit('%s: no #define %s' % (path, name))
+    return int(match.group(1))
+
+
+def bit_reverse(i, bits):
+    result = 0
+    for _ in range(bits):
+        result = (result << 1) | (i & 1)
+        i >>= 1
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--size', type=int, help='largest FFT size (default: G_ARRAY_SIZE)')
+    parser.add_argument('-o', '--output', default=os.path.join(ROOT, 'src', 'fft_tables.h'))
+    args = parser.parse_args()
+
+    size = args.size or read_define(os.path.join(ROOT, 'src', 'global_parameters.h'), 'G_ARRAY_SIZE')
+    if size < 2 or size & (size - 1):
+        sys.exit('%d is not a power of two' % size)
+    if size > 65536:
+        sys.exit('%d points do not fit the 16 bit bit-reversal table' % size)
+    bits = size.bit_length() - 1
+
+    lines = [
+        '/*! \\file fft_tables.h',
+        '* \\brief FFT twiddle factor and bit-reversal tables, generated by tools/gen_fft_tables.py: do not edit',
+        '*',
+        '* Command: python3 tools/gen_fft_tables.py --size %d' % size,
+        '* Only included by fft.c.',
+        '*/',
+        '',
+        '#ifndef FFT_TABLES_H_',
+        '#define FFT_TABLES_H_',
+        '',
+        '#define FFT_TABLES_SIZE %d\t/* Largest FFT size, the tables serve every power of two up to it */' % size,
+        '',
+        '/* Twiddle factors e^(-j 2 pi k / FFT_TABLES_SIZE), k = 0 to FFT_TABLES_SIZE / 2 - 1 */',
+        'static const complex_g3_t FFT_TWIDDLES[FFT_TABLES_SIZE / 2] = {',
+    ]
+    for k in range(size // 2):
+        angle = -2.0 * math.pi * k / size
+        re_, im = math.cos(angle), math.sin(angle)
+        # Exact zeros and ones where the angle is a multiple of pi / 2
+        if 4 * k % size == 0:
+            re_, im = round(re_), round(im)
+        lines.append('\t{%r, %r}%s' % (float(re_), float(im), ',' if k + 1 < size // 2 else ''))
+    lines += ['};', '']
+
+    lines.append('/* i with its %d bits reversed */' % bits)
+    lines.append('static const unsigned short FFT_BIT_REVERSE[FFT_TABLES_SIZE] = {')
+    values = [bit_reverse(i, bits) for i in range(size)]
+    for start in range(0, size, 16):
+        chunk = ', '.join(str(v) for v in values[start:start + 16])
+        lines.append('\t%s%s' % (chunk, ',' if start + 16 < size else ''))
+    lines += ['};', '', '#endif', '']
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
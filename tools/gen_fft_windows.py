@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Generates src/fft_windows.h, the window tables of the small windowed FFTs of src/fft.c.
+
+    python3 tools/gen_fft_windows.py --sizes 128,256
+
+The windows are periodic (DFT-even): w[i] = w[N - i], so only w[0] to w[N / 2] are stored and the tables stay in
+flash as const data. The coherent gain, the mean of the window, is what divides the peak of a windowed tone to
+compare it with the thresholds tuned for the rectangular 512-point FFT.
+"""
+
+import argparse
+import math
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Name and coefficients a0, a1, a2 of w[i] = a0 - a1 cos(2 pi i / N) + a2 cos(4 pi i / N)
+WINDOWS = [
+    ('HANN', 'Hann', (0.5, 0.5, 0.0)),
+    ('BLACKMAN', 'Blackman', (0.42, 0.5, 0.08)),
+]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--sizes', default='128,256', help='comma separated FFT sizes, powers of two')
+    parser.add_argument('-o', '--output', default=os.path.join(ROOT, 'src', 'fft_windows.h'))
+    args = parser.parse_args()
+
+    sizes = sorted(int(s) for s in args.sizes.split(','))
+    for n in sizes:
+        if n < 4 or n & (n - 1):
+            parser.error('%d is not a power of two' % n)
+
+    lines = [
+        '/*! \\file fft_windows.h',
+        '* \\brief Window tables of the windowed FFTs, generated by tools/gen_fft_windows.py: do not edit',
+        '*',
+        '* Command: python3 tools/gen_fft_windows.py --sizes %s' % ','.join(str(n) for n in sizes),
+        '* Only included by fft.c.',
+        '*/',
+        '',
+        '#ifndef FFT_WINDOWS_H_',
+        '#define FFT_WINDOWS_H_',
+        '',
+    ]
+    for name, title, (a0, a1, a2) in WINDOWS:
+        lines.append('#define FFT_WINDOW_%s_GAIN %r\t/* Coherent gain of the %s window */' % (name, a0, title))
+    lines.append('')
+
+    for n in sizes:
+        for name, title, (a0, a1, a2) in WINDOWS:
+            values = [a0 - a1 * math.cos(2.0 * math.pi * i / n) + a2 * math.cos(4.0 * math.pi * i / n)
+                      for i in range(n // 2 + 1)]
+            lines.append('/* %s window of %d points, w[0] to w[%d] */' % (title, n, n // 2))
+            lines.append('static const float FFT_WINDOW_%s_%d[%d] = {' % (name, n, n // 2 + 1))
+            for start in range(0, len(values), 8):
+                chunk = ', '.join('%.9ff' % max(v, 0.0) for v in values[start:start + 8])
+                lines.append('\t%s%s' % (chunk, ',' if start + 8 < len(values) else ''))
+            lines += ['};', '']
+
+    lines += ['#endif', '']
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Generates src/g711_tables.h, the mu-law and A-law expansion tables of src/g711.c.
+
+Each table maps the 256 codes of a law to the linear sample the reader would have stored for the same level, so the
+detectors keep their thresholds: the 16 bit linear value of G.711 is scaled so that a full scale code reads
+G_MAX_AMPLITUDE of src/global_parameters.h. After changing G_MAX_AMPLITUDE the tables are regenerated with:
+
+    python3 tools/gen_g711_tables.py
+
+The build refuses to compile g711.c if the tables were generated for another G_MAX_AMPLITUDE.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def read_define(path, name):
+    with open(path) as f:
+        match = re.search(r'^\s*#define\s+%s\s+([0-9.]+)' % name, f.read(), re.M)
+    if match is None:
+        sys.exit('%s: no #define %s' % (path, name))
+    return match.group(1)
+
+
+def ulaw_expand(code):
+    """G.711 mu-law code to its 16 bit linear value, within +-32124"""
+    code = ~code & 0xff
+    exponent = (code >> 4) & 0x07
+    value = (((code & 0x0f) << 3) + 0x84) << exponent
+    value -= 0x84
+    return -value if code & 0x80 else value
+
+
+def alaw_expand(code):
+    """G.711 A-law code to its 16 bit linear value, within +-32256"""
+    code ^= 0x55
+    segment = (code >> 4) & 0x07
+    value = (code & 0x0f) << 4
+    if segment == 0:
+        value += 8
+    else:
+        value = (value + 0x108) << (segment - 1)
+    return value if code & 0x80 else -value
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-o', '--output', default=os.path.join(ROOT, 'src', 'g711_tables.h'))
+    args = parser.parse_args()
+
+    text = read_define(os.path.join(ROOT, 'src', 'global_parameters.h'), 'G_MAX_AMPLITUDE')
+    amplitude = float(text)
+    if amplitude != int(amplitude):
+        sys.exit('G_MAX_AMPLITUDE %s is not a whole number, g711.c cannot check it' % text)
+    scale = amplitude / 32768.0
+
+    lines = [
+        '/*! \\file g711_tables.h',
+        '* \\brief G.711 mu-law and A-law expansion tables, generated by tools/gen_g711_tables.py: do not edit',
+        '*',
+        '* Command: python3 tools/gen_g711_tables.py',
+        '* Only included by g711.c.',
+        '*/',
+        '',
+        '#ifndef G711_TABLES_H_',
+        '#define G711_TABLES_H_',
+        '',
+        '#define G711_TABLES_MAX_AMPLITUDE %s\t/* G_MAX_AMPLITUDE the tables were scaled for */' % text,
+        '',
+    ]
+    for name, title, expand in (('ULAW', 'mu-law', ulaw_expand), ('ALAW', 'A-law', alaw_expand)):
+        values = [expand(code) * scale for code in range(256)]
+        lines.append('/* %s code to sample, 16 bit linear value times %r */' % (title, scale))
+        lines.append('static const float G711_%s_TABLE[256] = {' % name)
+        for start in range(0, 256, 8):
+            chunk = ', '.join('%rf' % v for v in values[start:start + 8])
+            lines.append('\t%s%s' % (chunk, ',' if start + 8 < 256 else ''))
+        lines += ['};', '']
+    lines += ['#endif', '']
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Generates src/gtzl_coeffs.h, the Goertzel coefficient tables used by src/gtzl.c.
+
+The sample rate and the frame size are read from src/global_parameters.h unless given on the command line, so after
+changing G_SAMPLE_RATE or G_ARRAY_SIZE the tables are regenerated with:
+
+    python3 tools/gen_gtzl_coeffs.py
+
+Each tone uses the integer bin k = round(N * f / fs) of an N sample block. Unless --block is given, N is the block
+length between 3/4 of the frame and the whole frame that minimises the worst distance of a tone from the centre of
+its bin (508 for 8000 Hz and 512 samples). The build refuses to compile gtzl.c if the header does not match
+global_parameters.h.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DTMF_TABLE = os.path.join(ROOT, 'src', 'dtmf_table.c')
+
+
+def read_define(path, name):
+    with open(path) as f:
+        match = re.search(r'^\s*#define\s+%s\s+(\d+)' % name, f.read(), re.M)
+    if match is None:
+        sys.exit('%s: no #define %s' % (path, name))
+    return int(match.group(1))
+
+
+def read_table(path, name):
+    with open(path) as f:
+        match = re.search(r'\b%s\[[^]]*\]\s*=\s*\{([^}]*)\}' % name, f.read())
+    if match is None:
+        sys.exit('%s: no table %s' % (path, name))
+    return [int(x) for x in match.group(1).split(',')]
+
+
+def bin_error(block, rate, tone):
+    k = block * tone / rate
+    return abs(k - round(k))
+
+
+def best_block(frame, rate, tones):
+    candidates = range(frame, (3 * frame) // 4 - 1, -1)
+    return min(candidates, key=lambda n: (max(bin_error(n, rate, t) for t in tones), -n))
+
+
+def table(prefix, title, rate, block, tones):
+    bins = [int(round(block * t / rate)) for t in tones]
+    coeffs = [2.0 * math.cos(2.0 * math.pi * k / block) for k in bins]
+    lines = [
+        '/* Tables for %s (%d Hz) */' % (title, rate),
+        '#define %sBLOCK_SIZE %d\t/* Samples of the frame used by the Goertzel algorithm */' % (prefix, block),
+        '',
+        '/* Coefficient of each tone: 2 * cos(2 * pi * k / %sBLOCK_SIZE), with the bin k = round(%sBLOCK_SIZE * f / fs) */'
+        % (prefix, prefix),
+        'static const double %sCOEFFS[GTZL_TONE_AMT] = {' % prefix,
+    ]
+    for i, (t, k, c) in enumerate(zip(tones, bins, coeffs)):
+        lines.append('\t%s%s\t/* %d Hz, k = %d, %+.4f bin from the tone */'
+                     % (repr(c), ',' if i + 1 < len(coeffs) else '', t, k, k - block * t / rate))
+    return lines + ['};', '']
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--rate', type=int, help='sample rate in Hz (default: G_SAMPLE_RATE)')
+    parser.add_argument('--frame', type=int, help='frame size in samples (default: G_ARRAY_SIZE)')
+    parser.add_argument('--block', type=int, help='Goertzel block length (default: best fit, see above)')
+    parser.add_argument('--tones', type=lambda s: [int(x) for x in s.split(',')], default=None,
+                        help='comma separated tone list in Hz (default: the 8 DTMF tones)')
+    parser.add_argument('-o', '--output', default=os.path.join(ROOT, 'src', 'gtzl_coeffs.h'))
+    args = parser.parse_args()
+    if args.tones is None:
+        args.tones = read_table(DTMF_TABLE, 'dtmf_low_freqs') + read_table(DTMF_TABLE, 'dtmf_high_freqs')
+
+    params = os.path.join(ROOT, 'src', 'global_parameters.h')
+    rate = args.rate or read_define(params, 'G_SAMPLE_RATE')
+    frame = args.frame or read_define(params, 'G_ARRAY_SIZE')
+    block = args.block or best_block(frame, rate, args.tones)
+    if block > frame:
+        sys.exit('block length %d is longer than the frame (%d)' % (block, frame))
+    if max(args.tones) * 2 >= rate:
+        sys.exit('tones above the Nyquist frequency of %d Hz' % (rate // 2))
+
+    lines = [
+        '/*! \\file gtzl_coeffs.h',
+        '* \\brief Goertzel coefficient tables, generated by tools/gen_gtzl_coeffs.py: do not edit',
+        '*',
+        '* Command: python3 tools/gen_gtzl_coeffs.py --rate %d --frame %d --block %d --tones %s'
+        % (rate, frame, block, ','.join(str(t) for t in args.tones)),
+        '* Only included by gtzl.c.',
+        '*/',
+        '',
+        '#ifndef GTZL_COEFFS_H_',
+        '#define GTZL_COEFFS_H_',
+        '',
+        '#define GTZL_COEFFS_SAMPLE_RATE %d\t/* Sample rate the tables were generated for */' % rate,
+        '#define GTZL_COEFFS_FRAME_SIZE %d\t/* Frame size the tables were generated for */' % frame,
+        '#define GTZL_TONE_AMT %d\t/* Number of tones */' % len(args.tones),
+        '',
+        '/* Tone frequencies in Hz, initialiser of DTMF_FRQS[] */',
+        '#define GTZL_TONES {%s}' % ', '.join(str(t) for t in args.tones),
+        '',
+    ]
+    lines += table('GTZL_', 'the sample rate', rate, block, args.tones)
+    lines += ['#endif', '']
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Generates host/resampler_poly_taps.h and src/resampler_taps.h, the filter tables of the resamplers.
+
+The polyphase tables go to host/resampler_poly_taps.h, used by host/resampler_poly.c only: the firmware samples at
+G_SAMPLE_RATE and never converts. The half-band filter goes to src/resampler_taps.h, used by src/resampler.c.
+
+Each input rate gets a Kaiser-windowed sinc low-pass designed at L times the input rate, for a conversion by L/M to
+the output rate (G_SAMPLE_RATE, read from src/global_parameters.h). The output band that matters is 0 to --pass Hz
+(DTMF, call progress and fax tones). Everything that would fold into that band, from output rate - pass upwards, is
+attenuated by at least --atten dB. Between pass and output rate - pass aliasing is allowed, since it only lands above
+the pass band. This wide transition band keeps the filters short.
+
+The half-band filter of the decimate-by-2 stage is generated too. It protects 0 to --halfband-pass Hz (the DTMF band)
+at half the output rate. Every other tap of a half-band filter is zero and the centre tap is 1/2, so only one side of
+the odd taps is stored.
+
+    python3 tools/gen_resampler_taps.py
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INPUT_RATES = [16000, 44100, 48000]
+
+
+def read_define(path, name):
+    with open(path) as f:
+        match = re.search(r'^\s*#define\s+%s\s+(\d+)' % name, f.read(), re.M)
+    if match is None:
+        sys.exit('%s: no #define %s' % (path, name))
+    return int(match.group(1))
+
+
+def bessel_i0(x):
+    term, total, k = 1.0, 1.0, 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def design(up, down, rate, out_rate, pass_hz, atten):
+    proto_rate = rate * up
+    stop_hz = out_rate - pass_hz
+    delta_w = 2.0 * math.pi * (stop_hz - pass_hz) / proto_rate
+    length = int(math.ceil((atten - 8.0) / (2.285 * delta_w))) + 1
+    taps = int(math.ceil(length / float(up)))
+    length = taps * up
+    beta = 0.1102 * (atten - 8.7) if atten > 50 else 0.5842 * (atten - 21) ** 0.4 + 0.07886 * (atten - 21)
+    cutoff = (pass_hz + stop_hz) / 2.0 / proto_rate
+    centre = (length - 1) / 2.0
+    h = []
+    for n in range(length):
+        t = n - centre
+        sinc = 2.0 * cutoff if t == 0 else math.sin(2.0 * math.pi * cutoff * t) / (math.pi * t)
+        r = 2.0 * n / (length - 1) - 1.0
+        h.append(sinc * bessel_i0(beta * math.sqrt(max(0.0, 1.0 - r * r))) / bessel_i0(beta))
+    gain = up / sum(h)
+    h = [v * gain for v in h]
+    # Polyphase order: branch p holds h[p], h[p + L], h[p + 2L]... applied to the newest input first
+    return taps, [[h[p + k * up] for k in range(taps)] for p in range(up)], centre / up
+
+
+def design_halfband(rate, pass_hz, atten):
+    stop_hz = rate / 2.0 - pass_hz
+    delta_w = 2.0 * math.pi * (stop_hz - pass_hz) / rate
+    length = int(math.ceil((atten - 8.0) / (2.285 * delta_w))) + 1
+    # 4m + 3 taps: the outermost taps are odd offsets from the centre, so they are not zero
+    length = 4 * max(0, int(math.ceil((length - 3) / 4.0))) + 3
+    beta = 0.1102 * (atten - 8.7) if atten > 50 else 0.5842 * (atten - 21) ** 0.4 + 0.07886 * (atten - 21)
+    centre = (length - 1) // 2
+    h = []
+    for n in range(length):
+        t = n - centre
+        sinc = 0.5 if t == 0 else math.sin(0.5 * math.pi * t) / (math.pi * t)
+        r = 2.0 * n / (length - 1) - 1.0
+        h.append(sinc * bessel_i0(beta * math.sqrt(max(0.0, 1.0 - r * r))) / bessel_i0(beta))
+    # Odd offsets only, scaled so that the DC gain is 1 with the centre tap kept at exactly 1/2
+    odd = [h[centre + 1 + 2 * j] for j in range((centre + 1) // 2)]
+    gain = 0.5 / (2.0 * sum(odd))
+    return length, [v * gain for v in odd]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--pass', dest='pass_hz', type=float, default=2200.0, help='protected band edge in Hz')
+    parser.add_argument('--atten', type=float, default=60.0, help='alias attenuation in dB')
+    parser.add_argument('--halfband-pass', type=float, default=1700.0, help='protected band edge of the half-band filter')
+    parser.add_argument('--halfband-atten', type=float, default=50.0, help='alias attenuation of the half-band filter')
+    parser.add_argument('--rates', type=lambda s: [int(x) for x in s.split(',')], default=INPUT_RATES)
+    parser.add_argument('-o', '--output', default=os.path.join(ROOT, 'src', 'resampler_taps.h'))
+    parser.add_argument('--poly-output', default=os.path.join(ROOT, 'host', 'resampler_poly_taps.h'))
+    args = parser.parse_args()
+
+    out_rate = read_define(os.path.join(ROOT, 'src', 'global_parameters.h'), 'G_SAMPLE_RATE')
+    command = ('python3 tools/gen_resampler_taps.py --pass %g --atten %g --halfband-pass %g --halfband-atten %g --rates %s'
+               % (args.pass_hz, args.atten, args.halfband_pass, args.halfband_atten, ','.join(str(r) for r in args.rates)))
+
+    lines = [
+        '/*! \\file resampler_poly_taps.h',
+        '* \\brief Polyphase filter tables, generated by tools/gen_resampler_taps.py: do not edit',
+        '*',
+        '* Command: %s' % command,
+        '* Only included by resampler_poly.c.',
+        '*/',
+        '',
+        '#ifndef RESAMPLER_POLY_TAPS_H_',
+        '#define RESAMPLER_POLY_TAPS_H_',
+        '',
+        '#define RESAMPLER_POLY_TAPS_OUTPUT_RATE %d\t/* Output rate the tables were generated for */' % out_rate,
+        '',
+    ]
+    entries = []
+    max_taps = 0
+    for rate in args.rates:
+        g = math.gcd(rate, out_rate)
+        up, down = out_rate // g, rate // g
+        taps, phases, delay = design(up, down, rate, out_rate, args.pass_hz, args.atten)
+        max_taps = max(max_taps, taps)
+        name = 'RESAMPLER_TAPS_%d' % rate
+        lines.append('/* %d Hz: up %d, down %d, %d taps per branch, group delay %.2f input samples */'
+                     % (rate, up, down, taps, delay))
+        lines.append('static const float %s[%d * %d] = {' % (name, up, taps))
+        values = ['%.9gf' % v for branch in phases for v in branch]
+        for i in range(0, len(values), 8):
+            lines.append('\t%s%s' % (', '.join(values[i:i + 8]), ',' if i + 8 < len(values) else ''))
+        lines += ['};', '']
+        entries.append('\t{%d, %d, %d, %d, %.6ff, %s}' % (rate, up, down, taps, delay, name))
+
+    lines += [
+        '#define RESAMPLER_TAPS_LONGEST %d\t/* Longest branch of the tables */' % max_taps,
+        '',
+        '/* Input rate, up, down, taps per branch, group delay in input samples, table */',
+        '#define RESAMPLER_FILTER_TABLE \\',
+        ', \\\n'.join(entries),
+        '',
+        '#endif',
+        '',
+    ]
+    with open(args.poly_output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+    length, odd = design_halfband(out_rate, args.halfband_pass, args.halfband_atten)
+    lines = [
+        '/*! \\file resampler_taps.h',
+        '* \\brief Half-band filter table, generated by tools/gen_resampler_taps.py: do not edit',
+        '*',
+        '* Command: %s' % command,
+        '* Only included by resampler.c.',
+        '*/',
+        '',
+        '#ifndef RESAMPLER_TAPS_H_',
+        '#define RESAMPLER_TAPS_H_',
+        '',
+        '#define RESAMPLER_TAPS_OUTPUT_RATE %d\t/* Output rate the table was generated for */' % out_rate,
+        '',
+        '/* Half-band filter at %d Hz: %d taps, 0-%g Hz protected by %g dB, centre tap 1/2 */'
+        % (out_rate, length, args.halfband_pass, args.halfband_atten),
+        '#define RESAMPLER_HALFBAND_LENGTH %d' % length,
+        '',
+        '/* Taps at offsets 1, 3, 5... from the centre, the same on both sides */',
+        'static const float RESAMPLER_HALFBAND_TAPS[(RESAMPLER_HALFBAND_LENGTH + 1) / 4] = {',
+    ]
+    values = ['%.9gf' % v for v in odd]
+    for i in range(0, len(values), 8):
+        lines.append('\t%s%s' % (', '.join(values[i:i + 8]), ',' if i + 8 < len(values) else ''))
+    lines += ['};', '', '#endif', '']
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Generates src/sdft_tables.h, the twiddle factor tables of the sliding DFT of src/sdft.c.
+
+The window length is SDFT_WINDOW of src/sdft.h unless given on the command line, so after changing it the tables are
+regenerated with:
+
+    python3 tools/gen_sdft_tables.py
+
+Entry i is cos and sin of 2 pi i / SDFT_WINDOW. The recursion of bin k rotates by entry k, and the direct transform of
+the re-seeding steps through the entries k i mod SDFT_WINDOW, so one pair of tables serves every bin. The tables are
+const, so they stay in flash. The build refuses to compile sdft.c if the window does not match SDFT_WINDOW.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def read_define(path, name):
+    with open(path) as f:
+        match = re.search(r'^\s*#define\s+%s\s+(\d+)' % name, f.read(), re.M)
+    if match is None:
+        sys.exit('%s: no #define %s' % (path, name))
+    return int(match.group(1))
+
+
+def table(name, title, values):
+    lines = ['/* %s */' % title, 'static const float %s[SDFT_TABLES_WINDOW] = {' % name]
+    for i, v in enumerate(values):
+        lines.append('\t%r%s' % (v, ',' if i + 1 < len(values) else ''))
+    return lines + ['};', '']
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--window', type=int, help='window length in samples (default: SDFT_WINDOW)')
+    parser.add_argument('-o', '--output', default=os.path.join(ROOT, 'src', 'sdft_tables.h'))
+    args = parser.parse_args()
+
+    window = args.window or read_define(os.path.join(ROOT, 'src', 'sdft.h'), 'SDFT_WINDOW')
+    if window < 2:
+        sys.exit('window of %d samples' % window)
+    angles = [2.0 * math.pi * i / window for i in range(window)]
+
+    lines = [
+        '/*! \\file sdft_tables.h',
+        '* \\brief Sliding DFT twiddle factor tables, generated by tools/gen_sdft_tables.py: do not edit',
+        '*',
+        '* Command: python3 tools/gen_sdft_tables.py --window %d' % window,
+        '* Only included by sdft.c.',
+        '*/',
+        '',
+        '#ifndef SDFT_TABLES_H_',
+        '#define SDFT_TABLES_H_',
+        '',
+        '#define SDFT_TABLES_WINDOW %d\t/* Window length the tables were generated for */' % window,
+        '',
+    ]
+    lines += table('SDFT_COS', 'cos(2 pi i / SDFT_TABLES_WINDOW)', [math.cos(a) for a in angles])
+    lines += table('SDFT_SIN', 'sin(2 pi i / SDFT_TABLES_WINDOW)', [math.sin(a) for a in angles])
+    lines += ['#endif', '']
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
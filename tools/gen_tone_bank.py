@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Generates src/tone_bank_coeffs.h, the Goertzel bins of the multi-family tone bank of src/tone_bank.c.
+
+The bank uses the Goertzel block length of src/gtzl_coeffs.h, so its DTMF magnitudes are those of goertzel() and
+the same threshold applies. Regenerate after tools/gen_gtzl_coeffs.py:
+
+    python3 tools/gen_tone_bank.py
+
+Each tone uses the integer bin k = round(N * f / fs). Tones of different families that fall in the same bin, such
+as DTMF 697 Hz and MF 700 Hz or the 1100 Hz of fax CNG and MF, share one recursion.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DTMF_TABLE = os.path.join(ROOT, 'src', 'dtmf_table.c')
+
+# Order matches tone_family_t in src/tone_bank.h, DTMF first so that its bins are those of goertzel()
+# The DTMF tones (None) are read from src/dtmf_table.c
+FAMILIES = [
+    ('DTMF', 'DTMF, low then high group', None),
+    ('CP', 'call progress: dial 350+440, ringback 440+480, busy/reorder 480+620', [350, 440, 480, 620]),
+    ('FAX', 'fax calling (CNG) and answer (CED) tones', [1100, 2100]),
+    ('MF', 'MF R1, two of six', [700, 900, 1100, 1300, 1500, 1700]),
+]
+
+
+def read_define(path, name):
+    with open(path) as f:
+        match = re.search(r'^\s*#define\s+%s\s+(\d+)' % name, f.read(), re.M)
+    if match is None:
+        sys.exit('%s: no #define %s' % (path, name))
+    return int(match.group(1))
+
+
+def read_table(path, name):
+    with open(path) as f:
+        match = re.search(r'\b%s\[[^]]*\]\s*=\s*\{([^}]*)\}' % name, f.read())
+    if match is None:
+        sys.exit('%s: no table %s' % (path, name))
+    return [int(x) for x in match.group(1).split(',')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--rate', type=int, help='sample rate in Hz (default: GTZL_COEFFS_SAMPLE_RATE)')
+    parser.add_argument('--block', type=int, help='Goertzel block length (default: GTZL_BLOCK_SIZE)')
+    parser.add_argument('-o', '--output', default=os.path.join(ROOT, 'src', 'tone_bank_coeffs.h'))
+    args = parser.parse_args()
+    dtmf = read_table(DTMF_TABLE, 'dtmf_low_freqs') + read_table(DTMF_TABLE, 'dtmf_high_freqs')
+    families = [(name, title, dtmf if tones is None else tones) for name, title, tones in FAMILIES]
+
+    gtzl = os.path.join(ROOT, 'src', 'gtzl_coeffs.h')
+    rate = args.rate or read_define(gtzl, 'GTZL_COEFFS_SAMPLE_RATE')
+    frame = read_define(gtzl, 'GTZL_COEFFS_FRAME_SIZE')
+    block = args.block or read_define(gtzl, 'GTZL_BLOCK_SIZE')
+    if block > frame:
+        sys.exit('block length %d is longer than the frame (%d)' % (block, frame))
+
+    bins = []
+    tones_of_bin = {}
+    family_bins = []
+    for name, _, tones in families:
+        if max(tones) * 2 >= rate:
+            sys.exit('%s tones above the Nyquist frequency of %d Hz' % (name, rate // 2))
+        indices = []
+        for t in tones:
+            k = int(round(block * t / rate))
+            if k not in tones_of_bin:
+                bins.append(k)
+                tones_of_bin[k] = []
+            tones_of_bin[k].append('%s %d Hz (%+.2f bin)' % (name, t, k - block * t / rate))
+            indices.append(bins.index(k))
+        family_bins.append(indices)
+
+    lines = [
+        '/*! \\file tone_bank_coeffs.h',
+        '* \\brief Tone bank bins, generated by tools/gen_tone_bank.py: do not edit',
+        '*',
+        '* Command: python3 tools/gen_tone_bank.py --rate %d --block %d' % (rate, block),
+        '* Only included by tone_bank.c.',
+        '*/',
+        '',
+        '#ifndef TONE_BANK_COEFFS_H_',
+        '#define TONE_BANK_COEFFS_H_',
+        '',
+        '#define TONE_BANK_SAMPLE_RATE %d\t/* Sample rate the table was generated for */' % rate,
+        '#define TONE_BANK_FRAME_SIZE %d\t/* Frame size the table was generated for */' % frame,
+        '#define TONE_BANK_BLOCK_SIZE %d\t/* Samples of the frame used, GTZL_BLOCK_SIZE */' % block,
+        '#define TONE_BANK_BINS %d\t/* Distinct bins over all families */' % len(bins),
+        '',
+        '/* Coefficient of each bin: 2 * cos(2 * pi * k / TONE_BANK_BLOCK_SIZE) */',
+        'static const double TONE_BANK_COEFFS[TONE_BANK_BINS] = {',
+    ]
+    for i, k in enumerate(bins):
+        c = 2.0 * math.cos(2.0 * math.pi * k / block)
+        lines.append('\t%s%s\t/* k = %d: %s */' % (repr(c), ',' if i + 1 < len(bins) else '', k,
+                                                  ', '.join(tones_of_bin[k])))
+    lines += ['};', '']
+
+    for (name, title, tones), indices in zip(families, family_bins):
+        lines += [
+            '/* %s */' % (title[0].upper() + title[1:]),
+            '#define TONE_BANK_%s_TONES %d' % (name, len(tones)),
+            'static const unsigned char TONE_BANK_%s_BINS[TONE_BANK_%s_TONES] = {%s};'
+            % (name, name, ', '.join(str(i) for i in indices)),
+            '',
+        ]
+    lines += ['#endif', '']
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
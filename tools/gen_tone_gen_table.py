@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Generates src/tone_gen_table.h, the sine table and the DTMF phase steps of the tone generator of src/tone_gen.c.
+
+The sine is a Q15 table of 2^TONE_GEN_TABLE_BITS points plus a copy of the first one, so that the generator can
+interpolate between an entry and the next without wrapping the index. The phase steps advance a 32 bit accumulator by
+one sample of each DTMF frequency at G_SAMPLE_RATE of src/global_parameters.h. After changing G_SAMPLE_RATE the table
+is regenerated with:
+
+    python3 tools/gen_tone_gen_table.py
+
+The build refuses to compile tone_gen.c if the steps were generated for another G_SAMPLE_RATE.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+DTMF_TABLE = os.path.join(ROOT, 'src', 'dtmf_table.c')
+
+
+def read_define(path, name):
+    with open(path) as f:
+        match = re.search(r'^\s*#define\s+%s\s+([0-9]+)' % name, f.read(), re.M)
+    if match is None:
+        sys.exit('%s: no #define %s' % (path, name))
+    return int(match.group(1))
+
+
+def read_table(path, name):
+    with open(path) as f:
+        match = re.search(r'\b%s\[[^]]*\]\s*=\s*\{([^}]*)\}' % name, f.read())
+    if match is None:
+        sys.exit('%s: no table %s' % (path, name))
+    return [int(x) for x in match.group(1).split(',')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-o', '--output', default=os.path.join(ROOT, 'src', 'tone_gen_table.h'))
+    parser.add_argument('--bits', type=int, default=8, help='log2 of the number of points of the sine table')
+    args = parser.parse_args()
+
+    sample_rate = read_define(os.path.join(ROOT, 'src', 'global_parameters.h'), 'G_SAMPLE_RATE')
+    points = 1 << args.bits
+    sine = [int(round(32767 * math.sin(2 * math.pi * i / points))) for i in range(points)]
+    sine.append(sine[0])
+
+    def steps(frequencies):
+        return ', '.join('%du' % int(round(f * 2.0 ** 32 / sample_rate)) for f in frequencies)
+
+    lines = [
+        '/*! \\file tone_gen_table.h',
+        '* \\brief Sine table and DTMF phase steps of the tone generator, generated by tools/gen_tone_gen_table.py: do not edit',
+        '*',
+        '* Command: python3 tools/gen_tone_gen_table.py --bits %d' % args.bits,
+        '* Only included by tone_gen.c.',
+        '*/',
+        '',
+        '#ifndef TONE_GEN_TABLE_H_',
+        '#define TONE_GEN_TABLE_H_',
+        '',
+        '#define TONE_GEN_TABLE_SAMPLE_RATE %d\t/* G_SAMPLE_RATE the steps were computed for */' % sample_rate,
+        '#define TONE_GEN_TABLE_BITS %d' % args.bits,
+        '',
+        '/* 32767 sin(2 pi i / %d), the last entry repeats the first for the interpolation */' % points,
+        'static const int16_t TONE_GEN_SINE[%d] = {' % (points + 1),
+    ]
+    for start in range(0, points + 1, 16):
+        chunk = ', '.join('%d' % v for v in sine[start:start + 16])
+        lines.append('\t%s%s' % (chunk, ',' if start + 16 < points + 1 else ''))
+    lines += [
+        '};',
+        '',
+        '/* Phase steps of 697, 770, 852 and 941 Hz, f 2^32 / G_SAMPLE_RATE */',
+        'static const uint32_t TONE_GEN_STEP_LOW[4] = {%s};' % steps(read_table(DTMF_TABLE, 'dtmf_low_freqs')),
+        '',
+        '/* Phase steps of 1209, 1336, 1477 and 1633 Hz */',
+        'static const uint32_t TONE_GEN_STEP_HIGH[4] = {%s};' % steps(read_table(DTMF_TABLE, 'dtmf_high_freqs')),
+        '',
+        '#endif',
+        '',
+    ]
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Reports the flash and RAM taken by each object of the firmware, for the target or a host build.
+
+Target, from the map file the Keil linker writes with the project settings (lst/BasicUI.map):
+
+    python3 tools/size_report.py --map lst/BasicUI.map
+
+Host, compiling the sources that do not depend on the LPC407x headers with the host compiler and reading their
+sections with `size -A`, optionally next to the same objects at another revision to show what a change saves:
+
+    python3 tools/size_report.py --host --baseline HEAD~1
+
+Flash is code, read-only data and the initial values of the read-write data; RAM is the read-write and the
+zero-initialised data. The host numbers are for the host compiler and word size, double precision data has the same
+size on the Cortex-M4, the code does not.
+"""
+
+import argparse
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Sources of src/ that build on the host, as in the benchmark of host/bench_dtmf.c
+HOST_SOURCES = [
+    'capture.c', 'complex_g3.c', 'decoder.c', 'decoder_gtzl.c', 'detector*.c', 'digit_state.c', 'dtmf_table.c', 'fft.c', 'fsk_cid.c',
+    'g711.c', 'gtzl.c', 'input.c', 'resampler.c', 'rfc4733.c', 'scheduler.c', 'sdft.c', 'self_test.c', 'tone_bank.c', 'tone_gen.c',
+]
+
+# Columns of the "Image component sizes" table of an armlink map
+MAP_LINE = re.compile(r'^\s*(\d+)\s+(\d+)\s+(\d+)\s+(\d+)\s+(\d+)\s+(\d+)\s+(\S+\.o)\s*$')
+
+
+def map_sizes(path):
+    """Returns {object: (flash, ram)} from the object table of an armlink map."""
+    sizes = {}
+    with open(path, errors='replace') as f:
+        in_objects = False
+        for line in f:
+            if 'Object Name' in line:
+                in_objects = True
+            elif 'Library Member Name' in line or 'Object Totals' in line:
+                in_objects = False
+            elif in_objects:
+                match = MAP_LINE.match(line)
+                if match:
+                    code, _, ro, rw, zi, _, name = match.groups()
+                    sizes[name] = (int(code) + int(ro) + int(rw), int(rw) + int(zi))
+    if not sizes:
+        sys.exit('%s: no "Image component sizes" table, enable the map file in the linker listing options' % path)
+    return sizes
+
+
+def object_sizes(path):
+    """Returns (flash, ram) of a host object from `size -A`."""
+    output = subprocess.run(['size', '-A', path], check=True, capture_output=True, text=True).stdout
+    flash = ram = 0
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) < 2 or not fields[1].isdigit():
+            continue
+        name, size = fields[0], int(fields[1])
+        if name.startswith(('.text', '.rodata', '.data.rel.ro')):
+            # Tables of pointers, such as the detector descriptions, are relocated read-only data on PIC hosts
+            flash += size
+        elif name.startswith('.data'):
+            flash += size
+            ram += size
+        elif name.startswith('.bss'):
+            ram += size
+    return flash, ram
+
+
+def host_sizes(root, cc):
+    """Compiles the host sources under root and returns {object: (flash, ram)}."""
+    sizes = {}
+    build = tempfile.mkdtemp(prefix='size_report_')
+    try:
+        for pattern in HOST_SOURCES:
+            for source in sorted(glob.glob(os.path.join(root, 'src', pattern))):
+                name = os.path.splitext(os.path.basename(source))[0] + '.o'
+                target = os.path.join(build, name)
+                subprocess.run([cc, '-std=gnu89', '-O2', '-c', '-I' + os.path.join(ROOT, 'host'),
+                                '-I' + os.path.join(root, 'src'), '-I' + os.path.join(ROOT, 'drivers'),
+                                '-o', target, source], check=True)
+                sizes[name] = object_sizes(target)
+    finally:
+        shutil.rmtree(build)
+    return sizes
+
+
+def revision_sizes(revision, cc):
+    """host_sizes() of the sources at a git revision."""
+    tree = tempfile.mkdtemp(prefix='size_report_tree_')
+    try:
+        archive = subprocess.run(['git', '-C', ROOT, 'archive', revision, 'src'], check=True, capture_output=True).stdout
+        subprocess.run(['tar', '-x', '-C', tree], input=archive, check=True)
+        return host_sizes(tree, cc)
+    finally:
+        shutil.rmtree(tree)
+
+
+def report(sizes, baseline):
+    names = sorted(set(sizes) | set(baseline or {}))
+    header = '%-24s %10s %10s' % ('object', 'flash', 'ram')
+    if baseline is not None:
+        header += ' %10s %10s' % ('d_flash', 'd_ram')
+    print(header)
+    totals = [0, 0, 0, 0]
+    for name in names:
+        flash, ram = sizes.get(name, (0, 0))
+        line = '%-24s %10d %10d' % (name, flash, ram)
+        totals[0] += flash
+        totals[1] += ram
+        if baseline is not None:
+            old_flash, old_ram = baseline.get(name, (0, 0))
+            line += ' %+10d %+10d' % (flash - old_flash, ram - old_ram)
+            totals[2] += flash - old_flash
+            totals[3] += ram - old_ram
+        print(line)
+    line = '%-24s %10d %10d' % ('total', totals[0], totals[1])
+    if baseline is not None:
+        line += ' %+10d %+10d' % (totals[2], totals[3])
+    print(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--map', help='armlink map file of a target build')
+    source.add_argument('--host', action='store_true', help='compile the portable sources with the host compiler')
+    parser.add_argument('--baseline', help='with --host: git revision to compare with; with --map: map file to compare with')
+    parser.add_argument('--cc', default=os.environ.get('CC', 'cc'), help='host compiler (default: $CC or cc)')
+    args = parser.parse_args()
+
+    if args.map:
+        report(map_sizes(args.map), map_sizes(args.baseline) if args.baseline else None)
+    else:
+        report(host_sizes(ROOT, args.cc), revision_sizes(args.baseline, args.cc) if args.baseline else None)
+
+
+if __name__ == '__main__':
+    main()